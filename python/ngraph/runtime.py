@@ -53,17 +53,27 @@ class Runtime:
 
 
 class Computation:
-    """ngraph callable computation object."""
+    """ngraph callable computation object.
+
+    On host backends inputs and outputs are wrapped as tensor views over NumPy memory without
+    copying, and the GIL is released while the backend runs, so a Computation may be called
+    from several threads at once.
+    """
+
+    # backends whose tensor views can wrap host memory
+    zero_copy_backends = ('CPU', 'INTERPRETER')
 
     def __init__(self, runtime, node, *parameters):  # type: (Runtime, Node, *Parameter) -> None
         self.runtime = runtime
         self.node = node
         self.parameters = parameters
+        self.zero_copy = runtime.backend_name in Computation.zero_copy_backends
         self.tensor_views = []  # type: List[TensorViewType]
-        for parameter in parameters:
-            shape = parameter.get_shape()
-            element_type = parameter.get_element_type()
-            self.tensor_views.append(runtime.backend.create_tensor(element_type, shape))
+        if not self.zero_copy:
+            for parameter in parameters:
+                shape = parameter.get_shape()
+                element_type = parameter.get_element_type()
+                self.tensor_views.append(runtime.backend.create_tensor(element_type, shape))
         self.function = Function(self.node, self.parameters, 'ngraph_computation')
         self.backend = runtime.backend
 
@@ -73,18 +83,30 @@ class Computation:
 
     def __call__(self, *input_values):  # type: (*NumericData) -> NumericData
         """Run computation on input values and return result."""
+        result_element_type = self.node.get_element_type()
+        result_shape = self.node.get_shape()
+        result_dtype = get_dtype(result_element_type)
+        result_arr = np.empty(result_shape, dtype=result_dtype)
+
+        if self.zero_copy:
+            input_views = []
+            for parameter, value in zip(self.parameters, input_values):
+                element_type = parameter.get_element_type()
+                shape = parameter.get_shape()
+                value = Computation._as_contiguous_ndarray(value, element_type, shape)
+                input_views.append(self.backend.create_tensor(element_type, shape, value))
+            result_view = self.backend.create_tensor(result_element_type, result_shape,
+                                                     result_arr)
+            self.backend.call(self.function, [result_view], input_views)
+            return result_arr
+
         for tensor_view, value in zip(self.tensor_views, input_values):
             if not isinstance(value, np.ndarray):
                 value = np.array(value)
             Computation._write_ndarray_to_tensor_view(value, tensor_view)
 
-        result_element_type = self.node.get_element_type()
-        result_shape = self.node.get_shape()
-        result_dtype = get_dtype(result_element_type)
-
         result_view = self.runtime.backend.create_tensor(
             result_element_type, result_shape)
-        result_arr = np.empty(result_shape, dtype=result_dtype)
 
         self.backend.call(self.function, [result_view], self.tensor_views)
 
@@ -104,6 +126,26 @@ class Computation:
     def _get_buffer_size(element_type, element_count):  # type: (TensorViewType, int) -> int
         return int((element_type.bitwidth / 8.0) * element_count)
 
+    @staticmethod
+    def _as_contiguous_ndarray(value, element_type, shape):
+        # type: (NumericData, TensorViewType, List[int]) -> np.ndarray
+        """Return value as a C-contiguous array of the tensor's type, copying only if needed."""
+        value = np.asarray(value)
+        if list(shape) != list(value.shape):
+            if len(value.shape) > 0:
+                raise UserInputError(
+                    'Provided tensor\'s shape: %s does not match the expected: %s.',
+                    list(value.shape), list(shape))
+            value = np.broadcast_to(value, shape)
+        dtype = get_dtype(element_type)
+        if value.dtype != dtype:
+            log.warning(
+                'Attempting to write a %s value to a %s tensor. Will attempt type conversion.',
+                value.dtype,
+                element_type)
+            value = value.astype(dtype)
+        return np.ascontiguousarray(value)
+
     @staticmethod
     def _write_ndarray_to_tensor_view(value, tensor_view):
         # type: (np.ndarray, TensorViewType) -> None
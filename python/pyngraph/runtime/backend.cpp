@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 //#include <string>
@@ -23,6 +24,26 @@
 
 namespace py = pybind11;
 
+// Wraps the memory of a C-contiguous array of element_type values without copying. The array
+// must outlive the tensor view.
+static std::shared_ptr<ngraph::runtime::TensorView>
+    create_tensor_from_array(ngraph::runtime::Backend& backend,
+                             const ngraph::element::Type& element_type,
+                             const ngraph::Shape& shape,
+                             py::array array)
+{
+    if (!(array.flags() & py::array::c_style))
+    {
+        throw std::invalid_argument("Array must be C-contiguous");
+    }
+    if (static_cast<size_t>(array.itemsize()) != element_type.size() ||
+        static_cast<size_t>(array.size()) != ngraph::shape_size(shape))
+    {
+        throw std::invalid_argument("Array does not match the tensor's element type and shape");
+    }
+    return backend.create_tensor(element_type, shape, array.request().ptr);
+}
+
 void regclass_pyngraph_runtime_Backend(py::module m)
 {
     py::class_<ngraph::runtime::Backend, std::shared_ptr<ngraph::runtime::Backend>> backend(
@@ -34,15 +55,18 @@ void regclass_pyngraph_runtime_Backend(py::module m)
                 (std::shared_ptr<ngraph::runtime::TensorView>(ngraph::runtime::Backend::*)(
                     const ngraph::element::Type&, const ngraph::Shape&)) &
                     ngraph::runtime::Backend::create_tensor);
+    backend.def("create_tensor", &create_tensor_from_array, py::keep_alive<0, 4>());
     backend.def("compile",
                 (void (ngraph::runtime::Backend::*)(std::shared_ptr<ngraph::Function>)) &
-                    ngraph::runtime::Backend::compile);
+                    ngraph::runtime::Backend::compile,
+                py::call_guard<py::gil_scoped_release>());
     backend.def("call",
                 (void (ngraph::runtime::Backend::*)(
                     std::shared_ptr<ngraph::Function>,
                     const std::vector<std::shared_ptr<ngraph::runtime::TensorView>>&,
                     const std::vector<std::shared_ptr<ngraph::runtime::TensorView>>&)) &
-                    ngraph::runtime::Backend::call);
+                    ngraph::runtime::Backend::call,
+                py::call_guard<py::gil_scoped_release>());
     backend.def("remove_compiled_function",
                 (void (ngraph::runtime::Backend::*)(std::shared_ptr<ngraph::Function>)) &
                     ngraph::runtime::Backend::remove_compiled_function);
@@ -16,6 +16,7 @@
 import numpy as np
 import pytest
 import json
+import threading
 
 import ngraph as ng
 from test.ngraph.util import get_runtime, run_op_node
@@ -173,6 +174,35 @@ def test_bad_data_shape():
         computation(value_a, value_b)
 
 
+@pytest.config.gpu_skip(reason='Not implemented')
+def test_computation_from_threads():
+    runtime = get_runtime()
+
+    shape = [16, 16]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name='A')
+    parameter_b = ng.parameter(shape, dtype=np.float32, name='B')
+    computation = runtime.computation(parameter_a * parameter_b + parameter_a,
+                                      parameter_a, parameter_b)
+
+    results = {}
+
+    def run(index):
+        # transposed inputs are not contiguous
+        value_a = np.full(shape, index, dtype=np.float32).T
+        value_b = np.arange(256, dtype=np.float32).reshape(shape).T
+        results[index] = (computation(value_a, value_b), value_a * value_b + value_a)
+
+    threads = [threading.Thread(target=run, args=(index,)) for index in range(8)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+    assert len(results) == 8
+    for result, expected in results.values():
+        assert np.allclose(result, expected)
+
+
 def test_constant_get_data_bool():
     input_data = np.array([True, False, False, True])
     node = ng.constant(input_data, dtype=np.bool)
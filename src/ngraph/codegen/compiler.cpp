@@ -14,7 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
 #include <iostream>
+#include <mutex>
 
 #include <clang/Basic/DiagnosticOptions.h>
 #include <clang/Basic/TargetInfo.h>
@@ -79,7 +81,12 @@ public:
     shared_ptr<codegen::CompilerCore> compiler;
 };
 
+// Compilers and precompiled headers are shared by every codegen::Compiler in the process and
+// keyed on the precompiled header source, so a PCH is only regenerated when the header changes
 static unordered_map<string, CompilerInfo> s_compiler_info;
+static mutex s_compiler_mutex;
+static atomic<size_t> s_pch_hit_count{0};
+static atomic<size_t> s_pch_miss_count{0};
 
 static class StaticHandler
 {
@@ -131,8 +138,21 @@ void codegen::Compiler::add_header_search_path(const std::string& path)
 
 std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& source)
 {
-    // lock_guard<mutex> lock(m_mutex);
+    // CompilerCore is not reentrant and is shared with every other Compiler using the same
+    // precompiled header
+    lock_guard<mutex> lock(s_compiler_mutex);
     CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
+    if (!m_precompiled_header_source.empty())
+    {
+        if (compiler_info.pch_file.empty())
+        {
+            s_pch_miss_count++;
+        }
+        else
+        {
+            s_pch_hit_count++;
+        }
+    }
     if (!compiler_info.compiler)
     {
         compiler_info.compiler = make_shared<CompilerCore>();
@@ -146,6 +166,16 @@ std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& s
     return rc;
 }
 
+size_t codegen::Compiler::get_pch_hit_count()
+{
+    return s_pch_hit_count;
+}
+
+size_t codegen::Compiler::get_pch_miss_count()
+{
+    return s_pch_miss_count;
+}
+
 static std::string GetExecutablePath(const char* Argv0)
 {
     // This just needs to be some symbol in the binary; C++ doesn't
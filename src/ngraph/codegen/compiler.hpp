@@ -61,6 +61,11 @@ public:
     void add_header_search_path(const std::string& path);
     std::unique_ptr<ngraph::codegen::Module> compile(const std::string& source);
     std::unique_ptr<clang::CodeGenAction>& get_compiler_action() { return m_compiler_action; }
+    /// \brief Number of compiles in this process that reused an existing precompiled header
+    static size_t get_pch_hit_count();
+    /// \brief Number of compiles in this process that had to generate a precompiled header
+    static size_t get_pch_miss_count();
+
 private:
     std::unique_ptr<clang::CodeGenAction> m_compiler_action;
     std::shared_ptr<CompilerCore> m_compiler_core;
@@ -14,12 +14,61 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdio>
+
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Object/ObjectFile.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/raw_ostream.h>
 
 #include "ngraph/codegen/execution_engine.hpp"
 
 using namespace ngraph;
 
+namespace
+{
+    // Writes the object code MCJIT generates to a file. Lookups are done by the caller
+    // through add_object_file so getObject never supplies anything.
+    class FileObjectCache : public llvm::ObjectCache
+    {
+    public:
+        FileObjectCache(const std::string& path)
+            : m_path(path)
+        {
+        }
+
+        void notifyObjectCompiled(const llvm::Module* module,
+                                  llvm::MemoryBufferRef object) override
+        {
+            // Write to a temporary and rename so concurrent processes never observe a
+            // partially written object
+            std::string tmp = m_path + ".tmp";
+            std::error_code ec;
+            {
+                llvm::raw_fd_ostream out(tmp, ec, llvm::sys::fs::F_None);
+                if (ec)
+                {
+                    return;
+                }
+                out << object.getBuffer();
+            }
+            std::rename(tmp.c_str(), m_path.c_str());
+        }
+
+        std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override
+        {
+            return nullptr;
+        }
+
+    private:
+        std::string m_path;
+    };
+}
+
 codegen::ExecutionEngine::ExecutionEngine()
     : m_execution_engine{nullptr}
 {
@@ -39,18 +88,7 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
     {
         if (!m_execution_engine)
         {
-            m_execution_engine.reset(llvm::EngineBuilder(module->take_module())
-                                         .setEngineKind(llvm::EngineKind::JIT)
-                                         .setOptLevel(llvm::CodeGenOpt::Aggressive)
-                                         .setMCPU(llvm::sys::getHostCPUName())
-                                         //  .setCodeModel(llvm::CodeModel::Medium)
-                                         .setErrorStr(&m_jit_error)
-                                         .create());
-
-            if (!m_execution_engine)
-            {
-                return false;
-            }
+            return create_engine(module->take_module());
         }
     }
     else
@@ -61,6 +99,64 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
     return true;
 }
 
+bool codegen::ExecutionEngine::add_object_file(const std::string& path)
+{
+    auto object = llvm::object::ObjectFile::createObjectFile(path);
+    if (!object)
+    {
+        llvm::consumeError(object.takeError());
+        return false;
+    }
+    if (!m_execution_engine)
+    {
+        // MCJIT is always created around a module, an empty one is enough to host
+        // the object code
+        m_context.reset(new llvm::LLVMContext());
+        std::unique_ptr<llvm::Module> module(new llvm::Module("object_file", *m_context));
+        if (!create_engine(std::move(module)))
+        {
+            return false;
+        }
+    }
+    m_execution_engine->addObjectFile(std::move(object.get()));
+    return true;
+}
+
+void codegen::ExecutionEngine::set_object_cache_file(const std::string& path)
+{
+    m_object_cache.reset(new FileObjectCache(path));
+    if (m_execution_engine)
+    {
+        m_execution_engine->setObjectCache(m_object_cache.get());
+    }
+}
+
+bool codegen::ExecutionEngine::create_engine(std::unique_ptr<llvm::Module> module)
+{
+    m_execution_engine.reset(llvm::EngineBuilder(std::move(module))
+                                 .setEngineKind(llvm::EngineKind::JIT)
+                                 .setOptLevel(llvm::CodeGenOpt::Aggressive)
+                                 .setMCPU(llvm::sys::getHostCPUName())
+                                 //  .setCodeModel(llvm::CodeModel::Medium)
+                                 .setErrorStr(&m_jit_error)
+                                 .create());
+
+    if (!m_execution_engine)
+    {
+        return false;
+    }
+    if (m_object_cache)
+    {
+        m_execution_engine->setObjectCache(m_object_cache.get());
+    }
+    return true;
+}
+
+std::string codegen::ExecutionEngine::get_host_cpu_name()
+{
+    return llvm::sys::getHostCPUName().str();
+}
+
 void codegen::ExecutionEngine::finalize()
 {
     if (m_execution_engine)
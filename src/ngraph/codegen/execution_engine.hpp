@@ -31,8 +31,10 @@ namespace ngraph
 
 namespace llvm
 {
+    class LLVMContext;
     class Module;
     class ExecutionEngine;
+    class ObjectCache;
 }
 
 class ngraph::codegen::ExecutionEngine
@@ -42,8 +44,21 @@ public:
     ~ExecutionEngine();
 
     bool add_module(std::unique_ptr<ngraph::codegen::Module>& module);
+
+    /// \brief Load previously compiled object code instead of a module.
+    /// \param path Path of an object file written through set_object_cache_file.
+    /// \return false if the file could not be loaded, in which case the caller should
+    ///         fall back to compiling the source.
+    bool add_object_file(const std::string& path);
+
+    /// \brief Save the object code generated for the next module added to path.
+    ///        Must be called before add_module.
+    void set_object_cache_file(const std::string& path);
+
     void finalize();
 
+    static std::string get_host_cpu_name();
+
     template <typename ftype>
     std::function<ftype> find_function(const std::string& func_name)
     {
@@ -51,9 +66,13 @@ public:
     }
 
 private:
+    // Owns the placeholder module used when only object files are loaded
+    std::unique_ptr<llvm::LLVMContext> m_context;
+    std::unique_ptr<llvm::ObjectCache> m_object_cache;
     std::unique_ptr<llvm::ExecutionEngine> m_execution_engine;
     std::string m_jit_error;
 
+    bool create_engine(std::unique_ptr<llvm::Module> module);
     void* get_pointer_to_named_function(const std::string& func_name);
     template <typename signature>
     std::function<signature> f_cast(void* f)
@@ -129,8 +129,18 @@ void cpio::Header::write(ostream& stream, const string& name, uint32_t size)
     stream.write(name.c_str(), namesize + (namesize % 2));
 }
 
+size_t cpio::Header::size(const string& name)
+{
+    // namesize includes the null string terminator so + 1
+    size_t namesize = name.size() + 1;
+    return 26 + namesize + (namesize % 2);
+}
+
+static const string s_padding_name = ".padding";
+
 cpio::Writer::Writer()
     : m_stream(nullptr)
+    , m_offset(0)
 {
 }
 
@@ -154,11 +164,13 @@ cpio::Writer::~Writer()
 void cpio::Writer::open(ostream& out)
 {
     m_stream = &out;
+    m_offset = 0;
 }
 
 void cpio::Writer::open(const string& filename)
 {
     m_stream = &m_my_stream;
+    m_offset = 0;
     m_my_stream.open(filename, ios_base::binary | ios_base::out);
 }
 
@@ -182,6 +194,7 @@ void cpio::Writer::write(const string& record_name, const void* data, uint32_t s
             char ch = 0;
             m_stream->write(&ch, 1);
         }
+        m_offset += Header::size(record_name) + size_in_bytes + (size_in_bytes % 2);
     }
     else
     {
@@ -189,6 +202,27 @@ void cpio::Writer::write(const string& record_name, const void* data, uint32_t s
     }
 }
 
+void cpio::Writer::write(const string& record_name,
+                         const void* data,
+                         uint32_t size_in_bytes,
+                         size_t alignment)
+{
+    if (alignment % 2 != 0 && alignment != 1)
+    {
+        throw runtime_error("cpio alignment must be even");
+    }
+    if ((m_offset + Header::size(record_name)) % alignment != 0)
+    {
+        // Records start on even offsets so the padding size is always even
+        size_t padded_offset = m_offset + Header::size(s_padding_name);
+        size_t padding =
+            (alignment - (padded_offset + Header::size(record_name)) % alignment) % alignment;
+        vector<char> zeros(padding, 0);
+        write(s_padding_name, zeros.data(), static_cast<uint32_t>(padding));
+    }
+    write(record_name, data, size_in_bytes);
+}
+
 cpio::Reader::Reader()
     : m_stream(nullptr)
 {
@@ -255,7 +289,10 @@ const vector<cpio::FileInfo>& cpio::Reader::get_file_info()
             }
 
             size_t offset = m_stream->tellg();
-            m_file_info.emplace_back(file_name, header.filesize, offset);
+            if (file_name != s_padding_name)
+            {
+                m_file_info.emplace_back(file_name, header.filesize, offset);
+            }
 
             m_stream->seekg((header.filesize % 2) + header.filesize, ios_base::cur);
         }
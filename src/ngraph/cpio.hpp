@@ -52,6 +52,8 @@ public:
 
     static Header read(std::istream&);
     static void write(std::ostream&, const std::string& name, uint32_t size);
+    // Size in bytes of the header and name of a record
+    static size_t size(const std::string& name);
 
 private:
 };
@@ -87,10 +89,17 @@ public:
     void open(const std::string& filename);
     void close();
     void write(const std::string& file_name, const void* data, uint32_t size_in_bytes);
+    // Writes a record whose data starts at a multiple of alignment bytes from the start of
+    // the archive, preceded by a padding record if needed. Readers skip padding records.
+    void write(const std::string& file_name,
+               const void* data,
+               uint32_t size_in_bytes,
+               size_t alignment);
 
 private:
     std::ostream* m_stream;
     std::ofstream m_my_stream;
+    size_t m_offset;
 };
 
 class ngraph::cpio::Reader
@@ -21,6 +21,7 @@
 #include <dirent.h>
 #include <ftw.h>
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/time.h>
 #include <unistd.h>
 #endif
@@ -229,6 +230,32 @@ vector<char> file_util::read_file_contents(const string& path)
     return data;
 }
 
+shared_ptr<const char> file_util::map_file(const string& path, size_t& size)
+{
+    size = get_file_size(path);
+#ifdef WIN32
+    auto data = make_shared<vector<char>>(read_file_contents(path));
+    return shared_ptr<const char>(data, data->data());
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw runtime_error("error opening file '" + path + "'");
+    }
+    // mmap of zero bytes fails, map one page so empty files get a valid pointer
+    size_t map_size = (size == 0 ? 1 : size);
+    void* data = mmap(nullptr, map_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        throw runtime_error("error mapping file '" + path + "'");
+    }
+    return shared_ptr<const char>(static_cast<const char*>(data), [map_size](const char* p) {
+        munmap(const_cast<char*>(p), map_size);
+    });
+#endif
+}
+
 string file_util::read_file_to_string(const string& path)
 {
     ifstream f(path);
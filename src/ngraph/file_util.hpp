@@ -17,6 +17,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -78,6 +79,13 @@ namespace ngraph
         // @return string of the file's contents
         std::string read_file_to_string(const std::string& path);
 
+        // @brief Maps the contents of a file read-only into memory. The pages are shared with
+        //    the page cache, and with other processes mapping the same file.
+        // @param path The path of the file to map
+        // @param size Set to the size in bytes of the file
+        // @return Pointer to the file's contents, unmapped when the last reference is released
+        std::shared_ptr<const char> map_file(const std::string& path, size_t& size);
+
         // @brief Iterate through files and optionally directories. Symbolic links are skipped.
         // @param path The path to iterate over
         // @param func A callback function called with each file or directory encountered
@@ -141,6 +141,23 @@ namespace ngraph
                     throw error::tensor::invalid_data_type{tensor.data_type()};
                 }
 
+                template <>
+                inline std::vector<float16> get_data(const onnx::TensorProto& tensor)
+                {
+                    if (tensor.data_type() != onnx::TensorProto_DataType_FLOAT16)
+                    {
+                        throw error::tensor::invalid_data_type{tensor.data_type()};
+                    }
+                    // ONNX keeps the IEEE binary16 bit patterns in the low halves of int32_data
+                    std::vector<float16> rc;
+                    rc.reserve(tensor.int32_data_size());
+                    for (int32_t bits : tensor.int32_data())
+                    {
+                        rc.push_back(float16::from_bits(static_cast<uint16_t>(bits)));
+                    }
+                    return rc;
+                }
+
                 template <>
                 inline std::vector<int32_t> get_data(const onnx::TensorProto& tensor)
                 {
@@ -243,8 +260,8 @@ namespace ngraph
                 switch (m_tensor_proto.data_type())
                 {
                 case onnx::TensorProto_DataType::TensorProto_DataType_BOOL: return element::boolean;
-                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT:
-                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT16: return element::f32;
+                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT: return element::f32;
+                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT16: return element::f16;
                 case onnx::TensorProto_DataType::TensorProto_DataType_DOUBLE: return element::f64;
                 case onnx::TensorProto_DataType::TensorProto_DataType_INT8: return element::i8;
                 case onnx::TensorProto_DataType::TensorProto_DataType_INT16: return element::i16;
@@ -87,8 +87,8 @@ namespace ngraph
                 switch (m_value_info_proto.type().tensor_type().elem_type())
                 {
                 case onnx::TensorProto_DataType::TensorProto_DataType_BOOL: return element::boolean;
-                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT:
-                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT16: return element::f32;
+                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT: return element::f32;
+                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT16: return element::f16;
                 case onnx::TensorProto_DataType::TensorProto_DataType_DOUBLE: return element::f64;
                 case onnx::TensorProto_DataType::TensorProto_DataType_INT8: return element::i8;
                 case onnx::TensorProto_DataType::TensorProto_DataType_INT16: return element::i16;
@@ -133,8 +133,9 @@ namespace ngraph
                 case onnx::TensorProto_DataType::TensorProto_DataType_BOOL:
                     return make_ng_constant<bool>(element::boolean, tensor);
                 case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT:
-                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT16:
                     return make_ng_constant<float>(element::f32, tensor);
+                case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT16:
+                    return make_ng_constant<float16>(element::f16, tensor);
                 case onnx::TensorProto_DataType::TensorProto_DataType_DOUBLE:
                     return make_ng_constant<double>(element::f64, tensor);
                 case onnx::TensorProto_DataType::TensorProto_DataType_INT8:
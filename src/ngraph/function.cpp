@@ -27,6 +27,7 @@ using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Function::m_next_instance_id(0);
+atomic<size_t> Function::m_ordered_ops_cache_hits(0);
 
 Function::Function(const ResultVector& results,
                    const op::ParameterVector& parameters,
@@ -37,6 +38,8 @@ Function::Function(const ResultVector& results,
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_instance_id))
+    , m_ordered_ops_version(0)
+    , m_ordered_ops_valid(false)
 {
     init();
 }
@@ -50,6 +53,8 @@ Function::Function(const NodeVector& results,
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_instance_id))
+    , m_ordered_ops_version(0)
+    , m_ordered_ops_valid(false)
 {
     if (std::any_of(results.cbegin(), results.cend(), [](std::shared_ptr<Node> n) {
             return std::dynamic_pointer_cast<op::Result>(n);
@@ -91,7 +96,20 @@ void Function::init()
 
 std::list<shared_ptr<Node>> Function::get_ordered_ops()
 {
-    return topological_sort(get_ops());
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    // Any reconnected input, made through replace_node or directly, bumps the topology version
+    size_t version = Node::get_topology_version();
+    if (m_ordered_ops_valid && m_ordered_ops_version == version)
+    {
+        m_ordered_ops_cache_hits++;
+    }
+    else
+    {
+        m_ordered_ops = topological_sort(get_ops());
+        m_ordered_ops_version = version;
+        m_ordered_ops_valid = true;
+    }
+    return m_ordered_ops;
 }
 
 const std::string& Function::get_friendly_name() const
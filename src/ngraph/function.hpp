@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -75,7 +76,11 @@ namespace ngraph
         //  an XLA or regular function
         void set_name(const std::string& name);
         std::list<std::shared_ptr<Node>> get_ops() const;
+        /// Return the ops in topological order. The order is cached and only recomputed after
+        /// a graph has been modified.
         std::list<std::shared_ptr<Node>> get_ordered_ops();
+        /// Return the number of get_ordered_ops() calls in this process answered from the cache
+        static size_t get_ordered_ops_cache_hits() { return m_ordered_ops_cache_hits; }
         friend std::ostream& operator<<(std::ostream&, const Function&);
         size_t get_instance_id() { return m_instance_id; }
         size_t get_temporary_pool_size();
@@ -96,5 +101,11 @@ namespace ngraph
         size_t m_instance_id;
         std::string m_name;
         const std::string m_unique_name;
+
+        std::list<std::shared_ptr<Node>> m_ordered_ops;
+        size_t m_ordered_ops_version;
+        bool m_ordered_ops_valid;
+        std::mutex m_ordered_ops_mutex;
+        static std::atomic<size_t> m_ordered_ops_cache_hits;
     };
 }
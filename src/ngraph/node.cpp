@@ -31,6 +31,7 @@ using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::m_topology_version(0);
 
 Node::Node(const std::string& node_type, const NodeVector& arguments)
     : m_node_type(node_type)
@@ -194,6 +194,9 @@ namespace ngraph
         NodeVector get_users() const;
 
         virtual std::shared_ptr<Node> get_default_value() const { return nullptr; }
+        /// Incremented whenever an input anywhere is reconnected to a different output, so
+        /// orderings computed from an earlier version of a graph can be detected as stale.
+        static size_t get_topology_version() { return m_topology_version; }
     protected:
         void add_output(const element::Type& element_type, const Shape& shape);
 
@@ -202,6 +205,7 @@ namespace ngraph
         std::string m_name;
         const std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
+        static std::atomic<size_t> m_topology_version;
         std::deque<descriptor::Input> m_inputs;
         std::deque<descriptor::Output> m_outputs;
         std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
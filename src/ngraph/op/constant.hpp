@@ -104,6 +104,28 @@ namespace ngraph
                 set_value_type_checked(vt);
             }
 
+            /// \brief Constructs a tensor constant that refers to data without copying it. This
+            //         constructor is to support deserialization of constants from mapped files
+            //         and constants stored in a backend specific layout.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param data A void* to constant data, which must not be modified.
+            /// \param data_owner Keeps data alive for the lifetime of the constant.
+            Constant(const element::Type& type,
+                     const Shape& shape,
+                     const void* data,
+                     std::shared_ptr<const void> data_owner)
+                : Node("Constant", {})
+                , m_element_type(type)
+                , m_shape(shape)
+                , m_data(const_cast<void*>(data))
+                , m_data_owner(data_owner)
+            {
+                auto vt = std::make_shared<TensorViewType>(type, shape);
+                set_value_type_checked(vt);
+            }
+
             virtual ~Constant() override;
 
             /// \brief Wrapper around constructing a shared_ptr of a Constant
@@ -193,6 +215,14 @@ namespace ngraph
                 {
                     write_buffer<char, T>(target, source, target_element_count);
                 }
+                else if (target_type == element::bf16)
+                {
+                    write_buffer<bfloat16, T>(target, source, target_element_count);
+                }
+                else if (target_type == element::f16)
+                {
+                    write_buffer<float16, T>(target, source, target_element_count);
+                }
                 else if (target_type == element::f32)
                 {
                     write_buffer<float, T>(target, source, target_element_count);
@@ -242,6 +272,8 @@ namespace ngraph
             element::Type m_element_type;
             Shape m_shape;
             void* m_data;
+            // Set when m_data is not owned by the constant
+            std::shared_ptr<const void> m_data_owner;
         };
     }
 }
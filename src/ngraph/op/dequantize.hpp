@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+#include "ngraph/type/element_type.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Elementwise conversion of an affine-quantized tensor back to real values.
+        ///
+        /// Each output element is `(q - zero_point) * scale`.
+        class Dequantize : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \brief Constructs a dequantize operation.
+            ///
+            /// \param arg          Node that produces the i8 or u8 input tensor.
+            /// \param element_type Real element type of the output, f32 or f64.
+            /// \param scale        Real value of one quantization step; must be positive.
+            /// \param zero_point   Quantized value that represents real zero.
+            Dequantize(const std::shared_ptr<Node>& arg,
+                       const element::Type& element_type,
+                       float scale,
+                       int32_t zero_point);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            float get_scale() const { return m_scale; }
+            int32_t get_zero_point() const { return m_zero_point; }
+        protected:
+            float m_scale;
+            int32_t m_zero_point;
+        };
+    }
+}
@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <limits>
+
+#include "ngraph/op/quantize.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+void op::util::validate_quantization_params(const element::Type& element_type,
+                                            float scale,
+                                            int32_t zero_point)
+{
+    int32_t min_value;
+    int32_t max_value;
+    if (element_type == element::i8)
+    {
+        min_value = numeric_limits<int8_t>::min();
+        max_value = numeric_limits<int8_t>::max();
+    }
+    else if (element_type == element::u8)
+    {
+        min_value = numeric_limits<uint8_t>::min();
+        max_value = numeric_limits<uint8_t>::max();
+    }
+    else
+    {
+        throw ngraph_error("Quantized element type must be i8 or u8");
+    }
+    if (!(scale > 0))
+    {
+        throw ngraph_error("Quantization scale must be positive");
+    }
+    if (zero_point < min_value || zero_point > max_value)
+    {
+        throw ngraph_error("Quantization zero point " + to_string(zero_point) +
+                           " is not representable in the quantized element type");
+    }
+}
+
+op::Quantize::Quantize(const shared_ptr<Node>& arg,
+                       const element::Type& element_type,
+                       float scale,
+                       int32_t zero_point)
+    : RequiresTensorViewArgs("Quantize", {arg})
+    , m_scale(scale)
+    , m_zero_point(zero_point)
+{
+    auto& arg_et = arg->get_element_type();
+    if (arg_et != element::f32 && arg_et != element::f64)
+    {
+        throw ngraph_error("Quantize input must be f32 or f64");
+    }
+    util::validate_quantization_params(element_type, scale, zero_point);
+
+    set_value_type_checked(element_type, arg->get_shape());
+}
+
+shared_ptr<Node> op::Quantize::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 1)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<Quantize>(new_args.at(0), get_element_type(), m_scale, m_zero_point);
+}
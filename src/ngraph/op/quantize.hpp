@@ -0,0 +1,64 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+#include "ngraph/type/element_type.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Elementwise affine quantization of a real-valued tensor.
+        ///
+        /// Each output element is `clamp(round(x / scale) + zero_point)`, where rounding is to
+        /// the nearest integer (ties to even) and the clamp is to the range of the output type.
+        class Quantize : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \brief Constructs a quantize operation.
+            ///
+            /// \param arg          Node that produces the f32 or f64 input tensor.
+            /// \param element_type Quantized element type of the output, i8 or u8.
+            /// \param scale        Real value of one quantization step; must be positive.
+            /// \param zero_point   Quantized value that represents real zero.
+            Quantize(const std::shared_ptr<Node>& arg,
+                     const element::Type& element_type,
+                     float scale,
+                     int32_t zero_point);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            float get_scale() const { return m_scale; }
+            int32_t get_zero_point() const { return m_zero_point; }
+        protected:
+            float m_scale;
+            int32_t m_zero_point;
+        };
+
+        namespace util
+        {
+            /// \brief Checks that `element_type` is i8 or u8, that `scale` is positive and that
+            ///        `zero_point` is representable in `element_type`.
+            void validate_quantization_params(const element::Type& element_type,
+                                              float scale,
+                                              int32_t zero_point);
+        }
+    }
+}
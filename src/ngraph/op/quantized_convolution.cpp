@@ -0,0 +1,163 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "ngraph/op/quantized_convolution.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::QuantizedConvolution::QuantizedConvolution(const shared_ptr<Node>& data_batch,
+                                               const shared_ptr<Node>& filters,
+                                               const Strides& window_movement_strides,
+                                               const Strides& window_dilation_strides,
+                                               const CoordinateDiff& padding_below,
+                                               const CoordinateDiff& padding_above,
+                                               float data_scale,
+                                               int32_t data_zero_point,
+                                               float filter_scale,
+                                               int32_t filter_zero_point,
+                                               const element::Type& output_type,
+                                               float output_scale,
+                                               int32_t output_zero_point,
+                                               bool with_relu)
+    : RequiresTensorViewArgs("QuantizedConvolution", {data_batch, filters})
+    , m_window_movement_strides(window_movement_strides)
+    , m_window_dilation_strides(window_dilation_strides)
+    , m_padding_below(padding_below)
+    , m_padding_above(padding_above)
+    , m_data_scale(data_scale)
+    , m_data_zero_point(data_zero_point)
+    , m_filter_scale(filter_scale)
+    , m_filter_zero_point(filter_zero_point)
+    , m_output_scale(output_scale)
+    , m_output_zero_point(output_zero_point)
+    , m_with_relu(with_relu)
+{
+    validate_and_infer_output(output_type);
+}
+
+op::QuantizedConvolution::QuantizedConvolution(const shared_ptr<Node>& data_batch,
+                                               const shared_ptr<Node>& filters,
+                                               const shared_ptr<Node>& bias,
+                                               const Strides& window_movement_strides,
+                                               const Strides& window_dilation_strides,
+                                               const CoordinateDiff& padding_below,
+                                               const CoordinateDiff& padding_above,
+                                               float data_scale,
+                                               int32_t data_zero_point,
+                                               float filter_scale,
+                                               int32_t filter_zero_point,
+                                               const element::Type& output_type,
+                                               float output_scale,
+                                               int32_t output_zero_point,
+                                               bool with_relu)
+    : RequiresTensorViewArgs("QuantizedConvolution", {data_batch, filters, bias})
+    , m_window_movement_strides(window_movement_strides)
+    , m_window_dilation_strides(window_dilation_strides)
+    , m_padding_below(padding_below)
+    , m_padding_above(padding_above)
+    , m_data_scale(data_scale)
+    , m_data_zero_point(data_zero_point)
+    , m_filter_scale(filter_scale)
+    , m_filter_zero_point(filter_zero_point)
+    , m_output_scale(output_scale)
+    , m_output_zero_point(output_zero_point)
+    , m_with_relu(with_relu)
+{
+    auto& bias_shape = bias->get_shape();
+    if (bias->get_element_type() != element::i32)
+    {
+        throw ngraph_error("Quantized convolution bias must be i32");
+    }
+    if (bias_shape.size() != 1 || bias_shape[0] != filters->get_shape().at(0))
+    {
+        throw ngraph_error("Quantized convolution bias shape " + vector_to_string(bias_shape) +
+                           " does not match the number of filters");
+    }
+    validate_and_infer_output(output_type);
+}
+
+void op::QuantizedConvolution::validate_and_infer_output(const element::Type& output_type)
+{
+    auto& data_batch_shape = get_input_shape(0);
+    auto& filters_shape = get_input_shape(1);
+
+    util::validate_quantization_params(get_input_element_type(0), m_data_scale, m_data_zero_point);
+    util::validate_quantization_params(
+        get_input_element_type(1), m_filter_scale, m_filter_zero_point);
+    util::validate_quantization_params(output_type, m_output_scale, m_output_zero_point);
+
+    set_value_type_checked(
+        output_type,
+        util::infer_convolution_output_shape(data_batch_shape,
+                                             filters_shape,
+                                             m_window_movement_strides,
+                                             m_window_dilation_strides,
+                                             m_padding_below,
+                                             m_padding_above,
+                                             Strides(m_window_movement_strides.size(), 1),
+                                             0, /* batch_axis_data,              */
+                                             1, /* input_channel_axis_data,      */
+                                             1, /* input_channel_axis_filters,   */
+                                             0, /* output_channel_axis_filters,  */
+                                             0, /* batch_axis_result,            */
+                                             1, /* output_channel_axis_result,   */
+                                             "In quantized convolution: "));
+}
+
+shared_ptr<Node> op::QuantizedConvolution::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() == 2)
+    {
+        return make_shared<QuantizedConvolution>(new_args.at(0),
+                                                 new_args.at(1),
+                                                 m_window_movement_strides,
+                                                 m_window_dilation_strides,
+                                                 m_padding_below,
+                                                 m_padding_above,
+                                                 m_data_scale,
+                                                 m_data_zero_point,
+                                                 m_filter_scale,
+                                                 m_filter_zero_point,
+                                                 get_element_type(),
+                                                 m_output_scale,
+                                                 m_output_zero_point,
+                                                 m_with_relu);
+    }
+    if (new_args.size() == 3)
+    {
+        return make_shared<QuantizedConvolution>(new_args.at(0),
+                                                 new_args.at(1),
+                                                 new_args.at(2),
+                                                 m_window_movement_strides,
+                                                 m_window_dilation_strides,
+                                                 m_padding_below,
+                                                 m_padding_above,
+                                                 m_data_scale,
+                                                 m_data_zero_point,
+                                                 m_filter_scale,
+                                                 m_filter_zero_point,
+                                                 get_element_type(),
+                                                 m_output_scale,
+                                                 m_output_zero_point,
+                                                 m_with_relu);
+    }
+    throw ngraph_error("Incorrect number of new arguments");
+}
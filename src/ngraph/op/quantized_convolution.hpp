@@ -0,0 +1,130 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Batched convolution over affine-quantized data and filters, with optional bias
+        ///        and Relu, producing an affine-quantized result.
+        ///
+        /// The convolution is accumulated in 32-bit integers over `(data - data_zero_point)` and
+        /// `(filters - filter_zero_point)`. The optional bias is an i32 tensor `[C_OUT]` in the
+        /// accumulator domain, i.e. with scale `data_scale * filter_scale` and zero point 0. The
+        /// accumulator is rescaled by `data_scale * filter_scale / output_scale`, optionally
+        /// clamped at real zero, rounded to nearest and saturated to the output type.
+        class QuantizedConvolution : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \brief Constructs a quantized convolution operation.
+            ///
+            /// \param data_batch The node producing the i8 or u8 data batch tensor.<br>
+            /// `[N, C_IN, D1, ... Df]`
+            /// \param filters The node producing the i8 or u8 filters tensor.<br>
+            /// `[C_OUT, C_IN, F1, ... Ff]`
+            /// \param window_movement_strides The window movement strides.<br>
+            /// `[f]`
+            /// \param window_dilation_strides The window dilation strides.<br>
+            /// `[f]`
+            /// \param padding_below The padding-below sizes.<br>
+            /// `[f]`
+            /// \param padding_above The padding-above sizes.<br>
+            /// `[f]`
+            /// \param data_scale The quantization scale of the data batch.
+            /// \param data_zero_point The quantization zero point of the data batch.
+            /// \param filter_scale The quantization scale of the filters.
+            /// \param filter_zero_point The quantization zero point of the filters.
+            /// \param output_type The element type of the result, i8 or u8.
+            /// \param output_scale The quantization scale of the result.
+            /// \param output_zero_point The quantization zero point of the result.
+            /// \param with_relu Whether negative results are clamped to real zero.
+            ///
+            /// Output `[N, C_OUT, R1, ... Rf]`
+            ///
+            QuantizedConvolution(const std::shared_ptr<Node>& data_batch,
+                                 const std::shared_ptr<Node>& filters,
+                                 const Strides& window_movement_strides,
+                                 const Strides& window_dilation_strides,
+                                 const CoordinateDiff& padding_below,
+                                 const CoordinateDiff& padding_above,
+                                 float data_scale,
+                                 int32_t data_zero_point,
+                                 float filter_scale,
+                                 int32_t filter_zero_point,
+                                 const element::Type& output_type,
+                                 float output_scale,
+                                 int32_t output_zero_point,
+                                 bool with_relu = false);
+
+            /// \brief Constructs a quantized convolution operation with an i32 bias `[C_OUT]`.
+            QuantizedConvolution(const std::shared_ptr<Node>& data_batch,
+                                 const std::shared_ptr<Node>& filters,
+                                 const std::shared_ptr<Node>& bias,
+                                 const Strides& window_movement_strides,
+                                 const Strides& window_dilation_strides,
+                                 const CoordinateDiff& padding_below,
+                                 const CoordinateDiff& padding_above,
+                                 float data_scale,
+                                 int32_t data_zero_point,
+                                 float filter_scale,
+                                 int32_t filter_zero_point,
+                                 const element::Type& output_type,
+                                 float output_scale,
+                                 int32_t output_zero_point,
+                                 bool with_relu = false);
+
+            const Strides& get_window_movement_strides() const { return m_window_movement_strides; }
+            const Strides& get_window_dilation_strides() const { return m_window_dilation_strides; }
+            const CoordinateDiff& get_padding_below() const { return m_padding_below; }
+            const CoordinateDiff& get_padding_above() const { return m_padding_above; }
+            float get_data_scale() const { return m_data_scale; }
+            int32_t get_data_zero_point() const { return m_data_zero_point; }
+            float get_filter_scale() const { return m_filter_scale; }
+            int32_t get_filter_zero_point() const { return m_filter_zero_point; }
+            float get_output_scale() const { return m_output_scale; }
+            int32_t get_output_zero_point() const { return m_output_zero_point; }
+            bool with_bias() const { return get_input_size() == 3; }
+            bool with_relu() const { return m_with_relu; }
+            std::shared_ptr<Node> get_data_batch() { return get_argument(0); }
+            std::shared_ptr<Node> get_filters() { return get_argument(1); }
+            std::shared_ptr<Node> get_bias() { return get_argument(2); }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            void validate_and_infer_output(const element::Type& output_type);
+
+            Strides m_window_movement_strides;
+            Strides m_window_dilation_strides;
+            CoordinateDiff m_padding_below;
+            CoordinateDiff m_padding_above;
+            float m_data_scale;
+            int32_t m_data_zero_point;
+            float m_filter_scale;
+            int32_t m_filter_zero_point;
+            float m_output_scale;
+            int32_t m_output_zero_point;
+            bool m_with_relu;
+        };
+    }
+}
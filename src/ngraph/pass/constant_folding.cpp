@@ -15,20 +15,52 @@
 *******************************************************************************/
 
 #include <stdint.h>
+#include <typeindex>
+#include <unordered_map>
 
 #include "constant_folding.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/op/add.hpp"
 #include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/pad.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/op/reverse.hpp"
+#include "ngraph/op/slice.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
+#include "ngraph/runtime/reference/add.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/concat.hpp"
+#include "ngraph/runtime/reference/convert.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/multiply.hpp"
+#include "ngraph/runtime/reference/pad.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/reverse.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+#define TI(x) std::type_index(typeid(x))
+
+static bool fits_folded_size(const shared_ptr<Node>& node, size_t max_folded_size)
+{
+    size_t size = shape_size(node->get_shape()) * node->get_element_type().size();
+    if (size > max_folded_size)
+    {
+        NGRAPH_DEBUG << "Not folding " << node->get_name() << ", its " << size
+                     << " byte output is over the limit";
+        return false;
+    }
+    return true;
+}
+
 template <class T>
 shared_ptr<op::Constant> make_constant_reshape(shared_ptr<op::Constant> constant,
                                                shared_ptr<op::Reshape> reshape)
@@ -51,10 +83,16 @@ void ngraph::pass::ConstantFolding::construct_constant_reshape()
         element::f32, Shape{2, 4}, pattern::has_class<op::Constant>());
     auto reshape = make_shared<op::Reshape>(constant_label, AxisVector{0, 1}, Shape{2, 4, 1});
 
-    auto constant_reshape_callback = [constant_label](pattern::Matcher& m) {
+    size_t max_folded_size = m_max_folded_size;
+    auto constant_reshape_callback = [constant_label, max_folded_size](pattern::Matcher& m) {
         NGRAPH_DEBUG << "In callback for constant_reshape_callback against node = "
                      << m.get_match_root()->get_name();
 
+        if (!fits_folded_size(m.get_match_root(), max_folded_size))
+        {
+            return false;
+        }
+
         auto pattern_map = m.get_pattern_map();
 
         auto constant_match = dynamic_pointer_cast<op::Constant>(pattern_map[constant_label]);
@@ -116,10 +154,16 @@ void ngraph::pass::ConstantFolding::construct_constant_broadcast()
 
     auto broadcast = make_shared<op::Broadcast>(constant_label, Shape{2, 4}, AxisSet{1});
 
-    auto constant_broadcast_callback = [constant_label](pattern::Matcher& m) {
+    size_t max_folded_size = m_max_folded_size;
+    auto constant_broadcast_callback = [constant_label, max_folded_size](pattern::Matcher& m) {
         NGRAPH_DEBUG << "In callback for constant_broadcast_callback against node = "
                      << m.get_match_root()->get_name();
 
+        if (!fits_folded_size(m.get_match_root(), max_folded_size))
+        {
+            return false;
+        }
+
         auto pattern_map = m.get_pattern_map();
 
         auto constant_match = dynamic_pointer_cast<op::Constant>(pattern_map[constant_label]);
@@ -157,3 +201,261 @@ void ngraph::pass::ConstantFolding::construct_constant_broadcast()
     auto broadcast_matcher = make_shared<pattern::Matcher>(broadcast, constant_broadcast_callback);
     this->add_matcher(broadcast_matcher);
 }
+
+// Data of argument index of node, which must be a Constant
+template <class T>
+static const T* get_constant_data(const shared_ptr<Node>& node, size_t index)
+{
+    auto constant = static_pointer_cast<op::Constant>(node->get_argument(index));
+    return static_cast<const T*>(constant->get_data_ptr());
+}
+
+template <class T>
+static shared_ptr<op::Constant> fold_constant_dot(shared_ptr<Node> node)
+{
+    auto dot = static_pointer_cast<op::Dot>(node);
+    vector<T> out_vec(shape_size(dot->get_shape()));
+
+    runtime::reference::dot<T>(get_constant_data<T>(dot, 0),
+                               get_constant_data<T>(dot, 1),
+                               out_vec.data(),
+                               dot->get_argument(0)->get_shape(),
+                               dot->get_argument(1)->get_shape(),
+                               dot->get_shape(),
+                               dot->get_reduction_axes_count());
+
+    return make_shared<op::Constant>(dot->get_element_type(), dot->get_shape(), out_vec);
+}
+
+template <class T>
+static shared_ptr<op::Constant> fold_constant_add(shared_ptr<Node> node)
+{
+    vector<T> out_vec(shape_size(node->get_shape()));
+
+    runtime::reference::add<T>(get_constant_data<T>(node, 0),
+                               get_constant_data<T>(node, 1),
+                               out_vec.data(),
+                               out_vec.size());
+
+    return make_shared<op::Constant>(node->get_element_type(), node->get_shape(), out_vec);
+}
+
+template <class T>
+static shared_ptr<op::Constant> fold_constant_multiply(shared_ptr<Node> node)
+{
+    vector<T> out_vec(shape_size(node->get_shape()));
+
+    runtime::reference::multiply<T>(get_constant_data<T>(node, 0),
+                                    get_constant_data<T>(node, 1),
+                                    out_vec.data(),
+                                    out_vec.size());
+
+    return make_shared<op::Constant>(node->get_element_type(), node->get_shape(), out_vec);
+}
+
+template <class TI, class TO>
+static shared_ptr<op::Constant> make_constant_convert(shared_ptr<Node> node)
+{
+    vector<TO> out_vec(shape_size(node->get_shape()));
+
+    runtime::reference::convert<TI, TO>(
+        get_constant_data<TI>(node, 0), out_vec.data(), out_vec.size());
+
+    return make_shared<op::Constant>(node->get_element_type(), node->get_shape(), out_vec);
+}
+
+template <class TI>
+static shared_ptr<op::Constant> fold_constant_convert(shared_ptr<Node> node)
+{
+    auto type = node->get_element_type();
+    if (type == element::i8)
+    {
+        return make_constant_convert<TI, int8_t>(node);
+    }
+    else if (type == element::i32)
+    {
+        return make_constant_convert<TI, int32_t>(node);
+    }
+    else if (type == element::i64)
+    {
+        return make_constant_convert<TI, int64_t>(node);
+    }
+    else if (type == element::f32)
+    {
+        return make_constant_convert<TI, float>(node);
+    }
+    else if (type == element::f64)
+    {
+        return make_constant_convert<TI, double>(node);
+    }
+    return nullptr;
+}
+
+template <class T>
+static shared_ptr<op::Constant> fold_constant_reverse(shared_ptr<Node> node)
+{
+    auto reverse = static_pointer_cast<op::Reverse>(node);
+    vector<T> out_vec(shape_size(reverse->get_shape()));
+
+    runtime::reference::reverse<T>(get_constant_data<T>(reverse, 0),
+                                   out_vec.data(),
+                                   reverse->get_argument(0)->get_shape(),
+                                   reverse->get_shape(),
+                                   reverse->get_reversed_axes());
+
+    return make_shared<op::Constant>(reverse->get_element_type(), reverse->get_shape(), out_vec);
+}
+
+template <class T>
+static shared_ptr<op::Constant> fold_constant_pad(shared_ptr<Node> node)
+{
+    auto pad = static_pointer_cast<op::Pad>(node);
+    vector<T> out_vec(shape_size(pad->get_shape()));
+
+    runtime::reference::pad<T>(get_constant_data<T>(pad, 0),
+                               get_constant_data<T>(pad, 1),
+                               out_vec.data(),
+                               pad->get_argument(0)->get_shape(),
+                               pad->get_shape(),
+                               pad->get_padding_below(),
+                               pad->get_padding_above(),
+                               pad->get_padding_interior());
+
+    return make_shared<op::Constant>(pad->get_element_type(), pad->get_shape(), out_vec);
+}
+
+template <class T>
+static shared_ptr<op::Constant> fold_constant_slice(shared_ptr<Node> node)
+{
+    auto slice = static_pointer_cast<op::Slice>(node);
+    vector<T> out_vec(shape_size(slice->get_shape()));
+
+    runtime::reference::slice<T>(get_constant_data<T>(slice, 0),
+                                 out_vec.data(),
+                                 slice->get_argument(0)->get_shape(),
+                                 slice->get_lower_bounds(),
+                                 slice->get_upper_bounds(),
+                                 slice->get_strides(),
+                                 slice->get_shape());
+
+    return make_shared<op::Constant>(slice->get_element_type(), slice->get_shape(), out_vec);
+}
+
+template <class T>
+static shared_ptr<op::Constant> fold_constant_concat(shared_ptr<Node> node)
+{
+    auto concat = static_pointer_cast<op::Concat>(node);
+    vector<T> out_vec(shape_size(concat->get_shape()));
+
+    vector<const T*> args;
+    vector<Shape> in_shapes;
+    for (size_t i = 0; i < concat->get_input_size(); i++)
+    {
+        args.push_back(get_constant_data<T>(concat, i));
+        in_shapes.push_back(concat->get_argument(i)->get_shape());
+    }
+    runtime::reference::concat<T>(
+        args, out_vec.data(), in_shapes, concat->get_shape(), concat->get_concatenation_axis());
+
+    return make_shared<op::Constant>(concat->get_element_type(), concat->get_shape(), out_vec);
+}
+
+typedef shared_ptr<op::Constant> (*ConstantFolder)(shared_ptr<Node>);
+
+// A folding function instantiated for each element type that is folded
+struct TypedConstantFolder
+{
+    ConstantFolder i8;
+    ConstantFolder i32;
+    ConstantFolder i64;
+    ConstantFolder f32;
+    ConstantFolder f64;
+};
+
+#define TYPED_CONSTANT_FOLDER(f)                                                                   \
+    TypedConstantFolder { f<int8_t>, f<int32_t>, f<int64_t>, f<float>, f<double> }
+
+// Folding function for node, selected by the element type of its first argument, or nullptr
+// if node can't be folded
+static ConstantFolder get_constant_folder(const Node& node)
+{
+    static const unordered_map<type_index, TypedConstantFolder> folders{
+        {TI(op::Add), TYPED_CONSTANT_FOLDER(fold_constant_add)},
+        {TI(op::Concat), TYPED_CONSTANT_FOLDER(fold_constant_concat)},
+        {TI(op::Convert), TYPED_CONSTANT_FOLDER(fold_constant_convert)},
+        {TI(op::Dot), TYPED_CONSTANT_FOLDER(fold_constant_dot)},
+        {TI(op::Multiply), TYPED_CONSTANT_FOLDER(fold_constant_multiply)},
+        {TI(op::Pad), TYPED_CONSTANT_FOLDER(fold_constant_pad)},
+        {TI(op::Reverse), TYPED_CONSTANT_FOLDER(fold_constant_reverse)},
+        {TI(op::Slice), TYPED_CONSTANT_FOLDER(fold_constant_slice)}};
+
+    auto it = folders.find(TI(node));
+    if (it == folders.end() || node.get_input_size() == 0)
+    {
+        return nullptr;
+    }
+
+    auto type = node.get_input_element_type(0);
+    if (type == element::i8)
+    {
+        return it->second.i8;
+    }
+    else if (type == element::i32)
+    {
+        return it->second.i32;
+    }
+    else if (type == element::i64)
+    {
+        return it->second.i64;
+    }
+    else if (type == element::f32)
+    {
+        return it->second.f32;
+    }
+    else if (type == element::f64)
+    {
+        return it->second.f64;
+    }
+    return nullptr;
+}
+
+void ngraph::pass::ConstantFolding::construct_constant_ops()
+{
+    auto foldable = [](shared_ptr<Node> node) {
+        if (!get_constant_folder(*node))
+        {
+            return false;
+        }
+        for (auto arg : node->get_arguments())
+        {
+            if (!dynamic_pointer_cast<op::Constant>(arg))
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto op = make_shared<pattern::op::Label>(element::f32, Shape{}, foldable);
+
+    size_t max_folded_size = m_max_folded_size;
+    auto constant_ops_callback = [max_folded_size](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for constant_ops_callback against node = "
+                     << m.get_match_root()->get_name();
+
+        if (!fits_folded_size(m.get_match_root(), max_folded_size))
+        {
+            return false;
+        }
+
+        auto constant = get_constant_folder(*m.get_match_root())(m.get_match_root());
+        if (!constant)
+        {
+            return false;
+        }
+        replace_node(m.get_match_root(), constant);
+        return true;
+    };
+
+    auto constant_ops_matcher = make_shared<pattern::Matcher>(op, constant_ops_callback);
+    this->add_matcher(constant_ops_matcher);
+}
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include "ngraph/pass/graph_rewrite.hpp"
 
 namespace ngraph
@@ -29,14 +31,25 @@ namespace ngraph
 class ngraph::pass::ConstantFolding : public ngraph::pass::GraphRewrite
 {
 public:
-    ConstantFolding()
+    /// \param max_folded_size Ops whose output would take more than this many bytes are not
+    ///        folded, so that constants which are cheap to compute, such as broadcasts of
+    ///        scalars, are not materialized in full
+    ConstantFolding(size_t max_folded_size = std::numeric_limits<size_t>::max())
         : GraphRewrite()
+        , m_max_folded_size(max_folded_size)
     {
         construct_constant_reshape();
         construct_constant_broadcast();
+        construct_constant_ops();
     }
 
 private:
     void construct_constant_reshape();
     void construct_constant_broadcast();
+    /// Folds Dot, Add, Multiply, Convert, Reverse, Pad, Slice and Concat ops whose arguments
+    /// are all constants. Ops are visited in topological order, so a whole constant subgraph
+    /// folds in one run.
+    void construct_constant_ops();
+
+    size_t m_max_folded_size;
 };
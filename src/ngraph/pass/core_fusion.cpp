@@ -15,6 +15,8 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <unordered_set>
 
 #include "ngraph/pass/core_fusion.hpp"
@@ -26,6 +28,7 @@
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/max_pool.hpp"
@@ -33,6 +36,8 @@
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/parameter.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/sigmoid.hpp"
@@ -618,3 +623,178 @@ void pass::CoreFusion::construct_optimized_strided_conv()
     auto m = make_shared<pattern::Matcher>(eltwise_conv, callback);
     this->add_matcher(m);
 }
+
+// Returns the per-channel bias of `bcast` if it broadcasts a rank-1 constant along the channel
+// axis of an NC* tensor, else nullptr
+static std::shared_ptr<op::Constant> get_channel_bias(std::shared_ptr<Node> bcast_node)
+{
+    auto bcast = std::dynamic_pointer_cast<op::Broadcast>(bcast_node);
+    if (!bcast)
+    {
+        return nullptr;
+    }
+    auto bias = std::dynamic_pointer_cast<op::Constant>(bcast->get_argument(0));
+    if (!bias || bias->get_shape().size() != 1)
+    {
+        return nullptr;
+    }
+    AxisSet channel_bcast_axes{0};
+    for (size_t i = 2; i < bcast->get_shape().size(); i++)
+    {
+        channel_bcast_axes.insert(i);
+    }
+    if (bcast->get_broadcast_axes() != channel_bcast_axes)
+    {
+        return nullptr;
+    }
+    return bias;
+}
+
+void pass::CoreFusion::construct_quantized_convolution_folding()
+{
+    // Quantize(Relu?(Conv(Dequantize(x), Dequantize(w)) + bias?)) -> QuantizedConvolution
+    //
+    // The scales and zero points are read off the Dequantize and Quantize ops, so no
+    // calibration pass is needed. A constant bias is requantized to int32 in the accumulator
+    // domain (scale = data_scale * filter_scale).
+    auto input = std::make_shared<pattern::op::Label>(element::f32, Shape{1, 1, 1, 1});
+    auto quantize = std::make_shared<op::Quantize>(input, element::u8, 1.0f, 0);
+
+    ngraph::pattern::graph_rewrite_callback callback = [input](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for quantized convolution folding against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        auto quantize_m = std::static_pointer_cast<op::Quantize>(m.get_match_root());
+        auto node = pattern_map[input];
+
+        bool with_relu = false;
+        if (std::dynamic_pointer_cast<op::Relu>(node))
+        {
+            if (node->get_users().size() > 1)
+            {
+                return false;
+            }
+            with_relu = true;
+            node = node->get_argument(0);
+        }
+
+        std::shared_ptr<op::Constant> bias;
+        if (std::dynamic_pointer_cast<op::Add>(node))
+        {
+            if (node->get_users().size() > 1)
+            {
+                return false;
+            }
+            auto arg0 = node->get_argument(0);
+            auto arg1 = node->get_argument(1);
+            if ((bias = get_channel_bias(arg1)))
+            {
+                node = arg0;
+            }
+            else if ((bias = get_channel_bias(arg0)))
+            {
+                node = arg1;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        auto conv = std::dynamic_pointer_cast<op::Convolution>(node);
+        if (!conv || conv->get_users().size() > 1)
+        {
+            return false;
+        }
+        for (size_t s : conv->get_data_dilation_strides())
+        {
+            if (s != 1)
+            {
+                return false;
+            }
+        }
+
+        auto data_dq = std::dynamic_pointer_cast<op::Dequantize>(conv->get_argument(0));
+        auto filters_dq = std::dynamic_pointer_cast<op::Dequantize>(conv->get_argument(1));
+        if (!data_dq || !filters_dq)
+        {
+            return false;
+        }
+
+        auto data_scale = data_dq->get_scale();
+        auto filter_scale = filters_dq->get_scale();
+
+        std::shared_ptr<op::QuantizedConvolution> qconv;
+        if (bias)
+        {
+            if (bias->get_shape()[0] != conv->get_shape()[1])
+            {
+                return false;
+            }
+            std::vector<double> bias_values;
+            if (bias->get_element_type() == element::f32)
+            {
+                auto values = bias->get_vector<float>();
+                bias_values.assign(values.begin(), values.end());
+            }
+            else if (bias->get_element_type() == element::f64)
+            {
+                bias_values = bias->get_vector<double>();
+            }
+            else
+            {
+                return false;
+            }
+
+            double accumulator_scale = static_cast<double>(data_scale) * filter_scale;
+            std::vector<int32_t> qbias_values;
+            for (double b : bias_values)
+            {
+                double q = std::nearbyint(b / accumulator_scale);
+                q = std::max(q, static_cast<double>(std::numeric_limits<int32_t>::lowest()));
+                q = std::min(q, static_cast<double>(std::numeric_limits<int32_t>::max()));
+                qbias_values.push_back(static_cast<int32_t>(q));
+            }
+            auto qbias = op::Constant::create(element::i32, bias->get_shape(), qbias_values);
+
+            qconv = std::make_shared<op::QuantizedConvolution>(data_dq->get_argument(0),
+                                                               filters_dq->get_argument(0),
+                                                               qbias,
+                                                               conv->get_window_movement_strides(),
+                                                               conv->get_window_dilation_strides(),
+                                                               conv->get_padding_below(),
+                                                               conv->get_padding_above(),
+                                                               data_scale,
+                                                               data_dq->get_zero_point(),
+                                                               filter_scale,
+                                                               filters_dq->get_zero_point(),
+                                                               quantize_m->get_element_type(),
+                                                               quantize_m->get_scale(),
+                                                               quantize_m->get_zero_point(),
+                                                               with_relu);
+        }
+        else
+        {
+            qconv = std::make_shared<op::QuantizedConvolution>(data_dq->get_argument(0),
+                                                               filters_dq->get_argument(0),
+                                                               conv->get_window_movement_strides(),
+                                                               conv->get_window_dilation_strides(),
+                                                               conv->get_padding_below(),
+                                                               conv->get_padding_above(),
+                                                               data_scale,
+                                                               data_dq->get_zero_point(),
+                                                               filter_scale,
+                                                               filters_dq->get_zero_point(),
+                                                               quantize_m->get_element_type(),
+                                                               quantize_m->get_scale(),
+                                                               quantize_m->get_zero_point(),
+                                                               with_relu);
+        }
+        ngraph::replace_node(m.get_match_root(), qconv);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(quantize, callback);
+    this->add_matcher(m);
+}
@@ -15,22 +15,100 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <deque>
 #include <iostream>
+#include <typeindex>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "graph_rewrite.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/result.hpp"
 #include "ngraph/pattern/matcher.hpp"
 
+namespace
+{
+    // Longest path from a pattern's root to one of its leaves
+    size_t get_pattern_depth(const std::shared_ptr<ngraph::Node>& node,
+                             std::unordered_map<ngraph::Node*, size_t>& depths)
+    {
+        auto it = depths.find(node.get());
+        if (it != depths.end())
+        {
+            return it->second;
+        }
+        size_t depth = 0;
+        for (auto arg : node->get_arguments())
+        {
+            depth = std::max(depth, get_pattern_depth(arg, depths) + 1);
+        }
+        depths[node.get()] = depth;
+        return depth;
+    }
+
+    // Buckets matchers by the type of their pattern's root. Matchers rooted at a pattern op
+    // can match any node and are added to every bucket. Registration order is kept within a
+    // bucket so the first matcher that rewrites a node still wins.
+    template <typename MatcherType>
+    class MatcherIndex
+    {
+    public:
+        MatcherIndex(const std::vector<std::shared_ptr<MatcherType>>& matchers)
+            : m_max_depth(0)
+        {
+            std::unordered_map<ngraph::Node*, size_t> depths;
+            for (auto matcher : matchers)
+            {
+                auto root = matcher->get_pattern();
+                m_max_depth = std::max(m_max_depth, get_pattern_depth(root, depths));
+                if (std::dynamic_pointer_cast<ngraph::pattern::op::Pattern>(root))
+                {
+                    m_wildcard_matchers.push_back(matcher);
+                    for (auto& bucket : m_matchers)
+                    {
+                        bucket.second.push_back(matcher);
+                    }
+                }
+                else
+                {
+                    const ngraph::Node& root_node = *root;
+                    std::type_index type(typeid(root_node));
+                    auto it = m_matchers.find(type);
+                    if (it == m_matchers.end())
+                    {
+                        it = m_matchers.insert({type, m_wildcard_matchers}).first;
+                    }
+                    it->second.push_back(matcher);
+                }
+            }
+        }
+
+        const std::vector<std::shared_ptr<MatcherType>>&
+            get_matchers(const ngraph::Node& node) const
+        {
+            auto it = m_matchers.find(std::type_index(typeid(node)));
+            return it == m_matchers.end() ? m_wildcard_matchers : it->second;
+        }
+
+        /// A rewrite can only change the match of nodes at most this many users above it
+        size_t get_max_depth() const { return m_max_depth; }
+    private:
+        size_t m_max_depth;
+        std::unordered_map<std::type_index, std::vector<std::shared_ptr<MatcherType>>> m_matchers;
+        std::vector<std::shared_ptr<MatcherType>> m_wildcard_matchers;
+    };
+}
+
 bool ngraph::pass::GraphRewrite::run_matchers_on_nodes_list(
     const std::list<std::shared_ptr<ngraph::Node>>& nodes,
     const std::vector<std::shared_ptr<pattern::Matcher>>& matchers,
     std::shared_ptr<ngraph::Function> f)
 {
+    MatcherIndex<pattern::Matcher> index(matchers);
     bool rewritten = false;
     for (auto node : nodes)
     {
-        for (auto matcher : matchers)
+        for (auto matcher : index.get_matchers(*node))
         {
             NGRAPH_DEBUG << "Running matcher " << matcher->get_name() << "("
                          << matcher->get_pattern()->get_name() << ") on " << node->get_name();
@@ -56,28 +134,118 @@ bool ngraph::pass::GraphRewrite::run_on_function(std::shared_ptr<ngraph::Functio
 
 bool ngraph::pass::RecurrentGraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
+    MatcherIndex<pattern::RecurrentMatcher> index(m_matchers);
     bool changed = false;
-    size_t i = 0;
-    do
+    size_t rewrites = 0;
+
+    std::list<std::shared_ptr<Node>> ops = f->get_ops();
+    std::unordered_set<Node*> live(ops.size());
+    for (auto node : ops)
     {
-        for (auto node : f->get_ops())
+        live.insert(node.get());
+    }
+    std::deque<std::shared_ptr<Node>> worklist(ops.begin(), ops.end());
+
+    while (!worklist.empty() && rewrites < m_num_iters)
+    {
+        auto node = worklist.front();
+        worklist.pop_front();
+        if (live.count(node.get()) == 0)
         {
-            for (auto matcher : m_matchers)
+            // removed from the graph by an earlier rewrite
+            continue;
+        }
+
+        for (auto matcher : index.get_matchers(*node))
+        {
+            NGRAPH_DEBUG << "Running matcher " << matcher << " on " << node->get_name();
+            if (!matcher->match(node))
+            {
+                continue;
+            }
+            NGRAPH_DEBUG << "Matcher " << matcher << " matched " << node->get_name();
+            NodeVector root_users = node->get_users();
+            if (matcher->process_match())
             {
-                NGRAPH_DEBUG << "Running matcher " << matcher << " on " << node->get_name();
-                if (matcher->match(node))
+                changed = true;
+                rewrites++;
+
+                // The nodes the rewrite introduced hang off the users of the old root. Walk
+                // from there through nodes that were not in the graph before to find them.
+                NodeVector frontier;
+                std::vector<std::shared_ptr<Node>> stack;
+                for (auto user : root_users)
                 {
-                    NGRAPH_DEBUG << "Matcher " << matcher << " matched " << node->get_name();
-                    if (matcher->process_match())
+                    for (auto arg : user->get_arguments())
                     {
-                        changed = true;
-                        goto next_fusion;
+                        stack.push_back(arg);
                     }
                 }
+                while (!stack.empty())
+                {
+                    auto n = stack.back();
+                    stack.pop_back();
+                    if (live.insert(n.get()).second)
+                    {
+                        frontier.push_back(n);
+                        for (auto arg : n->get_arguments())
+                        {
+                            stack.push_back(arg);
+                        }
+                        for (auto user : n->get_users())
+                        {
+                            stack.push_back(user);
+                        }
+                    }
+                }
+
+                // Drop the replaced region: a node is gone once none of its users is live
+                stack.push_back(node);
+                while (!stack.empty())
+                {
+                    auto n = stack.back();
+                    stack.pop_back();
+                    if (live.count(n.get()) == 0 || std::dynamic_pointer_cast<op::Result>(n))
+                    {
+                        continue;
+                    }
+                    auto users = n->get_users();
+                    if (std::none_of(users.begin(), users.end(), [&](std::shared_ptr<Node> u) {
+                            return live.count(u.get()) != 0;
+                        }))
+                    {
+                        live.erase(n.get());
+                        for (auto arg : n->get_arguments())
+                        {
+                            stack.push_back(arg);
+                        }
+                    }
+                }
+
+                // Only patterns that reach the new nodes, the old root or its users can have a
+                // new match, so revisit those and their users up to the deepest pattern
+                frontier.push_back(node);
+                frontier.insert(frontier.end(), root_users.begin(), root_users.end());
+
+                std::unordered_set<Node*> queued;
+                for (size_t depth = 0; depth <= index.get_max_depth() && !frontier.empty();
+                     depth++)
+                {
+                    NodeVector next;
+                    for (auto n : frontier)
+                    {
+                        if (live.count(n.get()) != 0 && queued.insert(n.get()).second)
+                        {
+                            worklist.push_back(n);
+                            NodeVector users = n->get_users();
+                            next.insert(next.end(), users.begin(), users.end());
+                        }
+                    }
+                    frontier.swap(next);
+                }
+                break;
             }
         }
-    next_fusion:
-        i++;
-    } while (changed && i < m_num_iters);
+    }
     return changed;
 }
@@ -43,6 +43,8 @@ namespace ngraph
 /// the existing ops by providing a callback to \p Matcher object
 /// Patterns can be added by using \sa add_matcher
 /// Callbacks should use \sa replace_node to transform matched sub graphs
+/// Matchers are indexed by the op type at the root of their pattern, so a node is only offered
+/// to matchers whose root has its type or is a pattern op such as \sa pattern::op::Label
 
 class ngraph::pass::GraphRewrite : public FunctionPass
 {
@@ -78,6 +80,8 @@ public:
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
 private:
+    /// At most \p m_num_iters rewrites are applied. After each one only the nodes the rewrite
+    /// created and the users of the rewritten region are matched again.
     size_t m_num_iters;
     std::vector<std::shared_ptr<pattern::RecurrentMatcher>> m_matchers;
 };
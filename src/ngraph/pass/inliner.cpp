@@ -18,6 +18,7 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/function_call.hpp"
+#include "ngraph/op/get_output_element.hpp"
 
 std::vector<std::shared_ptr<ngraph::op::FunctionCall>>
     ngraph::pass::InlineSmallCalls::create_inlining_plan(std::shared_ptr<ngraph::Function> f,
@@ -58,10 +59,18 @@ bool ngraph::pass::Inliner::inline_function_call(std::shared_ptr<ngraph::Node> i
     //map args to parms
     auto callee = callsite->get_functions().at(0);
 
+    // Callees with several results are only used through GetOutputElement
     if (callee->get_results().size() > 1)
     {
-        return false; //relax in the next iteration (can't just use replace_node)
+        for (auto user : callsite->get_users())
+        {
+            if (!std::dynamic_pointer_cast<ngraph::op::GetOutputElement>(user))
+            {
+                return false;
+            }
+        }
     }
+
     ngraph::NodeMap nm;
     for (size_t i = 0; i < callee->get_parameters().size(); i++)
     {
@@ -70,8 +79,26 @@ bool ngraph::pass::Inliner::inline_function_call(std::shared_ptr<ngraph::Node> i
 
     ngraph::clone_function(*callee, nm);
 
-    auto callee_graph = nm.get(callee->get_result());
-    caller->replace_node(callsite, callee_graph);
+    // Users are connected to what the callee's results compute rather than to copies of the
+    // Result ops, so an inlined call adds no copies
+    auto callee_output = [&](size_t i) {
+        return nm.get(callee->get_results().at(i)->get_argument(0));
+    };
+    if (callee->get_results().size() == 1)
+    {
+        caller->replace_node(callsite, callee_output(0));
+    }
+    else
+    {
+        for (auto user : callsite->get_users())
+        {
+            auto goe = std::static_pointer_cast<ngraph::op::GetOutputElement>(user);
+            if (!goe->get_users().empty())
+            {
+                caller->replace_node(goe, callee_output(goe->get_n()));
+            }
+        }
+    }
     NGRAPH_DEBUG << "Inlined " << callee->get_name() << " of " << callsite->get_name() << " into "
                  << caller->get_name();
     return true;
@@ -14,7 +14,9 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <exception>
+#include <iostream>
 #include <sstream>
 
 #include "ngraph/log.hpp"
@@ -27,67 +29,250 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment,
+                                 bool disable_memory_sharing,
+                                 strategy layout_strategy)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_strategy(layout_strategy)
 {
 }
 
 bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
 {
-    MemoryManager mm(m_alignment, m_disable_memory_sharing);
-    for (shared_ptr<Node> node : function->get_ordered_ops())
+    list<shared_ptr<Node>> ops = function->get_ordered_ops();
+    unordered_map<descriptor::Tensor*, size_t> offsets;
+    size_t pool_size = layout(ops, m_alignment, m_disable_memory_sharing, m_strategy, offsets);
+    for (auto& tensor_offset : offsets)
     {
-        std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
-        std::set<const descriptor::Tensor*> reused_inputs;
+        tensor_offset.first->set_pool_offset(tensor_offset.second);
+    }
+    function->set_temporary_pool_size(pool_size);
+
+    static const bool report_enabled = getenv("NGRAPH_MEMORY_LAYOUT_REPORT") != nullptr;
+    if (report_enabled)
+    {
+        cout << "MemoryLayout " << function->get_name() << " pool size " << pool_size;
+        for (auto& strategy_size : get_pool_size_report(function, m_alignment))
+        {
+            cout << ", " << strategy_size.first << " " << strategy_size.second;
+        }
+        cout << "\n";
+    }
+
+    return false;
+}
+
+map<string, size_t> pass::MemoryLayout::get_pool_size_report(shared_ptr<ngraph::Function> function,
+                                                             size_t alignment)
+{
+    list<shared_ptr<Node>> ops = function->get_ordered_ops();
+    unordered_map<descriptor::Tensor*, size_t> offsets;
+    map<string, size_t> report;
+    report["no_reuse"] = layout(ops, alignment, true, strategy::FIRST_FIT, offsets);
+    report["first_fit"] = layout(ops, alignment, false, strategy::FIRST_FIT, offsets);
+    report["best_fit"] = layout(ops, alignment, false, strategy::BEST_FIT, offsets);
+    report["greedy_by_size"] = layout(ops, alignment, false, strategy::GREEDY_BY_SIZE, offsets);
+    return report;
+}
+
+pass::MemoryLayout::strategy pass::MemoryLayout::get_strategy(const string& name)
+{
+    string lower = to_lower(name);
+    if (lower == "first_fit")
+    {
+        return strategy::FIRST_FIT;
+    }
+    else if (lower == "best_fit")
+    {
+        return strategy::BEST_FIT;
+    }
+    else if (lower == "greedy_by_size")
+    {
+        return strategy::GREEDY_BY_SIZE;
+    }
+    throw ngraph_error("Unknown memory layout strategy '" + name + "'");
+}
 
-        if (auto op = std::dynamic_pointer_cast<op::Op>(node))
+// Output tensors of node which can reuse the memory of one of its input tensors
+static map<descriptor::Tensor*, descriptor::Tensor*> get_in_place_outputs(const shared_ptr<Node>& node)
+{
+    map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
+    if (auto op = dynamic_pointer_cast<op::Op>(node))
+    {
+        if (auto op_annotations = op->get_op_annotations())
         {
-            if (auto op_annotations = op->get_op_annotations())
+            for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
             {
-                for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
+                auto output = &node->get_outputs().at(oi_pair.output).get_tensor();
+                auto input = &node->get_inputs().at(oi_pair.input).get_tensor();
+                auto input_node = node->get_inputs().at(oi_pair.input).get_output().get_node();
+
+                //an input tensor can be reused if this is the last use or
+                //an op isn't destructive (i.e. Reshape(DimShuffle))
+                if ((node->liveness_free_list.count(input) != 0 &&
+                     node->liveness_new_list.count(output) != 0) ||
+                    (!oi_pair.destructive && !input_node->is_parameter() &&
+                     !input_node->is_constant()))
                 {
-                    auto output = &node->get_outputs().at(oi_pair.output).get_tensor();
-                    auto input = &node->get_inputs().at(oi_pair.input).get_tensor();
-                    auto input_node = node->get_inputs().at(oi_pair.input).get_output().get_node();
-
-                    //an input tensor can be reused if this is the last use or
-                    //an op isn't destructive (i.e. Reshape(DimShuffle))
-                    if ((node->liveness_free_list.count(input) != 0 &&
-                         node->liveness_new_list.count(output) != 0) ||
-                        (!oi_pair.destructive && !input_node->is_parameter() &&
-                         !input_node->is_constant()))
-                    {
-                        in_place_outputs.insert({output, input});
-                        reused_inputs.insert(input);
-                    }
+                    in_place_outputs.insert({output, input});
                 }
             }
         }
+    }
+    return in_place_outputs;
+}
+
+size_t pass::MemoryLayout::layout(const list<shared_ptr<Node>>& ops,
+                                  size_t alignment,
+                                  bool disable_memory_sharing,
+                                  strategy layout_strategy,
+                                  unordered_map<descriptor::Tensor*, size_t>& offsets)
+{
+    offsets.clear();
+    if (!disable_memory_sharing && layout_strategy == strategy::GREEDY_BY_SIZE)
+    {
+        return greedy_by_size_layout(ops, alignment, offsets);
+    }
+
+    MemoryManager mm(alignment,
+                     disable_memory_sharing
+                         ? MemoryManager::allocation_scheme::NO_REUSE
+                         : layout_strategy == strategy::BEST_FIT
+                               ? MemoryManager::allocation_scheme::BEST_FIT
+                               : MemoryManager::allocation_scheme::FIRST_FIT);
+    for (shared_ptr<Node> node : ops)
+    {
+        map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs = get_in_place_outputs(node);
+        set<const descriptor::Tensor*> reused_inputs;
+        for (auto& output_input : in_place_outputs)
+        {
+            reused_inputs.insert(output_input.second);
+        }
 
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
             size_t offset = in_place_outputs.count(tensor)
-                                ? in_place_outputs.at(tensor)->get_pool_offset()
+                                ? offsets.at(in_place_outputs.at(tensor))
                                 : mm.allocate(tensor->size());
-
-            tensor->set_pool_offset(offset);
+            offsets[tensor] = offset;
         }
 
-        if (!m_disable_memory_sharing)
+        if (!disable_memory_sharing)
         {
-            for (const descriptor::Tensor* tensor : node->liveness_free_list)
+            for (descriptor::Tensor* tensor : node->liveness_free_list)
             {
                 if (reused_inputs.count(tensor) == 0)
                 {
-                    mm.free(tensor->get_pool_offset());
+                    mm.free(offsets.at(tensor));
                 }
             }
         }
     }
-    function->set_temporary_pool_size(mm.max_allocated());
+    return mm.max_allocated();
+}
+
+size_t pass::MemoryLayout::greedy_by_size_layout(const list<shared_ptr<Node>>& ops,
+                                                 size_t alignment,
+                                                 unordered_map<descriptor::Tensor*, size_t>& offsets)
+{
+    // A buffer holds a tensor and any tensors computed in place in it. It is live from the
+    // first op that defines one of them to the last op that uses one of them.
+    struct Buffer
+    {
+        size_t size;
+        size_t first;
+        size_t last;
+        size_t offset;
+    };
+    vector<Buffer> buffers;
+    unordered_map<descriptor::Tensor*, size_t> tensor_buffer;
+    unordered_map<descriptor::Tensor*, size_t> tensor_last;
+
+    size_t op_index = 0;
+    for (shared_ptr<Node> node : ops)
+    {
+        map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs = get_in_place_outputs(node);
+        for (descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            size_t size = MemoryManager::align(tensor->size(), alignment);
+            auto it = in_place_outputs.find(tensor);
+            if (it != in_place_outputs.end())
+            {
+                Buffer& buffer = buffers.at(tensor_buffer.at(it->second));
+                buffer.size = max(buffer.size, size);
+                tensor_buffer[tensor] = tensor_buffer.at(it->second);
+            }
+            else
+            {
+                tensor_buffer[tensor] = buffers.size();
+                buffers.push_back({size, op_index, 0, 0});
+            }
+        }
+        for (descriptor::Tensor* tensor : node->liveness_free_list)
+        {
+            tensor_last[tensor] = op_index;
+        }
+        op_index++;
+    }
 
-    return false;
+    // Tensors that are never freed live until the end of the function
+    for (auto& t : tensor_buffer)
+    {
+        auto it = tensor_last.find(t.first);
+        size_t last = it == tensor_last.end() ? ops.size() : it->second;
+        buffers[t.second].last = max(buffers[t.second].last, last);
+    }
+
+    vector<size_t> order(buffers.size());
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        order[i] = i;
+    }
+    stable_sort(order.begin(), order.end(), [&buffers](size_t a, size_t b) {
+        return buffers[a].size > buffers[b].size;
+    });
+
+    size_t pool_size = 0;
+    vector<size_t> placed;
+    for (size_t index : order)
+    {
+        Buffer& buffer = buffers[index];
+
+        // Placed buffers whose lifetime overlaps this one, by offset
+        vector<const Buffer*> conflicts;
+        for (size_t other_index : placed)
+        {
+            const Buffer& other = buffers[other_index];
+            if (other.first <= buffer.last && buffer.first <= other.last)
+            {
+                conflicts.push_back(&other);
+            }
+        }
+        sort(conflicts.begin(), conflicts.end(), [](const Buffer* a, const Buffer* b) {
+            return a->offset < b->offset;
+        });
+
+        // Lowest gap large enough for the buffer
+        size_t offset = 0;
+        for (const Buffer* other : conflicts)
+        {
+            if (other->offset >= offset + buffer.size)
+            {
+                break;
+            }
+            offset = max(offset, other->offset + other->size);
+        }
+        buffer.offset = offset;
+        pool_size = max(pool_size, offset + buffer.size);
+        placed.push_back(index);
+    }
+
+    for (auto& t : tensor_buffer)
+    {
+        offsets[t.first] = buffers[t.second].offset;
+    }
+    return pool_size;
 }
 
 pass::MemoryManager::node::node(size_t size, block_state state)
@@ -97,12 +282,22 @@ pass::MemoryManager::node::node(size_t size, block_state state)
 }
 
 pass::MemoryManager::MemoryManager(size_t alignment, bool disable_memory_reuse)
-    : m_alignment{alignment}
-    , m_scheme{disable_memory_reuse ? allocation_scheme::NO_REUSE : allocation_scheme::FIRST_FIT}
+    : MemoryManager(alignment,
+                    disable_memory_reuse ? allocation_scheme::NO_REUSE
+                                         : allocation_scheme::FIRST_FIT)
+{
+}
+
+pass::MemoryManager::MemoryManager(size_t alignment, allocation_scheme scheme)
+    : m_free_by_class(numeric_limits<size_t>::digits)
+    , m_alignment{alignment}
+    , m_scheme{scheme}
     , m_max_allocated{0}
 {
     // assert(m_base_offset % m_alignment == 0);
     m_node_list.emplace_back(numeric_limits<size_t>::max(), block_state::FREE);
+    m_blocks.insert({0, m_node_list.begin()});
+    insert_free(0, numeric_limits<size_t>::max());
 }
 
 size_t pass::MemoryManager::allocate(size_t size)
@@ -124,122 +319,143 @@ size_t pass::MemoryManager::no_reuse_allocator(size_t size)
     return offset;
 }
 
-size_t pass::MemoryManager::best_fit(size_t size)
+size_t pass::MemoryManager::size_class(size_t size)
 {
-    size = align(size, m_alignment);
-    size_t offset = 0;
-    size_t min_delta = numeric_limits<size_t>::max();
-    auto best_fit = m_node_list.end();
-    size_t best_offset = offset;
-    for (auto it = m_node_list.begin(); it != m_node_list.end(); ++it)
+    size_t rc = 0;
+    while (size >>= 1)
     {
-        if (it->m_state == block_state::FREE && it->m_size >= size)
-        {
-            size_t delta = it->m_size - size;
-            if (delta < min_delta)
-            {
-                min_delta = delta;
-                best_fit = it;
-                best_offset = offset;
-            }
-        }
-        offset += it->m_size;
+        rc++;
     }
+    return rc;
+}
+
+void pass::MemoryManager::insert_free(size_t offset, size_t size)
+{
+    m_free_by_size.insert({size, offset});
+    m_free_by_class[size_class(size)].insert(offset);
+}
+
+void pass::MemoryManager::erase_free(size_t offset, size_t size)
+{
+    m_free_by_size.erase({size, offset});
+    m_free_by_class[size_class(size)].erase(offset);
+}
 
-    if (best_fit == m_node_list.end())
+// Allocates size bytes at the start of the free block at offset, splitting off the remainder
+size_t pass::MemoryManager::allocate_block(size_t offset, size_t size)
+{
+    auto it = m_blocks.at(offset);
+    erase_free(offset, it->m_size);
+    if (it->m_size > size)
     {
-        throw bad_alloc();
+        auto allocated = m_node_list.insert(it, node{size, block_state::ALLOCATED});
+        it->m_size -= size;
+        m_blocks[offset] = allocated;
+        m_blocks.insert({offset + size, it});
+        insert_free(offset + size, it->m_size);
     }
-
-    if (min_delta == 0)
+    else
     {
         // exact fit
-        best_fit->m_state = block_state::ALLOCATED;
+        it->m_state = block_state::ALLOCATED;
     }
-    else
+    m_max_allocated = max(m_max_allocated, offset + size);
+
+    return offset;
+}
+
+size_t pass::MemoryManager::best_fit(size_t size)
+{
+    size = align(size, m_alignment);
+
+    // Smallest free block that fits, lowest offset first among equal sizes
+    auto best_fit = m_free_by_size.lower_bound({size, 0});
+    if (best_fit == m_free_by_size.end())
     {
-        m_node_list.insert(best_fit, node{size, block_state::ALLOCATED});
-        best_fit->m_size -= size;
+        throw bad_alloc();
     }
-    m_max_allocated = max(m_max_allocated, best_offset + size);
 
-    return best_offset;
+    return allocate_block(best_fit->second, size);
 }
 
 size_t pass::MemoryManager::first_fit(size_t size)
 {
     size = align(size, m_alignment);
-    size_t offset = 0;
+
+    // Every block in a larger size class fits so only the lowest offset of each matters.
+    // Blocks in the size class of size itself may be too small and are scanned by offset.
+    size_t size_cls = size_class(size);
+    size_t offset = numeric_limits<size_t>::max();
     bool found = false;
-    for (auto it = m_node_list.begin(); it != m_node_list.end(); ++it)
+    for (size_t cls = size_cls + 1; cls < m_free_by_class.size(); ++cls)
     {
-        if (it->m_state == block_state::FREE && it->m_size >= size)
+        if (!m_free_by_class[cls].empty() && *m_free_by_class[cls].begin() < offset)
         {
-            if (it->m_size > size)
-            {
-                m_node_list.insert(it, node{size, block_state::ALLOCATED});
-                it->m_size -= size;
-            }
-            else
-            {
-                // exact fit
-                it->m_state = block_state::ALLOCATED;
-            }
-
+            offset = *m_free_by_class[cls].begin();
+            found = true;
+        }
+    }
+    for (size_t candidate : m_free_by_class[size_cls])
+    {
+        if (found && candidate >= offset)
+        {
+            break;
+        }
+        if (m_blocks.at(candidate)->m_size >= size)
+        {
+            offset = candidate;
             found = true;
             break;
         }
-        offset += it->m_size;
     }
     if (!found)
     {
         throw bad_alloc();
     }
-    m_max_allocated = max(m_max_allocated, offset + size);
 
-    return offset;
+    return allocate_block(offset, size);
 }
 
 void pass::MemoryManager::free(size_t offset)
 {
-    size_t search_offset = 0;
-    bool found = false;
-    for (auto it = m_node_list.begin(); it != m_node_list.end(); ++it)
+    auto block = m_blocks.find(offset);
+    if (block == m_blocks.end())
     {
-        if (offset == search_offset)
+        throw runtime_error("bad free");
+    }
+    list<node>::iterator it = block->second;
+    if (it->is_free())
+    {
+        erase_free(offset, it->m_size);
+    }
+
+    if (it != m_node_list.begin())
+    {
+        // node has predecessor
+        list<node>::iterator it_prev = prev(it);
+        if (it_prev->is_free())
         {
-            list<node>::iterator it_next = next(it);
-            if (it == m_node_list.begin())
-            {
-                // free the first node in the list
-                it->m_state = block_state::FREE;
-            }
-            else
-            {
-                // node has predecessor
-                list<node>::iterator it_prev = prev(it);
-                if (it_prev->m_state == block_state::FREE)
-                {
-                    it->m_size += it_prev->m_size;
-                    m_node_list.erase(it_prev);
-                }
-            }
-            if (it_next != m_node_list.end() && it_next->m_state == block_state::FREE)
-            {
-                // join this node with next
-                it->m_size += it_next->m_size;
-                m_node_list.erase(it_next);
-            }
-            it->m_state = block_state::FREE;
-            found = true;
-            break;
+            size_t prev_offset = offset - it_prev->m_size;
+            erase_free(prev_offset, it_prev->m_size);
+            m_blocks.erase(offset);
+            m_blocks[prev_offset] = it;
+            offset = prev_offset;
+            it->m_size += it_prev->m_size;
+            m_node_list.erase(it_prev);
         }
-        search_offset += it->m_size;
     }
-    if (!found)
+    list<node>::iterator it_next = next(it);
+    if (it_next != m_node_list.end() && it_next->is_free())
     {
-        throw runtime_error("bad free");
+        // join this node with next
+        size_t next_offset = offset + it->m_size;
+        erase_free(next_offset, it_next->m_size);
+        m_blocks.erase(next_offset);
+        it->m_size += it_next->m_size;
+        m_node_list.erase(it_next);
     }
+    it->m_state = block_state::FREE;
+    insert_free(offset, it->m_size);
 }
 
 void pass::MemoryManager::dump(ostream& out)
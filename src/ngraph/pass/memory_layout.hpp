@@ -18,7 +18,11 @@
 
 #include <limits>
 #include <list>
+#include <map>
+#include <set>
 #include <sstream>
+#include <unordered_map>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -35,12 +39,43 @@ namespace ngraph
 class ngraph::pass::MemoryLayout : public FunctionPass
 {
 public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
+    /// FIRST_FIT and BEST_FIT place tensors one op at a time as they become live.
+    /// GREEDY_BY_SIZE uses the liveness of the whole function and places the largest tensors
+    /// first, at the lowest offset not used by any tensor live at the same time.
+    enum class strategy
+    {
+        FIRST_FIT,
+        BEST_FIT,
+        GREEDY_BY_SIZE
+    };
+
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 strategy layout_strategy = strategy::FIRST_FIT);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
+    /// \brief Temporary pool size needed by \p function under each strategy and without
+    ///        sharing, keyed by strategy name. The function must have liveness information.
+    ///        Setting NGRAPH_MEMORY_LAYOUT_REPORT prints this report when the pass runs.
+    static std::map<std::string, size_t>
+        get_pool_size_report(std::shared_ptr<ngraph::Function> function, size_t alignment);
+
+    /// \brief Parses a strategy name such as "best_fit", as used in environment variables
+    static strategy get_strategy(const std::string& name);
+
 private:
+    static size_t layout(const std::list<std::shared_ptr<Node>>& ops,
+                         size_t alignment,
+                         bool disable_memory_sharing,
+                         strategy layout_strategy,
+                         std::unordered_map<descriptor::Tensor*, size_t>& offsets);
+    static size_t greedy_by_size_layout(const std::list<std::shared_ptr<Node>>& ops,
+                                        size_t alignment,
+                                        std::unordered_map<descriptor::Tensor*, size_t>& offsets);
+
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    strategy m_strategy;
 };
 
 class ngraph::pass::MemoryManager
@@ -70,6 +105,10 @@ public:
     };
 
     MemoryManager(size_t alignment = 1, bool disable_reuse = false);
+    MemoryManager(size_t alignment, allocation_scheme scheme);
+    // The block indices hold iterators into m_node_list
+    MemoryManager(const MemoryManager&) = delete;
+    MemoryManager& operator=(const MemoryManager&) = delete;
     // memory_manager& alignment(size_t a);
 
     size_t allocate(size_t size);
@@ -89,8 +128,18 @@ private:
     size_t first_fit(size_t size);
     size_t best_fit(size_t size);
     size_t no_reuse_allocator(size_t size);
+    size_t allocate_block(size_t offset, size_t size);
+    void insert_free(size_t offset, size_t size);
+    void erase_free(size_t offset, size_t size);
+    static size_t size_class(size_t size);
 
     std::list<node> m_node_list;
+    // Every block in m_node_list keyed by offset
+    std::map<size_t, std::list<node>::iterator> m_blocks;
+    // Free blocks ordered by (size, offset) for best fit
+    std::set<std::pair<size_t, size_t>> m_free_by_size;
+    // Offsets of free blocks segregated by the power of two of their size for first fit
+    std::vector<std::set<size_t>> m_free_by_class;
     size_t m_alignment;
     allocation_scheme m_scheme;
     size_t m_max_allocated;
@@ -24,10 +24,12 @@ using namespace ngraph;
 runtime::AlignedBuffer::AlignedBuffer()
     : m_allocated_buffer(nullptr)
     , m_aligned_buffer(nullptr)
+    , m_byte_size(0)
 {
 }
 
 runtime::AlignedBuffer::AlignedBuffer(size_t byte_size, size_t alignment)
+    : AlignedBuffer()
 {
     initialize(byte_size, alignment);
 }
@@ -118,6 +118,17 @@ public:
     virtual std::vector<PerformanceCounter>
         get_performance_data(std::shared_ptr<Function> func) const;
 
+    /// @brief Start capturing a timeline of the ops run by compiled functions. Ops are recorded
+    ///     with their start and end time and the thread that ran them, and the timeline is
+    ///     written to file_name in the Chrome trace event format while the capture runs.
+    /// @param file_name The file to write the timeline to.
+    /// @param sample_interval Only every sample_interval'th call is recorded.
+    virtual void start_trace_capture(const std::string& file_name, size_t sample_interval = 1)
+    {
+    }
+    /// @brief Stop a capture started by `start_trace_capture` and finish writing its file.
+    virtual void stop_trace_capture() {}
+
 protected:
     void validate_call(std::shared_ptr<const Function> func,
                        const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
@@ -0,0 +1,218 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/batching_executor.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::BatchingExecutor::BatchingExecutor(const shared_ptr<Backend>& backend,
+                                            const shared_ptr<Function>& function,
+                                            size_t max_batch_size,
+                                            chrono::microseconds timeout)
+    : m_backend(backend)
+    , m_function(function)
+    , m_bucketed_function(backend, function, 0)
+    , m_max_batch_size(max_batch_size)
+    , m_timeout(timeout)
+    , m_queued_rows(0)
+    , m_stop(false)
+{
+    if (m_max_batch_size == 0)
+    {
+        throw ngraph_error("Maximum batch size must be at least 1");
+    }
+    m_thread = thread(&BatchingExecutor::run, this);
+}
+
+runtime::BatchingExecutor::~BatchingExecutor()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_request_queued.notify_one();
+    m_thread.join();
+}
+
+future<void> runtime::BatchingExecutor::submit(const vector<shared_ptr<TensorView>>& outputs,
+                                               const vector<shared_ptr<TensorView>>& inputs)
+{
+    const auto& parameters = m_function->get_parameters();
+    if (inputs.empty() || inputs.size() != parameters.size() ||
+        outputs.size() != m_function->get_output_size())
+    {
+        throw ngraph_error("Request to batching executor of " + m_function->get_name() +
+                           " has the wrong number of inputs or outputs");
+    }
+    size_t batch_size = inputs[0]->get_shape().at(0);
+    auto check_shape = [&](Shape expected, const TensorView& tv) {
+        expected.at(0) = batch_size;
+        if (tv.get_shape() != expected)
+        {
+            throw ngraph_error("Tensor shape " + vector_to_string(tv.get_shape()) +
+                               " does not match " + vector_to_string(expected) +
+                               " in request to batching executor of " +
+                               m_function->get_name());
+        }
+    };
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        check_shape(parameters[i]->get_shape(), *inputs[i]);
+    }
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        check_shape(m_function->get_output_shape(i), *outputs[i]);
+    }
+
+    Request request;
+    request.outputs = outputs;
+    request.inputs = inputs;
+    request.batch_size = batch_size;
+    request.arrival = chrono::steady_clock::now();
+    future<void> result = request.promise.get_future();
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_queued_rows += batch_size;
+        m_requests.push_back(move(request));
+    }
+    m_request_queued.notify_one();
+    return result;
+}
+
+void runtime::BatchingExecutor::run()
+{
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+        while (!m_stop && m_requests.empty())
+        {
+            m_request_queued.wait(lock);
+        }
+        if (m_requests.empty())
+        {
+            return;
+        }
+
+        // Give other requests until the oldest one times out to fill the batch
+        auto deadline = m_requests.front().arrival + m_timeout;
+        while (!m_stop && m_queued_rows < m_max_batch_size)
+        {
+            if (m_request_queued.wait_until(lock, deadline) == cv_status::timeout)
+            {
+                break;
+            }
+        }
+
+        vector<Request> requests;
+        size_t batch_size = 0;
+        while (!m_requests.empty() &&
+               (requests.empty() ||
+                batch_size + m_requests.front().batch_size <= m_max_batch_size))
+        {
+            batch_size += m_requests.front().batch_size;
+            requests.push_back(move(m_requests.front()));
+            m_requests.pop_front();
+        }
+        m_queued_rows -= batch_size;
+
+        lock.unlock();
+        execute(requests, batch_size);
+        lock.lock();
+    }
+}
+
+void runtime::BatchingExecutor::execute(vector<Request>& requests, size_t batch_size)
+{
+    try
+    {
+        Batch& batch = get_batch(BucketedFunction::get_bucket_size(batch_size));
+
+        // Requests are stacked along axis 0, so each one is a contiguous range of every
+        // batch tensor
+        for (size_t i = 0; i < batch.inputs.size(); i++)
+        {
+            size_t offset = 0;
+            for (const Request& request : requests)
+            {
+                const TensorView& input = *request.inputs[i];
+                size_t size =
+                    input.get_element_count() * input.get_tensor().get_element_type().size();
+                m_staging.resize(max(m_staging.size(), size));
+                input.read(m_staging.data(), 0, size);
+                batch.inputs[i]->write(m_staging.data(), offset, size);
+                offset += size;
+            }
+        }
+
+        m_bucketed_function.call(batch.outputs, batch.inputs);
+
+        for (size_t i = 0; i < batch.outputs.size(); i++)
+        {
+            size_t offset = 0;
+            for (const Request& request : requests)
+            {
+                TensorView& output = *request.outputs[i];
+                size_t size =
+                    output.get_element_count() * output.get_tensor().get_element_type().size();
+                m_staging.resize(max(m_staging.size(), size));
+                batch.outputs[i]->read(m_staging.data(), offset, size);
+                output.write(m_staging.data(), 0, size);
+                offset += size;
+            }
+        }
+    }
+    catch (...)
+    {
+        for (Request& request : requests)
+        {
+            request.promise.set_exception(current_exception());
+        }
+        return;
+    }
+
+    for (Request& request : requests)
+    {
+        request.promise.set_value();
+    }
+}
+
+runtime::BatchingExecutor::Batch& runtime::BatchingExecutor::get_batch(size_t bucket_size)
+{
+    auto it = m_batches.find(bucket_size);
+    if (it != m_batches.end())
+    {
+        return it->second;
+    }
+
+    Batch batch;
+    for (auto param : m_function->get_parameters())
+    {
+        Shape shape = param->get_shape();
+        shape[0] = bucket_size;
+        batch.inputs.push_back(m_backend->create_tensor(param->get_element_type(), shape));
+    }
+    for (size_t i = 0; i < m_function->get_output_size(); i++)
+    {
+        Shape shape = m_function->get_output_shape(i);
+        shape[0] = bucket_size;
+        batch.outputs.push_back(
+            m_backend->create_tensor(m_function->get_output_element_type(i), shape));
+    }
+    return m_batches[bucket_size] = batch;
+}
@@ -0,0 +1,114 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/bucketed_function.hpp"
+#include "ngraph/runtime/tensor_view.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class BatchingExecutor;
+    }
+}
+
+/// @brief Batches concurrent requests to one Function along axis 0.
+///
+/// Requests are queued until their rows add up to the maximum batch size or the oldest one
+/// has waited for the timeout. The queued requests are then copied into preallocated batch
+/// tensors, run in a single call, and their rows of the results copied back. Batches run
+/// through a BucketedFunction, so each power of two batch size is compiled once.
+class ngraph::runtime::BatchingExecutor
+{
+public:
+    /// @param backend The backend that compiles and runs the Function
+    /// @param function A Function whose parameters and results are batched along axis 0
+    /// @param max_batch_size Most rows run in one call. A single larger request runs alone.
+    /// @param timeout Longest time a request waits for others to batch with
+    BatchingExecutor(const std::shared_ptr<Backend>& backend,
+                     const std::shared_ptr<Function>& function,
+                     size_t max_batch_size,
+                     std::chrono::microseconds timeout);
+
+    /// @brief Runs the requests still queued and stops the batching thread
+    ~BatchingExecutor();
+
+    BatchingExecutor(const BatchingExecutor&) = delete;
+    BatchingExecutor& operator=(const BatchingExecutor&) = delete;
+
+    /// @brief Queues a request. The tensors must stay alive until the returned future is
+    ///     ready. Errors raised while running the batch are rethrown by the future.
+    /// @param outputs Result tensors, with as many rows as the inputs
+    /// @param inputs Parameter tensors, all with the same number of rows
+    std::future<void> submit(const std::vector<std::shared_ptr<TensorView>>& outputs,
+                             const std::vector<std::shared_ptr<TensorView>>& inputs);
+
+    size_t get_max_batch_size() const { return m_max_batch_size; }
+    /// @brief The BucketedFunction batches run through, e.g. to compile buckets ahead of time
+    BucketedFunction& get_bucketed_function() { return m_bucketed_function; }
+private:
+    struct Request
+    {
+        std::vector<std::shared_ptr<TensorView>> outputs;
+        std::vector<std::shared_ptr<TensorView>> inputs;
+        size_t batch_size;
+        std::chrono::steady_clock::time_point arrival;
+        std::promise<void> promise;
+    };
+
+    // Batch tensors for one bucket size
+    struct Batch
+    {
+        std::vector<std::shared_ptr<TensorView>> inputs;
+        std::vector<std::shared_ptr<TensorView>> outputs;
+    };
+
+    void run();
+    void execute(std::vector<Request>& requests, size_t batch_size);
+    Batch& get_batch(size_t bucket_size);
+
+    std::shared_ptr<Backend> m_backend;
+    std::shared_ptr<Function> m_function;
+    BucketedFunction m_bucketed_function;
+    size_t m_max_batch_size;
+    std::chrono::microseconds m_timeout;
+
+    std::mutex m_mutex;
+    std::condition_variable m_request_queued;
+    std::deque<Request> m_requests;
+    size_t m_queued_rows;
+    bool m_stop;
+
+    // Only used by the batching thread
+    std::map<size_t, Batch> m_batches;
+    std::vector<char> m_staging;
+
+    std::thread m_thread;
+};
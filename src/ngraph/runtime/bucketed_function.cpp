@@ -0,0 +1,228 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/bucketed_function.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/parameter.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::BucketedFunction::BucketedFunction(const shared_ptr<Backend>& backend,
+                                            const shared_ptr<Function>& function,
+                                            size_t batch_axis)
+    : m_backend(backend)
+    , m_function(function)
+    , m_batch_axis(batch_axis)
+{
+    for (auto param : m_function->get_parameters())
+    {
+        if (param->get_shape().size() <= m_batch_axis)
+        {
+            throw ngraph_error("Parameter " + param->get_name() + " has no batch axis");
+        }
+    }
+}
+
+size_t runtime::BucketedFunction::get_bucket_size(size_t batch_size)
+{
+    size_t bucket_size = 1;
+    while (bucket_size < batch_size)
+    {
+        bucket_size <<= 1;
+    }
+    return bucket_size;
+}
+
+vector<size_t> runtime::BucketedFunction::get_compiled_bucket_sizes() const
+{
+    lock_guard<mutex> lock(m_buckets_mutex);
+    return vector<size_t>(m_compiled_bucket_sizes.begin(), m_compiled_bucket_sizes.end());
+}
+
+void runtime::BucketedFunction::compile(size_t batch_size)
+{
+    get_bucket(get_bucket_size(batch_size));
+}
+
+// Copies the first batch_size entries along batch_axis from src to dst, whose shapes may only
+// differ in that axis
+static void copy_batch(const runtime::TensorView& src,
+                       runtime::TensorView& dst,
+                       size_t batch_axis,
+                       size_t batch_size)
+{
+    const Shape& src_shape = src.get_shape();
+    const Shape& dst_shape = dst.get_shape();
+    size_t outer_count = 1;
+    for (size_t i = 0; i < batch_axis; i++)
+    {
+        outer_count *= src_shape[i];
+    }
+    size_t entry_size = src.get_tensor().get_element_type().size();
+    for (size_t i = batch_axis + 1; i < src_shape.size(); i++)
+    {
+        entry_size *= src_shape[i];
+    }
+
+    vector<char> buffer(batch_size * entry_size);
+    for (size_t i = 0; i < outer_count; i++)
+    {
+        src.read(buffer.data(), i * src_shape[batch_axis] * entry_size, buffer.size());
+        dst.write(buffer.data(), i * dst_shape[batch_axis] * entry_size, buffer.size());
+    }
+}
+
+void runtime::BucketedFunction::call(const vector<shared_ptr<TensorView>>& outputs,
+                                     const vector<shared_ptr<TensorView>>& inputs)
+{
+    const auto& parameters = m_function->get_parameters();
+    if (inputs.size() != parameters.size() || outputs.size() != m_function->get_output_size())
+    {
+        throw ngraph_error("Call to bucketed function " + m_function->get_name() +
+                           " has the wrong number of inputs or outputs");
+    }
+    if (inputs.empty())
+    {
+        throw ngraph_error("Bucketed function " + m_function->get_name() + " has no inputs");
+    }
+
+    size_t batch_size = inputs[0]->get_shape().at(m_batch_axis);
+    auto check_shape = [&](const Shape& expected, const TensorView& tv) {
+        Shape shape = expected;
+        shape.at(m_batch_axis) = batch_size;
+        if (tv.get_shape() != shape)
+        {
+            throw ngraph_error("Tensor shape " + vector_to_string(tv.get_shape()) +
+                               " does not match " + vector_to_string(shape) +
+                               " in call to bucketed function " + m_function->get_name());
+        }
+    };
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        check_shape(parameters[i]->get_shape(), *inputs[i]);
+    }
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        check_shape(m_function->get_output_shape(i), *outputs[i]);
+    }
+
+    size_t bucket_size = get_bucket_size(batch_size);
+    auto bucket = get_bucket(bucket_size);
+    if (batch_size == bucket_size)
+    {
+        m_backend->call(bucket->function, outputs, inputs);
+        return;
+    }
+
+    lock_guard<mutex> lock(bucket->mutex);
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        copy_batch(*inputs[i], *bucket->inputs[i], m_batch_axis, batch_size);
+    }
+    m_backend->call(bucket->function, bucket->outputs, bucket->inputs);
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        copy_batch(*bucket->outputs[i], *outputs[i], m_batch_axis, batch_size);
+    }
+}
+
+shared_ptr<runtime::BucketedFunction::Bucket>
+    runtime::BucketedFunction::get_bucket(size_t bucket_size)
+{
+    shared_ptr<Bucket> bucket;
+    {
+        lock_guard<mutex> lock(m_buckets_mutex);
+        auto& entry = m_buckets[bucket_size];
+        if (!entry)
+        {
+            entry = make_shared<Bucket>();
+        }
+        bucket = entry;
+    }
+
+    // Compile outside of m_buckets_mutex so that calls to other buckets are not held up
+    lock_guard<mutex> lock(bucket->mutex);
+    if (!bucket->function)
+    {
+        auto function = specialize(bucket_size);
+        m_backend->compile(function);
+        for (auto param : function->get_parameters())
+        {
+            auto tv = m_backend->create_tensor(param->get_element_type(), param->get_shape());
+            vector<char> zeros(shape_size(param->get_shape()) * param->get_element_type().size());
+            tv->write(zeros.data(), 0, zeros.size());
+            bucket->inputs.push_back(tv);
+        }
+        for (size_t i = 0; i < function->get_output_size(); i++)
+        {
+            bucket->outputs.push_back(m_backend->create_tensor(function->get_output_element_type(i),
+                                                               function->get_output_shape(i)));
+        }
+        bucket->function = function;
+
+        lock_guard<mutex> buckets_lock(m_buckets_mutex);
+        m_compiled_bucket_sizes.insert(bucket_size);
+    }
+    return bucket;
+}
+
+shared_ptr<Function> runtime::BucketedFunction::specialize(size_t bucket_size) const
+{
+    NodeMap node_map;
+    for (auto param : m_function->get_parameters())
+    {
+        Shape shape = param->get_shape();
+        shape[m_batch_axis] = bucket_size;
+        node_map.add(param, make_shared<op::Parameter>(param->get_element_type(), shape));
+    }
+    // Constants of the specialisations refer to the data of the original constants
+    for (auto node : m_function->get_ops())
+    {
+        if (auto constant = dynamic_pointer_cast<op::Constant>(node))
+        {
+            node_map.add(constant,
+                         make_shared<op::Constant>(constant->get_element_type(),
+                                                   constant->get_shape(),
+                                                   constant->get_data_ptr(),
+                                                   constant));
+        }
+    }
+
+    shared_ptr<Function> function;
+    try
+    {
+        function = clone_function(*m_function, node_map);
+    }
+    catch (const ngraph_error& e)
+    {
+        throw ngraph_error("Function " + m_function->get_name() +
+                           " can't be specialised for batch size " + to_string(bucket_size) +
+                           ": " + e.what());
+    }
+    for (size_t i = 0; i < function->get_output_size(); i++)
+    {
+        const Shape& shape = function->get_output_shape(i);
+        if (shape.size() <= m_batch_axis || shape[m_batch_axis] != bucket_size)
+        {
+            throw ngraph_error("Result " + to_string(i) + " of function " +
+                               m_function->get_name() + " does not follow the batch size");
+        }
+    }
+    return function;
+}
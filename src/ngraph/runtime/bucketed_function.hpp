@@ -0,0 +1,91 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor_view.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class BucketedFunction;
+    }
+}
+
+/// @brief Runs one Function on inputs of any batch size.
+///
+/// Every parameter and result of the Function has a batch dimension at the same axis. A call
+/// with batch size n runs a specialisation of the Function for the smallest power of two
+/// that is at least n, padding the inputs up to it and returning the first n entries of each
+/// result. Specialisations are compiled on first use and share the data of the Function's
+/// constants. Each batch entry must be computed independently of the others, and the
+/// Function's ops must infer their shapes from their arguments.
+class ngraph::runtime::BucketedFunction
+{
+public:
+    /// @param backend The backend that compiles and runs the specialisations
+    /// @param function The Function to run. It is not modified.
+    /// @param batch_axis The axis of the batch dimension in every parameter and result
+    BucketedFunction(const std::shared_ptr<Backend>& backend,
+                     const std::shared_ptr<Function>& function,
+                     size_t batch_axis = 0);
+
+    /// @brief Runs the specialisation for the batch size of the inputs, compiling it first if
+    ///     needed. Safe to call from several threads.
+    /// @param outputs Result tensors, sized to the batch size of the inputs
+    /// @param inputs Parameter tensors, all with the same batch size
+    void call(const std::vector<std::shared_ptr<TensorView>>& outputs,
+              const std::vector<std::shared_ptr<TensorView>>& inputs);
+
+    /// @brief Compiles the specialisation that serves batch_size ahead of the first call
+    void compile(size_t batch_size);
+
+    /// @brief The batch size of the specialisation that serves batch_size
+    static size_t get_bucket_size(size_t batch_size);
+
+    /// @brief Batch sizes of the specialisations compiled so far
+    std::vector<size_t> get_compiled_bucket_sizes() const;
+
+private:
+    struct Bucket
+    {
+        std::shared_ptr<Function> function;
+        // Padded copies of the inputs and outputs, used when a call's batch size is smaller
+        // than the bucket's
+        std::vector<std::shared_ptr<TensorView>> inputs;
+        std::vector<std::shared_ptr<TensorView>> outputs;
+        std::mutex mutex;
+    };
+
+    std::shared_ptr<Bucket> get_bucket(size_t bucket_size);
+    std::shared_ptr<Function> specialize(size_t bucket_size) const;
+
+    std::shared_ptr<Backend> m_backend;
+    std::shared_ptr<Function> m_function;
+    size_t m_batch_axis;
+    mutable std::mutex m_buckets_mutex;
+    std::map<size_t, std::shared_ptr<Bucket>> m_buckets;
+    std::set<size_t> m_compiled_bucket_sizes;
+};
@@ -100,6 +100,8 @@ namespace ngraph
                     auto& deps = mkldnn_emitter->get_primitive_deps(batchnorm_index);
                     auto functor = [&, batchnorm_index, stacked_weights, weight_sizes](
                         CPURuntimeContext* ctx) {
+                        // The inputs copied here may be outputs of queued primitives
+                        cpu::mkldnn_utils::mkldnn_flush_primitives(ctx);
                         memcpy(stacked_weights.get(), arg0_tensor, weight_sizes[0]);
                         memcpy(
                             stacked_weights.get() + weight_sizes[0], arg1_tensor, weight_sizes[1]);
@@ -143,6 +145,8 @@ namespace ngraph
 
                     auto functor = [&, batchnorm_index, stacked_weights, weight_sizes](
                         CPURuntimeContext* ctx) {
+                        // The inputs copied here may be outputs of queued primitives
+                        cpu::mkldnn_utils::mkldnn_flush_primitives(ctx);
                         memcpy(stacked_weights.get(), arg0_tensor, weight_sizes[0]);
                         memcpy(
                             stacked_weights.get() + weight_sizes[0], arg1_tensor, weight_sizes[1]);
@@ -303,6 +307,8 @@ namespace ngraph
                                 stacked_weights,
                                 stacked_dweights,
                                 weight_sizes](CPURuntimeContext* ctx) {
+                    // The inputs copied here may be outputs of queued primitives
+                    cpu::mkldnn_utils::mkldnn_flush_primitives(ctx);
                     memcpy(stacked_weights.get(), arg0_tensor, weight_sizes[0]);
                     memcpy(stacked_weights.get() + weight_sizes[0], arg1_tensor, weight_sizes[1]);
 
@@ -315,6 +321,7 @@ namespace ngraph
                     cpu::mkldnn_utils::set_memory_ptr(ctx, deps[6], stacked_dweights.get());
 
                     cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, batchnorm_index);
+                    cpu::mkldnn_utils::mkldnn_flush_primitives(ctx);
 
                     memcpy(out1_tensor, stacked_dweights.get(), weight_sizes[0]);
                     memcpy(out2_tensor, stacked_dweights.get() + weight_sizes[0], weight_sizes[1]);
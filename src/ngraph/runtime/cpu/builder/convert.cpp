@@ -39,7 +39,49 @@ namespace ngraph
 
                 std::function<decltype(runtime::cpu::kernel::convert<float, int>)> kernel;
 
-                if (out[0].get_element_type() == element::boolean)
+                auto& in_et = args[0].get_element_type();
+                auto& out_et = out[0].get_element_type();
+                // SELECT_KERNEL does not cover the 16-bit floating point types, so pair them
+                // up explicitly before dispatching on the other side of the conversion
+                if (out_et == element::bf16)
+                {
+                    if (in_et == element::bf16)
+                    {
+                        kernel = runtime::cpu::kernel::convert_to_bf16<bfloat16>;
+                    }
+                    else if (in_et == element::f16)
+                    {
+                        kernel = runtime::cpu::kernel::convert_to_bf16<float16>;
+                    }
+                    else
+                    {
+                        SELECT_KERNEL(kernel, in_et, runtime::cpu::kernel::convert_to_bf16);
+                    }
+                }
+                else if (out_et == element::f16)
+                {
+                    if (in_et == element::bf16)
+                    {
+                        kernel = runtime::cpu::kernel::convert_to_f16<bfloat16>;
+                    }
+                    else if (in_et == element::f16)
+                    {
+                        kernel = runtime::cpu::kernel::convert_to_f16<float16>;
+                    }
+                    else
+                    {
+                        SELECT_KERNEL(kernel, in_et, runtime::cpu::kernel::convert_to_f16);
+                    }
+                }
+                else if (in_et == element::bf16)
+                {
+                    SELECT_KERNEL(kernel, out_et, runtime::cpu::kernel::convert_from_bf16);
+                }
+                else if (in_et == element::f16)
+                {
+                    SELECT_KERNEL(kernel, out_et, runtime::cpu::kernel::convert_from_f16);
+                }
+                else if (out[0].get_element_type() == element::boolean)
                 {
                     SELECT_KERNEL(
                         kernel, args[0].get_element_type(), runtime::cpu::kernel::convert_to_i8);
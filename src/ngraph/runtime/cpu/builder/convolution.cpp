@@ -15,8 +15,10 @@
 *******************************************************************************/
 
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/convolution.hpp"
+#include "ngraph/runtime/cpu/kernel/quantized_convolution.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
@@ -68,6 +70,15 @@ namespace ngraph
 
                     SELECT_KERNEL(
                         kernel, out[0].get_element_type(), runtime::cpu::kernel::convolution);
+                    // The reference kernel accumulates the 16-bit floating point types in f32
+                    if (out[0].get_element_type() == element::bf16)
+                    {
+                        kernel = runtime::cpu::kernel::convolution<bfloat16>;
+                    }
+                    else if (out[0].get_element_type() == element::f16)
+                    {
+                        kernel = runtime::cpu::kernel::convolution<float16>;
+                    }
 
                     auto window_movement_strides = convolution->get_window_movement_strides();
                     auto window_dilation_strides = convolution->get_window_dilation_strides();
@@ -508,6 +519,147 @@ namespace ngraph
                 }
             }
 
+            using QuantizedConvolutionKernel = std::function<decltype(
+                runtime::cpu::kernel::quantized_convolution<uint8_t, int8_t, int8_t>)>;
+
+            template <typename DataElementType, typename FilterElementType>
+            static QuantizedConvolutionKernel
+                select_quantized_convolution_kernel(const element::Type& out_et)
+            {
+                if (out_et == element::i8)
+                {
+                    return runtime::cpu::kernel::
+                        quantized_convolution<DataElementType, FilterElementType, int8_t>;
+                }
+                return runtime::cpu::kernel::
+                    quantized_convolution<DataElementType, FilterElementType, uint8_t>;
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::QuantizedConvolution)
+            {
+                auto qconv = static_cast<const ngraph::op::QuantizedConvolution*>(node);
+
+                auto& functors = external_function->get_functors();
+
+                auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
+                auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
+                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    auto conv_index = mkldnn_emitter->build_quantized_convolution(node);
+                    auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
+
+                    if (qconv->with_bias())
+                    {
+                        auto& arg2_tensor = external_function->get_tensor_data(args[2].get_name());
+                        auto functor = [&, conv_index](CPURuntimeContext* ctx) {
+                            cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
+                            cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg1_tensor);
+                            cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], arg2_tensor);
+                            cpu::mkldnn_utils::set_memory_ptr(ctx, deps[3], out_tensor);
+                            cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, conv_index);
+                        };
+                        functors.emplace_back(functor);
+                    }
+                    else
+                    {
+                        auto functor = [&, conv_index](CPURuntimeContext* ctx) {
+                            cpu::mkldnn_utils::set_memory_ptr(ctx, deps[0], arg0_tensor);
+                            cpu::mkldnn_utils::set_memory_ptr(ctx, deps[1], arg1_tensor);
+                            cpu::mkldnn_utils::set_memory_ptr(ctx, deps[2], out_tensor);
+                            cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, conv_index);
+                        };
+                        functors.emplace_back(functor);
+                    }
+                }
+                else
+                {
+                    QuantizedConvolutionKernel kernel;
+
+                    bool data_signed = args[0].get_element_type() == element::i8;
+                    bool filters_signed = args[1].get_element_type() == element::i8;
+                    auto& out_et = out[0].get_element_type();
+                    if (data_signed && filters_signed)
+                    {
+                        kernel = select_quantized_convolution_kernel<int8_t, int8_t>(out_et);
+                    }
+                    else if (data_signed)
+                    {
+                        kernel = select_quantized_convolution_kernel<int8_t, uint8_t>(out_et);
+                    }
+                    else if (filters_signed)
+                    {
+                        kernel = select_quantized_convolution_kernel<uint8_t, int8_t>(out_et);
+                    }
+                    else
+                    {
+                        kernel = select_quantized_convolution_kernel<uint8_t, uint8_t>(out_et);
+                    }
+
+                    auto arg0_shape = args[0].get_shape();
+                    auto arg1_shape = args[1].get_shape();
+                    auto result_shape = out[0].get_shape();
+                    auto window_movement_strides = qconv->get_window_movement_strides();
+                    auto window_dilation_strides = qconv->get_window_dilation_strides();
+                    auto padding_below = qconv->get_padding_below();
+                    auto padding_above = qconv->get_padding_above();
+                    auto data_scale = qconv->get_data_scale();
+                    auto data_zero_point = qconv->get_data_zero_point();
+                    auto filter_scale = qconv->get_filter_scale();
+                    auto filter_zero_point = qconv->get_filter_zero_point();
+                    auto output_scale = qconv->get_output_scale();
+                    auto output_zero_point = qconv->get_output_zero_point();
+                    auto with_relu = qconv->with_relu();
+
+                    // Without a bias the kernel gets a null bias pointer, bias_tensor just needs
+                    // to refer to some tensor slot that outlives the functor.
+                    auto with_bias = qconv->with_bias();
+                    auto& bias_tensor =
+                        external_function->get_tensor_data(args[with_bias ? 2 : 0].get_name());
+
+                    auto functor = [&,
+                                    kernel,
+                                    with_bias,
+                                    arg0_shape,
+                                    arg1_shape,
+                                    result_shape,
+                                    window_movement_strides,
+                                    window_dilation_strides,
+                                    padding_below,
+                                    padding_above,
+                                    data_scale,
+                                    data_zero_point,
+                                    filter_scale,
+                                    filter_zero_point,
+                                    output_scale,
+                                    output_zero_point,
+                                    with_relu](CPURuntimeContext* ctx) {
+                        kernel(arg0_tensor,
+                               arg1_tensor,
+                               with_bias ? bias_tensor : nullptr,
+                               out_tensor,
+                               arg0_shape,
+                               arg1_shape,
+                               result_shape,
+                               window_movement_strides,
+                               window_dilation_strides,
+                               padding_below,
+                               padding_above,
+                               data_scale,
+                               data_zero_point,
+                               filter_scale,
+                               filter_zero_point,
+                               output_scale,
+                               output_zero_point,
+                               with_relu);
+                    };
+                    functors.emplace_back(functor);
+                }
+            }
+
             REGISTER_OP_BUILDER(Convolution);
             REGISTER_OP_BUILDER(ConvolutionRelu);
             REGISTER_OP_BUILDER(ConvolutionBias);
@@ -516,6 +668,7 @@ namespace ngraph
             REGISTER_OP_BUILDER(ConvolutionBackpropFilters);
             REGISTER_OP_BUILDER(ConvolutionBiasBackpropFiltersBias);
             REGISTER_OP_BUILDER(GroupConvolution);
+            REGISTER_OP_BUILDER(QuantizedConvolution);
         }
     }
 }
@@ -17,9 +17,11 @@
 #include <algorithm>
 #include <cstring>
 
+#include "ngraph/op/constant.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/kernel/convert.hpp"
 #include "ngraph/runtime/cpu/kernel/dot.hpp"
 
 using namespace std;
@@ -65,6 +67,83 @@ namespace ngraph
                     return;
                 }
 
+                auto& element_type = out[0].get_element_type();
+                if (element_type == element::bf16 || element_type == element::f16)
+                {
+                    std::function<decltype(runtime::cpu::kernel::dot_widened<bfloat16>)> kernel;
+                    std::function<decltype(runtime::cpu::kernel::convert_16bit<bfloat16, float>)>
+                        widen;
+                    if (element_type == element::bf16)
+                    {
+                        kernel = runtime::cpu::kernel::dot_widened<bfloat16>;
+                        widen = runtime::cpu::kernel::convert_16bit<bfloat16, float>;
+                    }
+                    else
+                    {
+                        kernel = runtime::cpu::kernel::dot_widened<float16>;
+                        widen = runtime::cpu::kernel::convert_16bit<float16, float>;
+                    }
+
+                    // Constant operands are widened here, once
+                    auto widen_constant = [&](size_t i) {
+                        shared_ptr<vector<float>> wide;
+                        auto constant =
+                            dynamic_pointer_cast<ngraph::op::Constant>(node->get_argument(i));
+                        if (constant)
+                        {
+                            wide = make_shared<vector<float>>(shape_size(constant->get_shape()));
+                            widen(const_cast<void*>(constant->get_data_ptr()),
+                                  wide->data(),
+                                  wide->size());
+                        }
+                        return wide;
+                    };
+                    auto wide_const0 = widen_constant(0);
+                    auto wide_const1 = widen_constant(1);
+
+                    // Scratch for the other operands and the f32 result. Functors are built
+                    // for each executor state, so concurrent calls never share them.
+                    auto wide_arg0 = make_shared<vector<float>>(
+                        wide_const0 ? 0 : shape_size(arg0_shape));
+                    auto wide_arg1 = make_shared<vector<float>>(
+                        wide_const1 ? 0 : shape_size(arg1_shape));
+                    auto wide_out = make_shared<vector<float>>(shape_size(result_shape));
+
+                    auto functor = [&,
+                                    kernel,
+                                    widen,
+                                    wide_const0,
+                                    wide_const1,
+                                    wide_arg0,
+                                    wide_arg1,
+                                    wide_out,
+                                    arg0_shape,
+                                    arg1_shape,
+                                    result_shape,
+                                    reduction_axes_count](CPURuntimeContext* ctx) {
+                        float* a = wide_const0 ? wide_const0->data() : wide_arg0->data();
+                        float* b = wide_const1 ? wide_const1->data() : wide_arg1->data();
+                        if (!wide_const0)
+                        {
+                            widen(arg0_tensor, a, wide_arg0->size());
+                        }
+                        if (!wide_const1)
+                        {
+                            widen(arg1_tensor, b, wide_arg1->size());
+                        }
+                        kernel(a,
+                               b,
+                               wide_out->data(),
+                               out_tensor,
+                               arg0_shape,
+                               arg1_shape,
+                               result_shape,
+                               reduction_axes_count);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 if (arg0_shape.empty() || arg1_shape.empty())
                 {
                     auto first = (arg0_shape.empty() ? args[0] : args[1]);
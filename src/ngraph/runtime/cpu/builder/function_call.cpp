@@ -15,8 +15,9 @@
 *******************************************************************************/
 
 #include "ngraph/op/function_call.hpp"
-#include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/tensor_view.hpp"
 
 using namespace std;
@@ -33,7 +34,6 @@ namespace ngraph
             {
                 auto function_call = static_cast<const ngraph::op::FunctionCall*>(node);
                 auto function = function_call->get_functions()[0];
-                auto backend = runtime::Backend::create("CPU");
 
                 auto& functors = external_function->get_functors();
                 auto& callees = external_function->get_callees();
@@ -62,10 +62,11 @@ namespace ngraph
                     callees[function->get_name()] = make_shared<CPU_ExternalFunction>(function);
                 }
 
-                auto& callee_external_function = callees[function->get_name()];
+                // Calls that were not inlined share one call frame, which is reentrant
+                auto call_frame = callees[function->get_name()]->make_call_frame();
 
                 auto functor = [&,
-                                backend,
+                                call_frame,
                                 arg_shapes,
                                 arg_types,
                                 arg_tensors,
@@ -75,16 +76,15 @@ namespace ngraph
                     TensorViewPtrs inputs, outputs;
                     for (int i = 0; i < arg_shapes.size(); i++)
                     {
-                        inputs.emplace_back(
-                            backend->create_tensor(arg_types[i], arg_shapes[i], arg_tensors[i]));
+                        inputs.emplace_back(make_shared<CPUTensorView>(
+                            arg_types[i], arg_shapes[i], arg_tensors[i]));
                     }
                     for (int i = 0; i < out_shapes.size(); i++)
                     {
-                        outputs.emplace_back(
-                            backend->create_tensor(out_types[i], out_shapes[i], out_tensors[i]));
+                        outputs.emplace_back(make_shared<CPUTensorView>(
+                            out_types[i], out_shapes[i], out_tensors[i]));
                     }
 
-                    auto call_frame = callee_external_function->make_call_frame();
                     call_frame->call(outputs, inputs);
                 };
                 functors.emplace_back(functor);
@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/loop_kernel.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) type_index(typeid(x))
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Ops inside a loop kernel still refer to the GetOutputElements of other
+            // loop kernels, which GetOutputElementElimination only removes from the graph
+            static const descriptor::Output* get_goe_input_output(const descriptor::Output* output)
+            {
+                auto it = output;
+                while (auto goe =
+                           dynamic_pointer_cast<ngraph::op::GetOutputElement>(it->get_node()))
+                {
+                    it = &goe->get_inputs().at(goe->get_n()).get_output();
+                }
+                return it;
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::runtime::cpu::op::LoopKernel)
+            {
+                using kernel::loop::Opcode;
+                static const unordered_map<type_index, Opcode> opcodes{
+                    {TI(ngraph::op::Abs), Opcode::Abs},
+                    {TI(ngraph::op::Add), Opcode::Add},
+                    {TI(ngraph::op::Divide), Opcode::Divide},
+                    {TI(ngraph::op::Exp), Opcode::Exp},
+                    {TI(ngraph::op::Maximum), Opcode::Maximum},
+                    {TI(ngraph::op::Minimum), Opcode::Minimum},
+                    {TI(ngraph::op::Multiply), Opcode::Multiply},
+                    {TI(ngraph::op::Negative), Opcode::Negative},
+                    {TI(ngraph::op::Relu), Opcode::Relu},
+                    {TI(ngraph::op::Sigmoid), Opcode::Sigmoid},
+                    {TI(ngraph::op::Subtract), Opcode::Subtract},
+                    {TI(ngraph::op::Tanh), Opcode::Tanh}};
+
+                auto& functors = external_function->get_functors();
+                auto lk = static_cast<const ngraph::runtime::cpu::op::LoopKernel*>(node);
+
+                // Slots of the kernel's arguments, then its outputs, then one temporary
+                // per remaining op
+                unordered_map<const descriptor::Output*, size_t> slots;
+                vector<void**> tensors;
+                for (size_t i = 0; i < args.size(); i++)
+                {
+                    slots.insert({get_goe_input_output(&lk->get_inputs().at(i).get_output()),
+                                  tensors.size()});
+                    tensors.push_back(&external_function->get_tensor_data(args[i].get_name()));
+                }
+                const NodeVector& output_nodes = lk->get_kernel_outputs();
+                for (size_t i = 0; i < out.size(); i++)
+                {
+                    slots.insert({&output_nodes.at(i)->get_outputs().at(0), tensors.size()});
+                    tensors.push_back(&external_function->get_tensor_data(out[i].get_name()));
+                }
+
+                size_t temp_count = 0;
+                vector<kernel::loop::Instruction> program;
+                for (auto op_node : lk->get_node_list())
+                {
+                    const Node& n = *op_node;
+                    kernel::loop::Instruction instruction;
+                    instruction.opcode = opcodes.at(TI(n));
+                    instruction.arg0 =
+                        slots.at(get_goe_input_output(&op_node->get_inputs().at(0).get_output()));
+                    instruction.arg1 = instruction.arg0;
+                    if (op_node->get_inputs().size() > 1)
+                    {
+                        instruction.arg1 = slots.at(
+                            get_goe_input_output(&op_node->get_inputs().at(1).get_output()));
+                    }
+
+                    auto output = &op_node->get_outputs().at(0);
+                    if (slots.count(output) == 0)
+                    {
+                        slots.insert({output, tensors.size() + temp_count++});
+                    }
+                    instruction.out = slots.at(output);
+                    program.push_back(instruction);
+                }
+
+                std::function<decltype(runtime::cpu::kernel::loop_kernel<float>)> kernel;
+                SELECT_KERNEL(kernel, out[0].get_element_type(), runtime::cpu::kernel::loop_kernel);
+
+                auto count = out[0].get_size();
+                auto functor =
+                    [&, kernel, program, tensors, temp_count, count](CPURuntimeContext* ctx) {
+                        vector<void*> tensor_ptrs;
+                        for (auto tensor : tensors)
+                        {
+                            tensor_ptrs.push_back(*tensor);
+                        }
+                        kernel(program, tensor_ptrs.data(), tensor_ptrs.size(), temp_count, count);
+                    };
+                functors.emplace_back(functor);
+            }
+        }
+    }
+}
+
+#undef TI
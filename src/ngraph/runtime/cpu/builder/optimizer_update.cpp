@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/optimizer_update.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Updates are only defined for f32 and f64
+#define SELECT_UPDATE_KERNEL(KV, ET, K)                                                            \
+    if (ET == element::f32)                                                                        \
+    {                                                                                              \
+        KV = K<float>;                                                                             \
+    }                                                                                              \
+    else if (ET == element::f64)                                                                   \
+    {                                                                                              \
+        KV = K<double>;                                                                            \
+    }                                                                                              \
+    else                                                                                           \
+    {                                                                                              \
+        throw ngraph_error("Unsupported element type " + ET.c_type_string() + " for kernel " #K); \
+    }
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SGDUpdate)
+            {
+                auto sgd = static_cast<const ngraph::op::SGDUpdate*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto& weights_tensor = external_function->get_tensor_data(args[0].get_name());
+                auto& gradient_tensor = external_function->get_tensor_data(args[1].get_name());
+                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+
+                std::function<decltype(runtime::cpu::kernel::sgd_update<float>)> kernel;
+                SELECT_UPDATE_KERNEL(
+                    kernel, out[0].get_element_type(), runtime::cpu::kernel::sgd_update);
+
+                auto lr = sgd->get_learning_rate();
+                auto count = out[0].get_size();
+                auto functor = [&, kernel, lr, count](CPURuntimeContext* ctx) {
+                    kernel(weights_tensor, gradient_tensor, out_tensor, lr, count);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::MomentumUpdate)
+            {
+                auto momentum_update = static_cast<const ngraph::op::MomentumUpdate*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto& weights_tensor = external_function->get_tensor_data(args[0].get_name());
+                auto& velocity_tensor = external_function->get_tensor_data(args[1].get_name());
+                auto& gradient_tensor = external_function->get_tensor_data(args[2].get_name());
+                auto& out_weights_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto& out_velocity_tensor = external_function->get_tensor_data(out[1].get_name());
+
+                std::function<decltype(runtime::cpu::kernel::momentum_update<float>)> kernel;
+                SELECT_UPDATE_KERNEL(
+                    kernel, out[0].get_element_type(), runtime::cpu::kernel::momentum_update);
+
+                auto lr = momentum_update->get_learning_rate();
+                auto momentum = momentum_update->get_momentum();
+                auto count = out[0].get_size();
+                auto functor = [&, kernel, lr, momentum, count](CPURuntimeContext* ctx) {
+                    kernel(weights_tensor,
+                           velocity_tensor,
+                           gradient_tensor,
+                           out_weights_tensor,
+                           out_velocity_tensor,
+                           lr,
+                           momentum,
+                           count);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::AdamUpdate)
+            {
+                auto adam = static_cast<const ngraph::op::AdamUpdate*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto& weights_tensor = external_function->get_tensor_data(args[0].get_name());
+                auto& m_tensor = external_function->get_tensor_data(args[1].get_name());
+                auto& v_tensor = external_function->get_tensor_data(args[2].get_name());
+                auto& gradient_tensor = external_function->get_tensor_data(args[3].get_name());
+                auto& out_weights_tensor = external_function->get_tensor_data(out[0].get_name());
+                auto& out_m_tensor = external_function->get_tensor_data(out[1].get_name());
+                auto& out_v_tensor = external_function->get_tensor_data(out[2].get_name());
+
+                std::function<decltype(runtime::cpu::kernel::adam_update<float>)> kernel;
+                SELECT_UPDATE_KERNEL(
+                    kernel, out[0].get_element_type(), runtime::cpu::kernel::adam_update);
+
+                auto lr = adam->get_learning_rate();
+                auto beta1 = adam->get_beta1();
+                auto beta2 = adam->get_beta2();
+                auto epsilon = adam->get_epsilon();
+                auto count = out[0].get_size();
+                auto functor =
+                    [&, kernel, lr, beta1, beta2, epsilon, count](CPURuntimeContext* ctx) {
+                        kernel(weights_tensor,
+                               m_tensor,
+                               v_tensor,
+                               gradient_tensor,
+                               out_weights_tensor,
+                               out_m_tensor,
+                               out_v_tensor,
+                               lr,
+                               beta1,
+                               beta2,
+                               epsilon,
+                               count);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(SGDUpdate);
+            REGISTER_OP_BUILDER(MomentumUpdate);
+            REGISTER_OP_BUILDER(AdamUpdate);
+        }
+    }
+}
@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/quantize.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Quantize)
+            {
+                auto quantize = static_cast<const ngraph::op::Quantize*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
+                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+
+                auto element_count = out[0].get_size();
+                auto scale = quantize->get_scale();
+                auto zero_point = quantize->get_zero_point();
+
+                std::function<decltype(runtime::cpu::kernel::quantize<float, int8_t>)> kernel;
+
+                auto& in_et = args[0].get_element_type();
+                auto& out_et = out[0].get_element_type();
+                if (in_et == element::f32 && out_et == element::i8)
+                {
+                    kernel = runtime::cpu::kernel::quantize<float, int8_t>;
+                }
+                else if (in_et == element::f32 && out_et == element::u8)
+                {
+                    kernel = runtime::cpu::kernel::quantize<float, uint8_t>;
+                }
+                else if (in_et == element::f64 && out_et == element::i8)
+                {
+                    kernel = runtime::cpu::kernel::quantize<double, int8_t>;
+                }
+                else if (in_et == element::f64 && out_et == element::u8)
+                {
+                    kernel = runtime::cpu::kernel::quantize<double, uint8_t>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element types for Quantize");
+                }
+
+                auto functor = [&, kernel, element_count, scale, zero_point](
+                    CPURuntimeContext* ctx) {
+                    kernel(arg_tensor, out_tensor, element_count, scale, zero_point);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Dequantize)
+            {
+                auto dequantize = static_cast<const ngraph::op::Dequantize*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto& arg_tensor = external_function->get_tensor_data(args[0].get_name());
+                auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
+
+                auto element_count = out[0].get_size();
+                auto scale = dequantize->get_scale();
+                auto zero_point = dequantize->get_zero_point();
+
+                std::function<decltype(runtime::cpu::kernel::dequantize<int8_t, float>)> kernel;
+
+                auto& in_et = args[0].get_element_type();
+                auto& out_et = out[0].get_element_type();
+                if (in_et == element::i8 && out_et == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::dequantize<int8_t, float>;
+                }
+                else if (in_et == element::u8 && out_et == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::dequantize<uint8_t, float>;
+                }
+                else if (in_et == element::i8 && out_et == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::dequantize<int8_t, double>;
+                }
+                else if (in_et == element::u8 && out_et == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::dequantize<uint8_t, double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element types for Dequantize");
+                }
+
+                auto functor = [&, kernel, element_count, scale, zero_point](
+                    CPURuntimeContext* ctx) {
+                    kernel(arg_tensor, out_tensor, element_count, scale, zero_point);
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(Quantize);
+            REGISTER_OP_BUILDER(Dequantize);
+        }
+    }
+}
@@ -16,11 +16,16 @@
 
 #include "ngraph/runtime/cpu/kernel/reduce_function.hpp"
 #include "ngraph/op/reduce.hpp"
-#include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_max.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_min.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_product.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_sum.hpp"
 #include "ngraph/runtime/tensor_view.hpp"
 
+#include "reduction.hpp"
+
 using namespace std;
 using namespace ngraph;
 
@@ -30,6 +35,41 @@ namespace ngraph
     {
         namespace cpu
         {
+            // Native reduction of the reductee, without the initial value
+            static void build_native_reduction(CPU_ExternalFunction* external_function,
+                                               const ngraph::Node* node,
+                                               const std::vector<TensorViewWrapper>& args,
+                                               const std::vector<TensorViewWrapper>& out,
+                                               kernel::NativeReducer reducer)
+            {
+                switch (reducer)
+                {
+                case kernel::NativeReducer::Add:
+                {
+                    BUILD_REDUCTION_FUNCTOR(Reduce, sum);
+                    break;
+                }
+                case kernel::NativeReducer::Multiply:
+                {
+                    BUILD_REDUCTION_FUNCTOR(Reduce, product);
+                    break;
+                }
+                case kernel::NativeReducer::Maximum:
+                case kernel::NativeReducer::Or:
+                {
+                    BUILD_REDUCTION_FUNCTOR(Reduce, max);
+                    break;
+                }
+                case kernel::NativeReducer::Minimum:
+                case kernel::NativeReducer::And:
+                {
+                    BUILD_REDUCTION_FUNCTOR(Reduce, min);
+                    break;
+                }
+                case kernel::NativeReducer::None: throw ngraph_error("Unsupported reducer");
+                }
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Reduce)
             {
@@ -39,12 +79,6 @@ namespace ngraph
                 auto& functors = external_function->get_functors();
                 auto& callees = external_function->get_callees();
 
-                if (!callees.count(function->get_name()))
-                {
-                    callees[function->get_name()] = make_shared<CPU_ExternalFunction>(function);
-                }
-                auto& reducer_external_function = callees[function->get_name()];
-
                 auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
                 auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
                 auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
@@ -61,8 +95,40 @@ namespace ngraph
                         memcpy(out_tensor, arg0_tensor, size);
                     };
                     functors.emplace_back(functor);
+                    return;
+                }
+
+                // Bodies such as x + y run on the same kernels as Sum, Product, Max and Min
+                auto reducer = kernel::get_native_reducer(*function);
+                if (reducer != kernel::NativeReducer::None)
+                {
+                    build_native_reduction(external_function, node, args, out, reducer);
+
+                    std::function<decltype(runtime::cpu::kernel::reduce_fold_initial<float>)>
+                        kernel;
+
+                    SELECT_KERNEL(kernel,
+                                  args[0].get_element_type(),
+                                  runtime::cpu::kernel::reduce_fold_initial);
+
+                    auto count = out[0].get_size();
+                    auto functor = [&, kernel, count, reducer](CPURuntimeContext* ctx) {
+                        kernel(arg1_tensor, out_tensor, count, reducer);
+                    };
+                    functors.emplace_back(functor);
+                    return;
                 }
-                else if (reduction_axes.size() == 1)
+
+                if (!callees.count(function->get_name()))
+                {
+                    callees[function->get_name()] = make_shared<CPU_ExternalFunction>(function);
+                }
+                // Functors are built for each executor state, so every concurrent call
+                // reduces through a ScalarFunction of its own
+                auto scalar_function = make_shared<kernel::ScalarFunction>(
+                    callees[function->get_name()], args[0].get_element_type());
+
+                if (reduction_axes.size() == 1)
                 {
                     std::function<decltype(runtime::cpu::kernel::reduce_function_1rd<float, 1>)>
                         kernel;
@@ -73,14 +139,15 @@ namespace ngraph
                                           runtime::cpu::kernel::reduce_function_1rd);
 
                     auto functor =
-                        [&, kernel, arg0_shape, out_shape, reduction_axes](CPURuntimeContext* ctx) {
+                        [&, kernel, arg0_shape, out_shape, reduction_axes, scalar_function](
+                            CPURuntimeContext* ctx) {
                             kernel(arg0_tensor,
                                    arg1_tensor,
                                    out_tensor,
                                    arg0_shape,
                                    out_shape,
                                    reduction_axes,
-                                   reducer_external_function);
+                                   scalar_function);
                         };
                     functors.emplace_back(functor);
                 }
@@ -94,14 +161,15 @@ namespace ngraph
                                   runtime::cpu::kernel::reduce_function_2d_2rd);
 
                     auto functor =
-                        [&, kernel, arg0_shape, out_shape, reduction_axes](CPURuntimeContext* ctx) {
+                        [&, kernel, arg0_shape, out_shape, reduction_axes, scalar_function](
+                            CPURuntimeContext* ctx) {
                             kernel(arg0_tensor,
                                    arg1_tensor,
                                    out_tensor,
                                    arg0_shape,
                                    out_shape,
                                    reduction_axes,
-                                   reducer_external_function);
+                                   scalar_function);
                         };
                     functors.emplace_back(functor);
                 }
@@ -115,20 +183,39 @@ namespace ngraph
                                   runtime::cpu::kernel::reduce_function_3d_2rd);
 
                     auto functor =
-                        [&, kernel, arg0_shape, out_shape, reduction_axes](CPURuntimeContext* ctx) {
+                        [&, kernel, arg0_shape, out_shape, reduction_axes, scalar_function](
+                            CPURuntimeContext* ctx) {
                             kernel(arg0_tensor,
                                    arg1_tensor,
                                    out_tensor,
                                    arg0_shape,
                                    out_shape,
                                    reduction_axes,
-                                   reducer_external_function);
+                                   scalar_function);
                         };
                     functors.emplace_back(functor);
                 }
                 else
                 {
-                    throw ngraph_error("Unsupported Reduce");
+                    std::function<decltype(runtime::cpu::kernel::reduce_function_ref<float>)>
+                        kernel;
+
+                    SELECT_KERNEL(kernel,
+                                  args[0].get_element_type(),
+                                  runtime::cpu::kernel::reduce_function_ref);
+
+                    auto functor =
+                        [&, kernel, arg0_shape, out_shape, reduction_axes, scalar_function](
+                            CPURuntimeContext* ctx) {
+                            kernel(arg0_tensor,
+                                   arg1_tensor,
+                                   out_tensor,
+                                   arg0_shape,
+                                   out_shape,
+                                   reduction_axes,
+                                   scalar_function);
+                        };
+                    functors.emplace_back(functor);
                 }
             }
 
@@ -38,12 +38,6 @@ namespace ngraph
                 auto& functors = external_function->get_functors();
                 auto& callees = external_function->get_callees();
 
-                if (!callees.count(function->get_name()))
-                {
-                    callees[function->get_name()] = make_shared<CPU_ExternalFunction>(function);
-                }
-                auto& reducer_external_function = callees[function->get_name()];
-
                 auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
                 auto& arg1_tensor = external_function->get_tensor_data(args[1].get_name());
                 auto& out_tensor = external_function->get_tensor_data(out[0].get_name());
@@ -54,15 +48,24 @@ namespace ngraph
                 auto window_shape = reduce_window->get_window_shape();
                 auto window_movement_strides = reduce_window->get_window_movement_strides();
 
-                std::function<decltype(runtime::cpu::kernel::reduce_function_window<float>)> kernel;
+                auto reducer = kernel::get_native_reducer(*function);
+                if (reducer != kernel::NativeReducer::None)
+                {
+                    std::function<decltype(
+                        runtime::cpu::kernel::reduce_function_window_native<float>)>
+                        kernel;
 
-                SELECT_KERNEL(kernel,
-                              args[0].get_element_type(),
-                              runtime::cpu::kernel::reduce_function_window);
+                    SELECT_KERNEL(kernel,
+                                  args[0].get_element_type(),
+                                  runtime::cpu::kernel::reduce_function_window_native);
 
-                auto functor =
-                    [&, kernel, arg0_shape, out_shape, window_shape, window_movement_strides](
-                        CPURuntimeContext* ctx) {
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    out_shape,
+                                    window_shape,
+                                    window_movement_strides,
+                                    reducer](CPURuntimeContext* ctx) {
                         kernel(arg0_tensor,
                                arg1_tensor,
                                out_tensor,
@@ -70,8 +73,43 @@ namespace ngraph
                                out_shape,
                                window_shape,
                                window_movement_strides,
-                               reducer_external_function);
+                               reducer);
                     };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                if (!callees.count(function->get_name()))
+                {
+                    callees[function->get_name()] = make_shared<CPU_ExternalFunction>(function);
+                }
+                // Functors are built for each executor state, so every concurrent call
+                // reduces through a ScalarFunction of its own
+                auto scalar_function = make_shared<kernel::ScalarFunction>(
+                    callees[function->get_name()], args[0].get_element_type());
+
+                std::function<decltype(runtime::cpu::kernel::reduce_function_window<float>)> kernel;
+
+                SELECT_KERNEL(kernel,
+                              args[0].get_element_type(),
+                              runtime::cpu::kernel::reduce_function_window);
+
+                auto functor = [&,
+                                kernel,
+                                arg0_shape,
+                                out_shape,
+                                window_shape,
+                                window_movement_strides,
+                                scalar_function](CPURuntimeContext* ctx) {
+                    kernel(arg0_tensor,
+                           arg1_tensor,
+                           out_tensor,
+                           arg0_shape,
+                           out_shape,
+                           window_shape,
+                           window_movement_strides,
+                           scalar_function);
+                };
                 functors.emplace_back(functor);
             }
 
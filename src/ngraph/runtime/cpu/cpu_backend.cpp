@@ -14,13 +14,20 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <thread>
+
 #include <tbb/tbb_stddef.h>
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_inter_op_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
+#include "ngraph/runtime/cpu/cpu_tracing.hpp"
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -63,17 +70,25 @@ shared_ptr<runtime::TensorView> runtime::cpu::CPU_Backend::create_tensor(
 
 bool runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func)
 {
-    FunctionInstance& instance = m_function_map[func];
+    lock_guard<mutex> lock(m_function_map_mutex);
+    compile_instance(func, m_function_map[func]);
+    return true;
+}
+
+void runtime::cpu::CPU_Backend::compile_instance(shared_ptr<Function> func,
+                                                 FunctionInstance& instance)
+{
     if (instance.m_external_function == nullptr)
     {
         instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
+        instance.m_external_function->m_inter_op_scheduler = m_inter_op_scheduler;
+        instance.m_external_function->m_thread_pool = m_thread_pool;
 #if !defined(NGRAPH_DEX_ONLY)
         instance.m_external_function->m_emit_timing = instance.m_performance_counters_enabled;
 #endif
         auto cf = instance.m_external_function->make_call_frame();
         instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
     }
-    return true;
 }
 
 bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
@@ -82,26 +97,84 @@ bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
 {
     bool rc = true;
 
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
+    shared_ptr<CPU_CallFrame> call_frame;
     {
-        rc = compile(func);
+        lock_guard<mutex> lock(m_function_map_mutex);
+        FunctionInstance& instance = m_function_map[func];
+        compile_instance(func, instance);
+        call_frame = instance.m_call_frame;
     }
 
-    instance.m_call_frame->call(outputs, inputs);
+    // The call frame hands each concurrent call its own execution context
+    call_frame->call(outputs, inputs);
 
     return rc;
 }
 
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Function> func)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     m_function_map.erase(func);
 }
 
+void runtime::cpu::CPU_Backend::set_inter_op_parallelism(size_t threads)
+{
+    lock_guard<mutex> lock(m_function_map_mutex);
+    for (const auto& p : m_function_map)
+    {
+        if (p.second.m_external_function != nullptr)
+        {
+            throw runtime_error("Inter-op parallelism must be set prior to compiling.");
+        }
+    }
+
+    // Every inter-op thread may start intra-op work of its own
+    size_t intra_op_threads = m_thread_pool
+                                  ? m_thread_pool->get_num_threads()
+                                  : static_cast<size_t>(eigen::global_thread_pool.NumThreads());
+    size_t max_threads = max<size_t>(1, thread::hardware_concurrency() / intra_op_threads);
+    threads = min(threads, max_threads);
+    m_inter_op_scheduler = threads > 1 ? make_shared<CPU_InterOpScheduler>(threads) : nullptr;
+}
+
+size_t runtime::cpu::CPU_Backend::get_inter_op_parallelism() const
+{
+    return m_inter_op_scheduler ? m_inter_op_scheduler->get_num_threads() : 1;
+}
+
+void runtime::cpu::CPU_Backend::set_thread_pool(const shared_ptr<CPU_ThreadPool>& thread_pool)
+{
+    lock_guard<mutex> lock(m_function_map_mutex);
+    for (const auto& p : m_function_map)
+    {
+        if (p.second.m_external_function != nullptr)
+        {
+            throw runtime_error("The thread pool must be set prior to compiling.");
+        }
+    }
+    m_thread_pool = thread_pool;
+}
+
+const shared_ptr<runtime::cpu::CPU_ThreadPool>& runtime::cpu::CPU_Backend::get_thread_pool() const
+{
+    return m_thread_pool;
+}
+
+void runtime::cpu::CPU_Backend::start_trace_capture(const string& file_name, size_t sample_interval)
+{
+    Tracer::get().start(file_name, sample_interval);
+}
+
+void runtime::cpu::CPU_Backend::stop_trace_capture()
+{
+    Tracer::get().stop();
+}
+
 #if !defined(NGRAPH_DEX_ONLY)
 
 void runtime::cpu::CPU_Backend::enable_performance_data(shared_ptr<Function> func, bool enable)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
     if (instance.m_external_function != nullptr)
     {
@@ -114,6 +187,7 @@ vector<runtime::PerformanceCounter>
     runtime::cpu::CPU_Backend::get_performance_data(shared_ptr<Function> func) const
 {
     vector<runtime::PerformanceCounter> rc;
+    lock_guard<mutex> lock(m_function_map_mutex);
     auto it = m_function_map.find(func);
     if (it != m_function_map.end())
     {
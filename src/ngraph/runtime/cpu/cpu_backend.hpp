@@ -18,6 +18,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/runtime/backend.hpp"
 
@@ -29,6 +30,8 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_CallFrame;
+            class CPU_InterOpScheduler;
+            class CPU_ThreadPool;
 
             class CPU_Backend : public runtime::Backend
             {
@@ -53,6 +56,26 @@ namespace ngraph
 
                 void remove_compiled_function(std::shared_ptr<Function> func) override;
 
+                // Run independent ops of directly executed functions on up to threads
+                // threads, preferring ops on the critical path. The count is capped so that
+                // inter-op threads times intra-op threads stays within the hardware threads.
+                // Must be set prior to compiling; 1 runs ops one after another.
+                void set_inter_op_parallelism(size_t threads);
+                size_t get_inter_op_parallelism() const;
+
+                // Run the intra-op work of every call on thread_pool instead of the
+                // process-wide pool, e.g. a pool pinned to one NUMA node so that several
+                // backends in one process each own a socket. nullptr restores the
+                // process-wide pool. Must be set prior to compiling and prior to
+                // set_inter_op_parallelism, which sizes itself by the pool.
+                void set_thread_pool(const std::shared_ptr<CPU_ThreadPool>& thread_pool);
+                const std::shared_ptr<CPU_ThreadPool>& get_thread_pool() const;
+
+                // Captures are process-wide and record the calls of all CPU backends
+                void start_trace_capture(const std::string& file_name,
+                                         size_t sample_interval = 1) override;
+                void stop_trace_capture() override;
+
 #if !defined(NGRAPH_DEX_ONLY)
                 void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
                 std::vector<PerformanceCounter>
@@ -68,7 +91,13 @@ namespace ngraph
                     bool m_performance_counters_enabled = false;
                 };
 
+                void compile_instance(std::shared_ptr<Function> func, FunctionInstance& instance);
+
+                // Guards m_function_map so that call() may be invoked from several threads
+                mutable std::mutex m_function_map_mutex;
                 std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+                std::shared_ptr<CPU_InterOpScheduler> m_inter_op_scheduler;
+                std::shared_ptr<CPU_ThreadPool> m_thread_pool;
             };
         }
     }
@@ -98,6 +98,7 @@
 #include "ngraph/runtime/cpu/kernel/tan.hpp"
 #include "ngraph/runtime/cpu/kernel/tanh.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/util.hpp"
 
@@ -283,6 +284,24 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Result)
             {
+                auto& element_type = args[0].get_element_type();
+                if (element_type == element::bf16 || element_type == element::f16)
+                {
+                    // Results only copy bytes, so the 16-bit floating point types, which
+                    // SELECT_KERNEL does not cover, can use the u16 kernel
+                    auto& functors = external_function->get_functors();
+                    auto element_count = out[0].get_size();
+                    auto& arg0_tensor = external_function->get_tensor_data(args[0].get_name());
+                    auto& out0_tensor = external_function->get_tensor_data(out[0].get_name());
+
+                    auto functor = [&, element_count](CPURuntimeContext* ctx) {
+                        runtime::cpu::kernel::result<uint16_t>(
+                            arg0_tensor, out0_tensor, element_count);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::result);
             }
 
@@ -365,7 +384,9 @@ namespace ngraph
             BuildOpMap build_dispatcher{
                 {TI(ngraph::op::Parameter), &runtime::cpu::Builder::nop},
                 {TI(ngraph::runtime::cpu::op::ConvertLayout),
-                 &runtime::cpu::Builder::build<ngraph::runtime::cpu::op::ConvertLayout>}};
+                 &runtime::cpu::Builder::build<ngraph::runtime::cpu::op::ConvertLayout>},
+                {TI(ngraph::runtime::cpu::op::LoopKernel),
+                 &runtime::cpu::Builder::build<ngraph::runtime::cpu::op::LoopKernel>}};
 
             REGISTER_OP_BUILDER(Constant);
             REGISTER_OP_BUILDER(Result);
@@ -20,6 +20,7 @@
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 
 using namespace std;
@@ -29,18 +30,50 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
                                            EntryPoint compiled_function)
     : m_external_function(external_function)
     , m_compiled_function(compiled_function)
+    , m_contexts(external_function->get_concurrency(), nullptr)
 {
-    setup_runtime_context();
+    m_contexts[0] = setup_runtime_context(0);
 }
 
 runtime::cpu::CPU_CallFrame::~CPU_CallFrame()
 {
-    cleanup_runtime_context();
+    for (auto ctx : m_contexts)
+    {
+        if (ctx != nullptr)
+        {
+            cleanup_runtime_context(ctx);
+        }
+    }
 }
 
 void runtime::cpu::CPU_CallFrame::call(
     const std::vector<std::shared_ptr<runtime::TensorView>>& output_tvs,
     const std::vector<std::shared_ptr<runtime::TensorView>>& input_tvs)
+{
+    // The executor state is held exclusively until the call returns, so the
+    // matching context is never used by two threads at once
+    size_t state_index = m_external_function->acquire_executor_state();
+    try
+    {
+        CPU_ThreadPool::Scope thread_pool_scope(m_external_function->get_thread_pool().get());
+        if (m_contexts[state_index] == nullptr)
+        {
+            m_contexts[state_index] = setup_runtime_context(state_index);
+        }
+        inner_call(m_contexts[state_index], output_tvs, input_tvs);
+    }
+    catch (...)
+    {
+        m_external_function->release_executor_state(state_index);
+        throw;
+    }
+    m_external_function->release_executor_state(state_index);
+}
+
+void runtime::cpu::CPU_CallFrame::inner_call(
+    CPURuntimeContext* ctx,
+    const std::vector<std::shared_ptr<runtime::TensorView>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::TensorView>>& input_tvs)
 {
     vector<void*> inputs;
     vector<void*> outputs;
@@ -61,6 +94,14 @@ void runtime::cpu::CPU_CallFrame::call(
         outputs.push_back(tv->get_data_ptr());
     }
 
+    // Primitives queued by a call that threw are dropped
+    ctx->mkldnn_pending_primitives.clear();
+
+    ctx->trace_session = Tracer::get().sample();
+    // Traced calls run each primitive as its op executes so that op events time the op
+    ctx->mkldnn_defer_primitives =
+        m_external_function->is_batching_mkldnn_primitives() && ctx->trace_session == 0;
+
     // Invoke compiled computation
     if (!m_external_function->is_direct_execution())
     {
@@ -70,13 +111,6 @@ void runtime::cpu::CPU_CallFrame::call(
     {
         m_external_function->get_executor()(ctx, inputs, outputs);
     }
-
-    if (runtime::cpu::IsTracingEnabled())
-    {
-        GenerateTimeline(m_external_function->get_op_attrs(),
-                         ctx->op_durations,
-                         m_external_function->get_function_name() + ".timeline.json");
-    }
 }
 
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
@@ -99,18 +133,18 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
     }
 }
 
-void runtime::cpu::CPU_CallFrame::setup_runtime_context()
+runtime::cpu::CPURuntimeContext*
+    runtime::cpu::CPU_CallFrame::setup_runtime_context(size_t state_index)
 {
-    ctx = new CPURuntimeContext;
+    CPURuntimeContext* ctx = new CPURuntimeContext;
 
-    ctx->op_durations = nullptr;
-    if (runtime::cpu::IsTracingEnabled())
-    {
-        ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
-    }
+    ctx->state_index = state_index;
+    ctx->trace_session = 0;
+    ctx->trace_function = m_external_function->get_trace_function();
     ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
 
     ctx->first_iteration = true;
+    ctx->mkldnn_defer_primitives = m_external_function->is_batching_mkldnn_primitives();
 
     // Create temporary buffer pools
     size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
@@ -123,25 +157,33 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
     ctx->mkldnn_primitives = mkldnn_emitter->get_mkldnn_primitives().data();
     ctx->mkldnn_workspaces = mkldnn_emitter->get_mkldnn_workspaces().data();
 
+    ctx->G = nullptr;
+    ctx->c = nullptr;
+    ctx->init = nullptr;
     if (std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
     {
         ctx->G = new tbb::flow::graph;
-        const auto envParallelism = std::getenv("NGRAPH_INTER_OP_PARALLELISM");
-        const auto parallelism = envParallelism == nullptr ? 1 : std::atoi(envParallelism);
-        ctx->c = new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
-        ctx->init = new tbb::task_scheduler_init(parallelism);
+        // Scheduler limits are process-wide, so only the first context sets them
+        if (state_index == 0)
+        {
+            const auto envParallelism = std::getenv("NGRAPH_INTER_OP_PARALLELISM");
+            const auto parallelism = envParallelism == nullptr ? 1 : std::atoi(envParallelism);
+            ctx->c =
+                new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
+            ctx->init = new tbb::task_scheduler_init(parallelism);
+        }
     }
+    return ctx;
 }
 
-void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
+void runtime::cpu::CPU_CallFrame::cleanup_runtime_context(CPURuntimeContext* ctx)
 {
-    delete[] ctx->op_durations;
     delete[] ctx->p_en;
     for (auto buffer : ctx->memory_buffers)
     {
         delete buffer;
     }
-    if (std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    if (ctx->G != nullptr)
     {
         // delete graph G and nodes in G
         ctx->G->wait_for_all();
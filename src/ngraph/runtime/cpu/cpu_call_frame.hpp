@@ -55,13 +55,19 @@ namespace ngraph
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::TensorView>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
-                void setup_runtime_context();
-                void cleanup_runtime_context();
+                CPURuntimeContext* setup_runtime_context(size_t state_index);
+                void cleanup_runtime_context(CPURuntimeContext* ctx);
 
             protected:
+                void inner_call(CPURuntimeContext* ctx,
+                                const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
+                                const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
+
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
                 EntryPoint m_compiled_function;
-                CPURuntimeContext* ctx;
+                // One runtime context per executor state of the external function.
+                // Contexts other than the first are created on first use.
+                std::vector<CPURuntimeContext*> m_contexts;
             };
         }
     }
@@ -17,6 +17,8 @@
 #include "ngraph/runtime/cpu/cpu_emitter.hpp"
 #include <algorithm>
 #include <cmath>
+#include <iomanip>
+#include <limits>
 #include <numeric>
 #include <string>
 #include <typeindex>
@@ -42,6 +44,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/equal.hpp"
@@ -71,6 +74,8 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/relu.hpp"
@@ -106,6 +111,7 @@
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
@@ -137,6 +143,19 @@ static string eigen_matrix_format(const ngraph::Shape& shape, const ngraph::Stri
     return ss.str();
 }
 
+static bool is_16bit_float(const element::Type& type)
+{
+    return type == element::bf16 || type == element::f16;
+}
+
+// Quantization parameters must survive the round trip through generated source exactly
+static string emit_float(float value)
+{
+    stringstream ss;
+    ss << setprecision(numeric_limits<float>::max_digits10) << value;
+    return ss.str();
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -579,6 +598,8 @@ namespace ngraph
                     static_cast<const ngraph::op::BatchNorm*>(node);
 
                 writer.block_begin();
+                // bn_weights is read by the primitive and its inputs may still be queued
+                writer << "cpu::mkldnn_utils::mkldnn_flush_primitives(ctx);\n";
                 // define weights
                 writer << "std::vector<" << args[0].get_element_type().c_type_string()
                        << ">bn_weights(2*" << args[0].get_size() << ");\n";
@@ -673,6 +694,7 @@ namespace ngraph
                     writer << "cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, "
                            << to_string(batchnorm_index) << ");\n";
                 }
+                writer << "cpu::mkldnn_utils::mkldnn_flush_primitives(ctx);\n";
                 writer.block_end();
             }
 
@@ -732,6 +754,8 @@ namespace ngraph
                     static_cast<const ngraph::op::BatchNormBackprop*>(node);
 
                 writer.block_begin();
+                // bn_weights is read by the primitive and its inputs may still be queued
+                writer << "cpu::mkldnn_utils::mkldnn_flush_primitives(ctx);\n";
                 // define weights
                 writer << "std::vector<" << args[0].get_element_type().c_type_string()
                        << ">bn_weights(2*" << args[0].get_size() << ");\n";
@@ -784,6 +808,7 @@ namespace ngraph
 
                 writer << "cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, "
                        << to_string(batchnorm_index) << ");\n";
+                writer << "cpu::mkldnn_utils::mkldnn_flush_primitives(ctx);\n";
 
                 writer << "memcpy(" << out[1].get_name() << ", &bn_dweights[0], "
                        << args[0].get_size() * args[0].get_element_type().size() << ");\n";
@@ -800,7 +825,44 @@ namespace ngraph
 
                 const Shape& arg0_shape = args[0].get_shape();
                 const Shape& arg1_shape = args[1].get_shape();
-                if (arg0_shape.empty() || arg1_shape.empty())
+                if (is_16bit_float(out[0].get_element_type()))
+                {
+                    // Widen to f32, run the float kernels and narrow the result once. Calls
+                    // into generated code are serialized, so the scratch buffers are static,
+                    // and constant operands are only widened on the first iteration.
+                    writer.block_begin();
+                    for (size_t i = 0; i < 2; i++)
+                    {
+                        bool is_constant = node->get_argument(i)->is_constant();
+                        writer << "static std::vector<float> wide_arg" << i << "("
+                               << args[i].get_size() << ");\n";
+                        if (is_constant)
+                        {
+                            writer << "if (ctx->first_iteration)\n";
+                            writer.block_begin();
+                        }
+                        writer << "cpu::kernel::convert_16bit<" << args[i].get_type()
+                               << ", float>(" << args[i].get_name() << ", wide_arg" << i
+                               << ".data(), " << args[i].get_size() << ");\n";
+                        if (is_constant)
+                        {
+                            writer.block_end();
+                        }
+                    }
+                    writer << "static std::vector<float> wide_out(" << out[0].get_size()
+                           << ");\n";
+                    writer << "cpu::kernel::dot_widened<" << out[0].get_type()
+                           << ">(wide_arg0.data(),\n";
+                    writer << "            wide_arg1.data(),\n";
+                    writer << "            wide_out.data(),\n";
+                    writer << "            " << out[0].get_name() << ",\n";
+                    writer << "            {" << join(args[0].get_shape()) << "},\n";
+                    writer << "            {" << join(args[1].get_shape()) << "},\n";
+                    writer << "            {" << join(out[0].get_shape()) << "},\n";
+                    writer << "            " << dot->get_reduction_axes_count() << ");\n";
+                    writer.block_end();
+                }
+                else if (arg0_shape.empty() || arg1_shape.empty())
                 {
                     auto& first = (arg0_shape.empty() ? args[0] : args[1]);
                     auto& second = (arg0_shape.empty() ? args[1] : args[0]);
@@ -1520,17 +1582,24 @@ namespace ngraph
 
                 writer.block_begin();
 #if USE_EIGEN_CORE_INLINE == 1
-                writer << emit_array1d(out[0]) << " =\n"
-                       << "    " << emit_array1d(args[0]) << "\n"
-                       << "    .template cast<" << result_element_type.c_type_string() << ">();\n";
-#else
+                if (!is_16bit_float(args[0].get_element_type()) &&
+                    !is_16bit_float(result_element_type))
+                {
+                    writer << emit_array1d(out[0]) << " =\n"
+                           << "    " << emit_array1d(args[0]) << "\n"
+                           << "    .template cast<" << result_element_type.c_type_string()
+                           << ">();\n";
+                    writer.block_end();
+                    return;
+                }
+#endif
+                // Eigen cannot cast to or from the 16-bit floating point storage types
                 writer << "#pragma omp parallel for\n";
                 writer << "for (size_t i = 0; i < " << out[0].get_size() << "; i++)\n";
                 writer.block_begin();
                 writer << out[0].get_name() << "[i] = (" << result_element_type.c_type_string()
                        << ")(" << args[0].get_name() << "[i]);\n";
                 writer.block_end();
-#endif
                 writer.block_end();
             }
 
@@ -2851,6 +2920,79 @@ namespace ngraph
                 }
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::QuantizedConvolution)
+            {
+                auto qconv = static_cast<const ngraph::op::QuantizedConvolution*>(node);
+
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    auto conv_index = mkldnn_emitter->build_quantized_convolution(node);
+                    auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
+
+                    for (size_t i = 0; i < args.size(); i++)
+                    {
+                        writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, " << to_string(deps[i])
+                               << ", " << args[i].get_name() << ");\n";
+                    }
+                    writer << "cpu::mkldnn_utils::set_memory_ptr(ctx, "
+                           << to_string(deps[args.size()]) << ", " << out[0].get_name()
+                           << ");\n";
+
+                    writer << "cpu::mkldnn_utils::mkldnn_invoke_primitive(ctx, "
+                           << to_string(conv_index) << ");\n";
+                }
+                else
+                {
+                    writer << "reference::quantized_convolution<" << args[0].get_type() << ", "
+                           << args[1].get_type() << ", " << out[0].get_type() << ">("
+                           << args[0].get_name() << ",\n";
+                    writer << "    " << args[1].get_name() << ",\n";
+                    writer << "    " << (qconv->with_bias() ? args[2].get_name() : "nullptr")
+                           << ",\n";
+                    writer << "    " << out[0].get_name() << ",\n";
+                    writer << "    {" << join(args[0].get_shape()) << "},\n";
+                    writer << "    {" << join(args[1].get_shape()) << "},\n";
+                    writer << "    {" << join(out[0].get_shape()) << "},\n";
+                    writer << "    {" << join(qconv->get_window_movement_strides()) << "},\n";
+                    writer << "    {" << join(qconv->get_window_dilation_strides()) << "},\n";
+                    writer << "    {" << join(qconv->get_padding_below()) << "},\n";
+                    writer << "    {" << join(qconv->get_padding_above()) << "},\n";
+                    writer << "    " << emit_float(qconv->get_data_scale()) << ", "
+                           << qconv->get_data_zero_point() << ",\n";
+                    writer << "    " << emit_float(qconv->get_filter_scale()) << ", "
+                           << qconv->get_filter_zero_point() << ",\n";
+                    writer << "    " << emit_float(qconv->get_output_scale()) << ", "
+                           << qconv->get_output_zero_point() << ",\n";
+                    writer << "    " << (qconv->with_relu() ? "true" : "false") << ");\n";
+                }
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Quantize)
+            {
+                auto quantize = static_cast<const ngraph::op::Quantize*>(node);
+                writer << "reference::quantize<" << args[0].get_type() << ", "
+                       << out[0].get_type() << ">(" << args[0].get_name() << ",\n";
+                writer << "    " << out[0].get_name() << ",\n";
+                writer << "    " << out[0].get_size() << ",\n";
+                writer << "    " << emit_float(quantize->get_scale()) << ",\n";
+                writer << "    " << quantize->get_zero_point() << ");\n";
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Dequantize)
+            {
+                auto dequantize = static_cast<const ngraph::op::Dequantize*>(node);
+                writer << "reference::dequantize<" << args[0].get_type() << ", "
+                       << out[0].get_type() << ">(" << args[0].get_name() << ",\n";
+                writer << "    " << out[0].get_name() << ",\n";
+                writer << "    " << out[0].get_size() << ",\n";
+                writer << "    " << emit_float(dequantize->get_scale()) << ",\n";
+                writer << "    " << dequantize->get_zero_point() << ");\n";
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::ConvolutionBias)
             {
@@ -4014,6 +4156,71 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::SGDUpdate)
+            {
+                auto sgd = static_cast<const ngraph::op::SGDUpdate*>(node);
+                const string& type = out[0].get_type();
+                string lr = type + "(" + emit_float(sgd->get_learning_rate()) + ")";
+
+                writer.block_begin();
+                writer << "#pragma omp parallel for simd\n";
+                writer << "for (size_t i = 0; i < " << out[0].get_size() << "; i++)\n";
+                writer.block_begin();
+                writer << out[0].get_name() << "[i] = " << args[0].get_name() << "[i] - "
+                       << args[1].get_name() << "[i] * " << lr << ";\n";
+                writer.block_end();
+                writer.block_end();
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::MomentumUpdate)
+            {
+                auto momentum_update = static_cast<const ngraph::op::MomentumUpdate*>(node);
+                const string& type = out[0].get_type();
+                string lr = type + "(" + emit_float(momentum_update->get_learning_rate()) + ")";
+                string momentum = type + "(" + emit_float(momentum_update->get_momentum()) + ")";
+
+                writer.block_begin();
+                writer << "#pragma omp parallel for simd\n";
+                writer << "for (size_t i = 0; i < " << out[0].get_size() << "; i++)\n";
+                writer.block_begin();
+                writer << type << " v = " << args[1].get_name() << "[i] * " << momentum << " + "
+                       << args[2].get_name() << "[i];\n";
+                writer << out[1].get_name() << "[i] = v;\n";
+                writer << out[0].get_name() << "[i] = " << args[0].get_name() << "[i] - v * " << lr
+                       << ";\n";
+                writer.block_end();
+                writer.block_end();
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::AdamUpdate)
+            {
+                auto adam = static_cast<const ngraph::op::AdamUpdate*>(node);
+                const string& type = out[0].get_type();
+                auto constant = [&](float value) { return type + "(" + emit_float(value) + ")"; };
+
+                writer.block_begin();
+                writer << "#pragma omp parallel for simd\n";
+                writer << "for (size_t i = 0; i < " << out[0].get_size() << "; i++)\n";
+                writer.block_begin();
+                writer << type << " g = " << args[3].get_name() << "[i];\n";
+                writer << type << " m = " << args[1].get_name() << "[i] * "
+                       << constant(adam->get_beta1()) << " + g * "
+                       << constant(1 - adam->get_beta1()) << ";\n";
+                writer << type << " v = " << args[2].get_name() << "[i] * "
+                       << constant(adam->get_beta2()) << " + g * g * "
+                       << constant(1 - adam->get_beta2()) << ";\n";
+                writer << out[1].get_name() << "[i] = m;\n";
+                writer << out[2].get_name() << "[i] = v;\n";
+                writer << out[0].get_name() << "[i] = " << args[0].get_name() << "[i] - m * "
+                       << constant(adam->get_learning_rate()) << " / (std::sqrt(v) + "
+                       << constant(adam->get_epsilon()) << ");\n";
+                writer.block_end();
+                writer.block_end();
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Softmax)
             {
@@ -4304,6 +4511,15 @@ namespace ngraph
                 auto nege =
                     std::bind(emit_prefix_operator, std::string("-"), std::placeholders::_1);
                 auto sube = std::bind(emit_infix_operator, std::string("-"), std::placeholders::_1);
+                auto mule = std::bind(emit_infix_operator, std::string("*"), std::placeholders::_1);
+                auto dive = std::bind(emit_infix_operator, std::string("/"), std::placeholders::_1);
+                auto expe =
+                    std::bind(emit_function_call, std::string("std::exp"), std::placeholders::_1);
+                auto tanhe =
+                    std::bind(emit_function_call, std::string("std::tanh"), std::placeholders::_1);
+                auto sigmoide = [](const std::vector<std::string>& args) {
+                    return "1 / (1 + std::exp(-" + args.at(0) + "))";
+                };
 
                 return std::unordered_map<
                     std::type_index,
@@ -4315,6 +4531,11 @@ namespace ngraph
                     {TI(ngraph::op::Add), adde},
                     {TI(ngraph::op::Negative), nege},
                     {TI(ngraph::op::Subtract), sube},
+                    {TI(ngraph::op::Multiply), mule},
+                    {TI(ngraph::op::Divide), dive},
+                    {TI(ngraph::op::Exp), expe},
+                    {TI(ngraph::op::Tanh), tanhe},
+                    {TI(ngraph::op::Sigmoid), sigmoide},
                 };
             }
 
@@ -14,8 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+#include <cmath>
+#include <cstdio>
 #include <cstdlib>
 #include <fstream>
+#include <iomanip>
+#include <limits>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -66,6 +71,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/equal.hpp"
@@ -95,6 +101,8 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/relu.hpp"
@@ -118,10 +126,12 @@
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
 #include "ngraph/pass/common_function_collection.hpp"
+#include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/cse.hpp"
 #include "ngraph/pass/dump_sorted.hpp"
 #include "ngraph/pass/get_output_element_elimination.hpp"
+#include "ngraph/pass/inliner.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
@@ -134,7 +144,9 @@
 #include "ngraph/runtime/cpu/cpu_emitter.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
+#include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_dot.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
@@ -147,6 +159,7 @@
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
@@ -155,6 +168,7 @@
 #include "ngraph/runtime/cpu/pass/cpu_concat_inputs.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_loop_kernel_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
@@ -167,6 +181,13 @@
 using namespace std;
 using namespace ngraph;
 
+static atomic<size_t> s_codegen_cache_hit_count{0};
+
+size_t runtime::cpu::CPU_ExternalFunction::get_codegen_cache_hit_count()
+{
+    return s_codegen_cache_hit_count;
+}
+
 runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     const shared_ptr<ngraph::Function>& function, bool release_function)
     : m_function(function)
@@ -177,20 +198,136 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     , m_is_compiled(false)
     , m_emit_timing(false)
 #endif
+    , m_trace_function(0)
+    , m_trace_registered(false)
     , m_function_name(function->get_name())
+    , m_building_state(0)
     , m_is_built(false)
 #if !defined(NGRAPH_DEX_ONLY)
     , m_direct_execution(std::getenv("NGRAPH_DEX") != nullptr)
 #else
     , m_direct_execution(true)
 #endif
+    , m_batch_mkldnn_primitives(false)
+    , m_memory_sharing(false)
+    , m_op_costs_measured(false)
+    , m_op_priorities_version(1)
+    , m_concurrency(1)
 {
+    const char* concurrency = std::getenv("NGRAPH_CPU_CONCURRENCY");
+    if (concurrency != nullptr && std::atoi(concurrency) > 1)
+    {
+        m_concurrency = static_cast<size_t>(std::atoi(concurrency));
+    }
 }
 
 runtime::cpu::CPU_ExternalFunction::~CPU_ExternalFunction()
 {
+    if (m_trace_registered)
+    {
+        runtime::cpu::Tracer::get().unregister_function(m_trace_function);
+    }
 }
 
+// Memory sharing between intermediate tensors is off by default. Setting
+// NGRAPH_CPU_MEMORY_STRATEGY to first_fit, best_fit or greedy_by_size enables it with that
+// layout strategy when ops run in order, that is without TBB flow graphs or an inter-op
+// scheduler. Returns whether memory is shared. Ops whose inputs did not change since the
+// last call normally keep their outputs from that call, which is only safe when no other
+// tensor can overwrite them, so callers must run every op on every call when it is.
+static bool register_memory_layout(ngraph::pass::Manager& pass_manager,
+                                   size_t alignment,
+                                   bool out_of_order)
+{
+    const char* strategy = getenv("NGRAPH_CPU_MEMORY_STRATEGY");
+    if (strategy == nullptr || *strategy == 0 || out_of_order)
+    {
+        pass_manager.register_pass<ngraph::pass::MemoryLayout>(alignment, true);
+        return false;
+    }
+    pass_manager.register_pass<ngraph::pass::MemoryLayout>(
+        alignment, false, ngraph::pass::MemoryLayout::get_strategy(strategy));
+    return true;
+}
+
+// FunctionCalls are inlined into the caller so that callee ops run in the caller's executor out
+// of its memory pool, instead of through a separate call frame with tensor views built on every
+// call. Setting NGRAPH_CPU_DISABLE_INLINING keeps the calls.
+static void register_inliner(ngraph::pass::Manager& pass_manager)
+{
+    if (getenv("NGRAPH_CPU_DISABLE_INLINING") == nullptr)
+    {
+        pass_manager.register_pass<ngraph::pass::Inliner>(
+            make_shared<ngraph::pass::InlineSmallCalls>(numeric_limits<size_t>::max(),
+                                                        numeric_limits<size_t>::max()));
+    }
+}
+
+// MKLDNN primitives of consecutive ops can be queued and run in one stream submission as
+// long as no op in between touches tensor memory directly. Batching is disabled by setting
+// NGRAPH_CPU_DISABLE_MKLDNN_BATCHING, and when ops are timed or may run out of order.
+static bool batch_mkldnn_primitives(bool out_of_order, bool emit_timing)
+{
+    return !out_of_order && !emit_timing && !runtime::cpu::IsTracingEnabled() &&
+           std::getenv("NGRAPH_CPU_DISABLE_MKLDNN_BATCHING") == nullptr;
+}
+
+// True if node only accesses tensor memory through MKLDNN primitives. Ops which also read or
+// write tensors directly flush queued primitives first.
+static bool is_mkldnn_only(const Node* node)
+{
+    return dynamic_cast<const runtime::cpu::op::ConvertLayout*>(node) != nullptr ||
+           runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node);
+}
+
+// Rough cost of an op for the inter-op scheduler: the bytes it reads and writes plus the
+// multiply-adds of contractions. Only the relative order matters, and measured op times
+// replace these after the first call.
+static double estimate_op_cost(const Node* node)
+{
+    double cost = 0;
+    for (const descriptor::Input& input : node->get_inputs())
+    {
+        cost += input.get_tensor().size();
+    }
+    for (const descriptor::Output& output : node->get_outputs())
+    {
+        cost += output.get_tensor().size();
+    }
+
+    double output_elements = static_cast<double>(shape_size(node->get_output_shape(0)));
+    if (auto dot = dynamic_cast<const ngraph::op::Dot*>(node))
+    {
+        const Shape& arg0_shape = dot->get_argument(0)->get_shape();
+        double reduction = 1;
+        for (size_t i = arg0_shape.size() - dot->get_reduction_axes_count();
+             i < arg0_shape.size();
+             i++)
+        {
+            reduction *= arg0_shape[i];
+        }
+        cost += 2 * output_elements * reduction;
+    }
+    else if (dynamic_cast<const ngraph::op::Convolution*>(node) ||
+             dynamic_cast<const ngraph::op::ConvolutionBias*>(node) ||
+             dynamic_cast<const ngraph::op::ConvolutionBiasAdd*>(node) ||
+             dynamic_cast<const ngraph::op::ConvolutionRelu*>(node))
+    {
+        // Each output element is a dot product with one output channel's filter
+        const Shape& filters_shape = node->get_argument(1)->get_shape();
+        cost += 2 * output_elements * shape_size(filters_shape) / max<size_t>(filters_shape[0], 1);
+    }
+    return cost;
+}
+
+// Constant subgraphs with larger outputs, such as broadcasts of scalars, are computed on the
+// first call instead of being folded into constants at compile time
+static const size_t s_max_folded_constant_size = 1 << 20;
+
+// Scheduled calls on an executor state only fold their op times into the shared cost
+// estimates once every this many calls
+static const size_t s_op_cost_update_interval = 16;
+
 #if !defined(NGRAPH_DEX_ONLY)
 
 static const string s_output_dir = "cpu_codegen";
@@ -233,6 +370,26 @@ static string emit_string_array(const vector<string>& s, size_t max_line_length)
     return ss.str();
 }
 
+// Returns the path, without extension, of the persistent codegen cache entry for code or an
+// empty string if NGRAPH_CPU_CODEGEN_CACHE_DIR is not set. Entries are keyed on the generated
+// source, the host CPU the object code is tuned for and the nGraph version.
+static string get_codegen_cache_entry(const string& code)
+{
+    const char* cache_dir = getenv("NGRAPH_CPU_CODEGEN_CACHE_DIR");
+    if (cache_dir == nullptr || *cache_dir == 0)
+    {
+        return "";
+    }
+    hash<string> hasher;
+    size_t key = hash_combine({hasher(code),
+                               hasher(codegen::ExecutionEngine::get_host_cpu_name()),
+                               hasher(NGRAPH_VERSION)});
+    stringstream ss;
+    ss << hex << setw(16) << setfill('0') << key;
+    file_util::make_directory(cache_dir);
+    return file_util::path_join(cache_dir, ss.str());
+}
+
 static StaticInitializers s_static_initializers;
 
 #define TI(x) type_index(typeid(x))
@@ -299,6 +456,10 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::ConvolutionBias), &runtime::cpu::CPU_Emitter::emit<op::ConvolutionBias>},
     {TI(ngraph::op::ConvolutionRelu), &runtime::cpu::CPU_Emitter::emit<op::ConvolutionRelu>},
     {TI(ngraph::op::ConvolutionBiasAdd), &runtime::cpu::CPU_Emitter::emit<op::ConvolutionBiasAdd>},
+    {TI(ngraph::op::QuantizedConvolution),
+     &runtime::cpu::CPU_Emitter::emit<op::QuantizedConvolution>},
+    {TI(ngraph::op::Quantize), &runtime::cpu::CPU_Emitter::emit<op::Quantize>},
+    {TI(ngraph::op::Dequantize), &runtime::cpu::CPU_Emitter::emit<op::Dequantize>},
     // conv+bias backprop for data share the same implementation as ConvolutionBackpropData
     {TI(ngraph::op::ConvolutionBiasBackpropFiltersBias),
      &runtime::cpu::CPU_Emitter::emit<op::ConvolutionBiasBackpropFiltersBias>},
@@ -334,6 +495,9 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::SigmoidMultiplyBackprop),
      &runtime::cpu::CPU_Emitter::emit<op::SigmoidMultiplyBackprop>},
     {TI(ngraph::op::Softmax), &runtime::cpu::CPU_Emitter::emit<op::Softmax>},
+    {TI(ngraph::op::SGDUpdate), &runtime::cpu::CPU_Emitter::emit<op::SGDUpdate>},
+    {TI(ngraph::op::MomentumUpdate), &runtime::cpu::CPU_Emitter::emit<op::MomentumUpdate>},
+    {TI(ngraph::op::AdamUpdate), &runtime::cpu::CPU_Emitter::emit<op::AdamUpdate>},
     {TI(ngraph::op::SigmoidBackprop), &runtime::cpu::CPU_Emitter::emit<op::SigmoidBackprop>},
     {TI(ngraph::op::And), &runtime::cpu::CPU_Emitter::emit<op::And>},
     {TI(ngraph::op::Or), &runtime::cpu::CPU_Emitter::emit<op::Or>},
@@ -366,11 +530,19 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
 
+    m_batch_mkldnn_primitives = batch_mkldnn_primitives(m_use_tbb, m_emit_timing);
+
+    // Generated code bakes MKLDNN primitive indices and op enable flags into
+    // module globals, so calls into a compiled module are serialized
+    m_concurrency = 1;
+    m_free_states.push_back(0);
+
     ngraph::pass::Manager pass_manager;
 
     //nv_cwi is required only by some frontends
     //in which case they should run this pass(CPUWorkspaceInsertion) explicitly
     NodeVector nv_cwi;
+    register_inliner(pass_manager);
     pass_manager.register_pass<ngraph::pass::NopElimination>();
     // TODO (pruthvi): Enable all the disabeled RNN fusion graph pass after fixing
     // failing mxnet unit tests.
@@ -384,6 +556,8 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     pass_manager.register_pass<ngraph::pass::CoreFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUCollapseDims>();
+    pass_manager.register_pass<ngraph::pass::ConstantFolding>(s_max_folded_constant_size);
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUWorkspaceInsertion>(nv_cwi);
     pass_manager.register_pass<runtime::cpu::pass::CPUAssignment>(this);
     pass_manager.register_pass<runtime::cpu::pass::CPULayout>(this);
@@ -399,7 +573,8 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     pass_manager.register_pass<ngraph::pass::CommonFunctionCollection>(
         femitter, node_function_map, common_function_string);
     pass_manager.register_pass<ngraph::pass::Liveness>();
-    pass_manager.register_pass<ngraph::pass::MemoryLayout>(size_t(s_memory_pool_alignment), true);
+    m_memory_sharing =
+        register_memory_layout(pass_manager, size_t(s_memory_pool_alignment), m_use_tbb);
     pass_manager.run_passes(m_function);
 
     unordered_map<shared_ptr<Function>, list<shared_ptr<Node>>> function_ordered_ops;
@@ -426,6 +601,8 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/cpu/cpu_eigen_utils.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
+#include "ngraph/runtime/cpu/cpu_tracing.hpp"
+#include "ngraph/runtime/cpu/kernel/dot.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/reference/and.hpp"
 #include "ngraph/runtime/reference/argmax.hpp"
@@ -435,6 +612,7 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/broadcast.hpp"
 #include "ngraph/runtime/reference/concat.hpp"
 #include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
 #include "ngraph/runtime/reference/lrn.hpp"
 #include "ngraph/runtime/reference/max.hpp"
@@ -445,6 +623,8 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/or.hpp"
 #include "ngraph/runtime/reference/pad.hpp"
 #include "ngraph/runtime/reference/product.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/runtime/reference/quantized_convolution.hpp"
 #include "ngraph/runtime/reference/reduce.hpp"
 #include "ngraph/runtime/reference/reduce_window.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
@@ -458,10 +638,14 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/strides.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph::runtime::cpu::eigen;
 using namespace ngraph::runtime;
+using ngraph::bfloat16;
+using ngraph::float16;
 
 )";
 
@@ -543,14 +727,29 @@ using namespace ngraph::runtime;
                 m_active_constants.push_back(node);
                 shared_ptr<descriptor::TensorView> tv = node->get_outputs()[0].get_tensor_view();
                 string type = tv->get_tensor().get_element_type().c_type_string();
-                writer << "static " << type << "* " << tv->get_tensor().get_name() << " = (("
-                       << type << "*)(" << c->get_data_ptr() << "));\n";
+                writer << "static " << type << "* " << tv->get_tensor().get_name() << ";\n";
                 m_variable_name_map[tv->get_tensor().get_name()] = tv->get_tensor().get_name();
                 m_tensor_roles[tv->get_tensor().get_name()] = CPUTensorRole::CONSTANT;
             }
         }
     }
 
+    // Constant addresses are bound after loading rather than baked into the source so that
+    // identical graphs produce identical code in every process
+    writer << "extern \"C\" void set_constants(void** constants)\n";
+    writer << "{\n";
+    writer.indent++;
+    for (size_t i = 0; i < m_active_constants.size(); i++)
+    {
+        shared_ptr<descriptor::TensorView> tv =
+            m_active_constants[i]->get_outputs()[0].get_tensor_view();
+        writer << tv->get_tensor().get_name() << " = ("
+               << tv->get_tensor().get_element_type().c_type_string() << "*)(constants[" << i
+               << "]);\n";
+    }
+    writer.indent--;
+    writer << "}\n\n";
+
     writer << "// Declare all functions\n";
     for (shared_ptr<Function> f : pass_manager.get_state().get_functions())
     {
@@ -622,11 +821,10 @@ using namespace ngraph::runtime;
         writer << "{\n";
         writer.indent++;
 
-        // Execution tracing support
-        if (runtime::cpu::IsTracingEnabled() && current_function->get_name() == m_function_name)
+        // Execution tracing support. Ops of a TBB flow graph declare their own start time.
+        if (current_function->get_name() == m_function_name && !m_use_tbb)
         {
-            writer << "cpu::Timestamp start_ts;\n"
-                   << "int profiler_count = 0;\n\n";
+            writer << "cpu::Timestamp start_ts;\n\n";
         }
 
         if (temporaries_used)
@@ -741,6 +939,10 @@ using namespace ngraph::runtime;
             // Emit operation prologue
             if (!node->is_parameter() && !node->is_constant())
             {
+                if (m_batch_mkldnn_primitives && !is_mkldnn_only(node.get()))
+                {
+                    writer << "cpu::mkldnn_utils::mkldnn_flush_primitives(ctx);\n";
+                }
                 if (current_function->get_name() == m_function_name)
                 {
                     m_op_attrs.emplace_back(
@@ -757,10 +959,16 @@ using namespace ngraph::runtime;
                               "(*(ctx->G), [&](const tbb::flow::continue_msg &msg)\n{\n";
                     writer.indent++;
                 }
-                if (runtime::cpu::IsTracingEnabled() &&
-                    current_function->get_name() == m_function_name)
+                if (current_function->get_name() == m_function_name)
                 {
+                    if (m_use_tbb)
+                    {
+                        writer << "cpu::Timestamp start_ts;\n";
+                    }
+                    writer << "if (ctx->trace_session)\n";
+                    writer.block_begin();
                     writer << "start_ts = cpu::Clock::now();\n";
+                    writer.block_end();
                 }
             }
 
@@ -802,7 +1010,8 @@ using namespace ngraph::runtime;
 
                 // Always enable nodes computing output tensors or nodes whose outputs might get
                 // overwritten due to inplace kernels
-                if (computes_result(node.get()) || possibly_overwritten(node.get()))
+                if (m_memory_sharing || computes_result(node.get()) ||
+                    possibly_overwritten(node.get()))
                 {
                     writer << " || 1";
                 }
@@ -841,6 +1050,11 @@ using namespace ngraph::runtime;
                 if ((!node->is_parameter() && !node->is_constant()) ||
                     std::getenv("NGRAPH_CPU_CHECK_PARMS_AND_CONSTS"))
                 {
+                    if (m_batch_mkldnn_primitives && (std::getenv("NGRAPH_CPU_NAN_CHECK") ||
+                                                      std::getenv("NGRAPH_CPU_INF_CHECK")))
+                    {
+                        writer << "cpu::mkldnn_utils::mkldnn_flush_primitives(ctx);\n";
+                    }
                     if (std::getenv("NGRAPH_CPU_NAN_CHECK"))
                     {
                         generate_isnan_isinf_check(writer, node, out, "isnan");
@@ -870,12 +1084,12 @@ using namespace ngraph::runtime;
                 writer.indent--;
                 writer << "}\n";
                 emit_debug_function_exit(writer, node.get(), in, out);
-                if (runtime::cpu::IsTracingEnabled() &&
-                    current_function->get_name() == m_function_name)
+                if (current_function->get_name() == m_function_name)
                 {
-                    writer << "ctx->op_durations[profiler_count++] = "
-                           << "(std::chrono::duration_cast<cpu::Timescale>(cpu::Clock::now() - "
-                              "start_ts)).count();\n";
+                    writer << "if (ctx->trace_session)\n";
+                    writer.block_begin();
+                    writer << "cpu::trace_op(ctx, " << m_op_attrs.size() - 1 << ", start_ts);\n";
+                    writer.block_end();
                 }
                 if (m_use_tbb)
                 {
@@ -920,6 +1134,10 @@ using namespace ngraph::runtime;
                    << "->try_put(tbb::flow::continue_msg());\n";
             writer << "try { ctx->G->wait_for_all(); } catch(...) { throw; }\n";
         }
+        if (m_batch_mkldnn_primitives)
+        {
+            writer << "cpu::mkldnn_utils::mkldnn_flush_primitives(ctx);\n";
+        }
         writer << "ctx->first_iteration = false;\n";
 
         writer.indent--;
@@ -940,14 +1158,49 @@ using namespace ngraph::runtime;
 
     m_compiler->set_precompiled_header_source(pch_header_source);
 
-    auto codegen_module = m_compiler->compile(code);
+    // Timer globals need static constructors which are not run for cached object files
+    string cache_entry = m_emit_timing ? "" : get_codegen_cache_entry(code);
+    bool cache_hit = false;
+    if (!cache_entry.empty())
+    {
+        // The source is stored next to the object so that a hash collision can never
+        // load the wrong code
+        string cached_source = cache_entry + ".cpp";
+        string cached_object = cache_entry + ".o";
+        cache_hit = file_util::exists(cached_object) && file_util::exists(cached_source) &&
+                    file_util::read_file_to_string(cached_source) == code &&
+                    m_execution_engine->add_object_file(cached_object);
+        if (cache_hit)
+        {
+            s_codegen_cache_hit_count++;
+        }
+        else
+        {
+            m_execution_engine->set_object_cache_file(cached_object);
+        }
+    }
 
-    if (codegen_module == nullptr)
+    if (!cache_hit)
     {
-        throw runtime_error("function failed to compile");
+        auto codegen_module = m_compiler->compile(code);
+
+        if (codegen_module == nullptr)
+        {
+            throw runtime_error("function failed to compile");
+        }
+        m_execution_engine->add_module(codegen_module);
     }
-    m_execution_engine->add_module(codegen_module);
     m_execution_engine->finalize();
+
+    if (!cache_entry.empty() && !cache_hit)
+    {
+        string tmp = cache_entry + ".cpp.tmp";
+        ofstream source_out(tmp);
+        source_out << code;
+        source_out.close();
+        rename(tmp.c_str(), (cache_entry + ".cpp").c_str());
+    }
+
     m_compiled_function = m_execution_engine->find_function<EntryPoint_t>(m_function_name);
 
     if (m_compiled_function == nullptr)
@@ -955,6 +1208,19 @@ using namespace ngraph::runtime;
         throw runtime_error("could not find compiled function");
     }
 
+    auto set_constants = m_execution_engine->find_function<void(void**)>("set_constants");
+    if (set_constants == nullptr)
+    {
+        throw runtime_error("could not find constant initializer");
+    }
+    vector<void*> constants;
+    for (auto& node : m_active_constants)
+    {
+        constants.push_back(
+            const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr()));
+    }
+    set_constants(constants.data());
+
     // Store layouts assigned for arguments
     for (const auto& parameter : m_function->get_parameters())
     {
@@ -991,6 +1257,9 @@ using namespace ngraph::runtime;
         }
     }
 
+    m_trace_function = runtime::cpu::Tracer::get().register_function(m_function_name, m_op_attrs);
+    m_trace_registered = true;
+
     m_is_compiled = true;
     if (m_release_function)
     {
@@ -1119,12 +1388,15 @@ void runtime::cpu::CPU_ExternalFunction::build()
     }
 
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
+    bool out_of_order = m_use_tbb || m_inter_op_scheduler;
+    m_batch_mkldnn_primitives = batch_mkldnn_primitives(out_of_order, false);
 
     ngraph::pass::Manager pass_manager;
 
     //nv_cwi is required only by some frontends
     //in which case they should run this pass(CPUWorkspaceInsertion) explicitly
     NodeVector nv_cwi;
+    register_inliner(pass_manager);
     pass_manager.register_pass<ngraph::pass::NopElimination>();
     // TODO (pruthvi): Enable all the disabeled RNN fusion graph pass after fixing
     // failing mxnet unit tests.
@@ -1137,6 +1409,8 @@ void runtime::cpu::CPU_ExternalFunction::build()
     pass_manager.register_pass<ngraph::pass::CoreFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUCollapseDims>();
+    pass_manager.register_pass<ngraph::pass::ConstantFolding>(s_max_folded_constant_size);
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPUWorkspaceInsertion>(nv_cwi);
     pass_manager.register_pass<runtime::cpu::pass::CPUAssignment>(this);
     pass_manager.register_pass<runtime::cpu::pass::CPULayout>(this);
@@ -1144,7 +1418,8 @@ void runtime::cpu::CPU_ExternalFunction::build()
     pass_manager.register_pass<ngraph::pass::ResultCopyElimination>();
     pass_manager.register_pass<ngraph::pass::GetOutputElementElimination>();
     pass_manager.register_pass<ngraph::pass::Liveness>();
-    pass_manager.register_pass<ngraph::pass::MemoryLayout>(size_t(s_memory_pool_alignment), true);
+    m_memory_sharing =
+        register_memory_layout(pass_manager, size_t(s_memory_pool_alignment), out_of_order);
     pass_manager.run_passes(m_function, false);
 
     // Store layouts assigned for arguments
@@ -1183,18 +1458,310 @@ void runtime::cpu::CPU_ExternalFunction::build()
         }
     }
 
-    // Build executor
+    // Build one executor state per concurrent call
+    m_executor_states.clear();
+    for (size_t i = 0; i < m_concurrency; i++)
+    {
+        m_executor_states.emplace_back(new ExecutorState);
+        m_free_states.push_back(i);
+        build_executor_state(i);
+    }
+
+    // Record op dependencies for the TBB flow graph
+    for (shared_ptr<Node> node : m_function->get_ordered_ops())
+    {
+        if (node->is_parameter() || node->is_constant())
+        {
+            continue;
+        }
+        vector<string> dependencies;
+        for (auto arg : node->get_arguments())
+        {
+            if (!arg->is_parameter() && !arg->is_constant())
+            {
+                dependencies.push_back(arg->get_name());
+            }
+        }
+        m_op_dependencies.emplace_back(node->get_name(), dependencies);
+    }
+
+    // Number the ops for the inter-op scheduler and rank them by their static cost
+    if (m_inter_op_scheduler)
+    {
+        unordered_map<string, size_t> op_index;
+        for (shared_ptr<Node> node : m_function->get_ordered_ops())
+        {
+            if (node->is_parameter() || node->is_constant())
+            {
+                continue;
+            }
+            op_index[node->get_name()] = m_op_costs.size();
+            m_op_costs.push_back(estimate_op_cost(node.get()));
+        }
+        m_op_graph.dependency_counts.assign(m_op_costs.size(), 0);
+        m_op_graph.successors.assign(m_op_costs.size(), vector<size_t>());
+        for (const auto& dependency : m_op_dependencies)
+        {
+            size_t op = op_index.at(dependency.first);
+            for (const auto& arg_name : dependency.second)
+            {
+                m_op_graph.successors[op_index.at(arg_name)].push_back(op);
+                m_op_graph.dependency_counts[op]++;
+            }
+        }
+        m_op_priority_costs = m_op_costs;
+        m_op_priorities = CPU_InterOpScheduler::get_priorities(m_op_graph, m_op_costs);
+
+        for (auto& state : m_executor_states)
+        {
+            auto functor = state->functors.begin();
+            for (auto& p : state->enables)
+            {
+                state->scheduled_ops.push_back({&p.first, functor, p.second});
+                advance(functor, p.second);
+            }
+            state->op_times.resize(m_op_costs.size());
+        }
+    }
+
+    executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
+        ExecutorState& state = *m_executor_states[ctx->state_index];
+
+        // Contexts of different call frames may take turns on the same executor state,
+        // so intermediates are rebound to this context's pool on every call
+        for (auto& p : state.intermediates_offsets)
+        {
+            p.first.get() = static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
+        }
+
+        for (const auto& p : state.function_input_index)
+        {
+            get<0>(p).get() = inputs[get<1>(p)];
+            get<2>(p).get() = ctx->p_en[get<1>(p)];
+        }
+
+        for (const auto& p : state.function_output_index)
+        {
+            p.first.get() = outputs[p.second];
+        }
+
+        auto functor = state.functors.begin();
+        if (m_use_tbb)
+        {
+            // Build the flow graph
+            if (ctx->first_iteration)
+            {
+                std::unordered_map<
+                    std::string,
+                    tbb::flow::continue_node<tbb::flow::continue_msg, tbb::flow::lightweight>*>
+                    nodename_tbbnode_map;
+                tbb::flow::continue_node<tbb::flow::continue_msg,
+                                         tbb::flow::lightweight>* flowgraph_node_start =
+                    new tbb::flow::continue_node<tbb::flow::continue_msg, tbb::flow::lightweight>(
+                        *(ctx->G), [&](const tbb::flow::continue_msg& msg) {});
+                auto it = state.enable_nodename_list.begin();
+                size_t op_index = 0;
+                for (const auto& p : state.enables)
+                {
+                    std::vector<std::function<void(CPURuntimeContext*)>> ftrs;
+                    for (size_t j = 0; j < p.second; j++)
+                    {
+                        ftrs.push_back(*functor);
+                        std::advance(functor, 1);
+                    }
+
+                    tbb::flow::continue_node<tbb::flow::continue_msg, tbb::flow::lightweight>*
+                        flowgraph_node = new tbb::flow::continue_node<tbb::flow::continue_msg,
+                                                                      tbb::flow::lightweight>(
+                            *(ctx->G),
+                            [&, ctx, ftrs, op_index](const tbb::flow::continue_msg& msg) {
+                                if (p.first(ctx) || ctx->first_iteration)
+                                {
+                                    cpu::Timestamp start_ts;
+                                    if (ctx->trace_session)
+                                    {
+                                        start_ts = cpu::Clock::now();
+                                    }
+                                    for (size_t j = 0; j < p.second; j++)
+                                    {
+                                        ftrs[j](ctx);
+                                    }
+                                    if (ctx->trace_session)
+                                    {
+                                        cpu::trace_op(ctx, op_index, start_ts);
+                                    }
+                                }
+                            });
+                    nodename_tbbnode_map.insert({it->second, flowgraph_node});
+                    it++;
+                    op_index++;
+                }
+
+                for (const auto& dependency : m_op_dependencies)
+                {
+                    auto flowgraph_node = nodename_tbbnode_map[dependency.first];
+                    for (const auto& arg_name : dependency.second)
+                    {
+                        tbb::flow::make_edge(*(nodename_tbbnode_map[arg_name]), *flowgraph_node);
+                    }
+                    if (dependency.second.empty())
+                    {
+                        tbb::flow::make_edge(*flowgraph_node_start, *flowgraph_node);
+                    }
+                }
+            }
+            // Execute the flow graph
+            (static_cast<
+                 tbb::flow::continue_node<tbb::flow::continue_msg, tbb::flow::lightweight>*>(
+                 &(*(ctx->G->begin()))))
+                ->try_put(tbb::flow::continue_msg());
+            try
+            {
+                ctx->G->wait_for_all();
+            }
+            catch (...)
+            {
+                throw;
+            }
+        }
+        else if (m_inter_op_scheduler)
+        {
+            if (state.op_priorities_version != m_op_priorities_version)
+            {
+                lock_guard<mutex> lock(m_op_cost_mutex);
+                state.op_priorities = m_op_priorities;
+                state.op_priorities_version = m_op_priorities_version;
+            }
+            m_inter_op_scheduler->run(m_op_graph, state.op_priorities, [&](size_t i) {
+                // Workers of the scheduler take on the intra-op pool of the call. They only
+                // work for this backend, so they stay on the pool's CPUs between ops.
+                CPU_ThreadPool::Scope thread_pool_scope(m_thread_pool.get(), true);
+                auto& op = state.scheduled_ops[i];
+                if (!((*op.enable)(ctx) || ctx->first_iteration))
+                {
+                    state.op_times[i] = -1;
+                    return;
+                }
+                auto op_start = cpu::Clock::now();
+                auto op_functor = op.functors;
+                for (size_t j = 0; j < op.functor_count; j++)
+                {
+                    (*op_functor++)(ctx);
+                }
+                if (ctx->trace_session)
+                {
+                    cpu::trace_op(ctx, i, op_start);
+                }
+                state.op_times[i] = std::chrono::duration<double, std::nano>(
+                                        cpu::Clock::now() - op_start)
+                                        .count();
+            });
+            if (state.scheduled_calls++ % s_op_cost_update_interval == 0)
+            {
+                update_op_costs(state.op_times);
+            }
+        }
+        else
+        {
+            auto mkldnn_only = state.mkldnn_only.begin();
+            size_t op_index = 0;
+            for (const auto& p : state.enables)
+            {
+                if (!*mkldnn_only++)
+                {
+                    cpu::mkldnn_utils::mkldnn_flush_primitives(ctx);
+                }
+                if (p.first(ctx) || ctx->first_iteration)
+                {
+                    cpu::Timestamp start_ts;
+                    if (ctx->trace_session)
+                    {
+                        start_ts = cpu::Clock::now();
+                    }
+                    for (size_t j = 0; j < p.second; j++)
+                    {
+                        (*functor)(ctx);
+                        std::advance(functor, 1);
+                    }
+                    if (ctx->trace_session)
+                    {
+                        cpu::trace_op(ctx, op_index, start_ts);
+                    }
+                }
+                else
+                {
+                    std::advance(functor, p.second);
+                }
+                op_index++;
+            }
+            cpu::mkldnn_utils::mkldnn_flush_primitives(ctx);
+        }
+        ctx->first_iteration = false;
+    };
+
+    m_trace_function = runtime::cpu::Tracer::get().register_function(m_function_name, m_op_attrs);
+    m_trace_registered = true;
+
+    m_is_built = true;
+
+    if (m_release_function)
+    {
+        release_function();
+    }
+}
+
+void runtime::cpu::CPU_ExternalFunction::update_op_costs(const vector<double>& op_times)
+{
+    lock_guard<mutex> lock(m_op_cost_mutex);
+    for (size_t i = 0; i < op_times.size(); i++)
+    {
+        if (op_times[i] < 0)
+        {
+            continue;
+        }
+        // The first measurement replaces the static estimates, later ones are averaged
+        // in to smooth out noise
+        m_op_costs[i] = m_op_costs_measured ? 0.75 * m_op_costs[i] + 0.25 * op_times[i]
+                                            : op_times[i];
+    }
+
+    // Priorities only change the order of ready ops, so they are recomputed only once the
+    // cost of some op has drifted by more than a quarter since they were last computed
+    bool drifted = !m_op_costs_measured;
+    for (size_t i = 0; i < m_op_costs.size() && !drifted; i++)
+    {
+        drifted = abs(m_op_costs[i] - m_op_priority_costs[i]) > 0.25 * m_op_priority_costs[i];
+    }
+    m_op_costs_measured = true;
+    if (drifted)
+    {
+        m_op_priority_costs = m_op_costs;
+        m_op_priorities = CPU_InterOpScheduler::get_priorities(m_op_graph, m_op_costs);
+        m_op_priorities_version++;
+    }
+}
+
+void runtime::cpu::CPU_ExternalFunction::build_executor_state(size_t state_index)
+{
+    m_building_state = state_index;
+    ExecutorState& state = *m_executor_states[state_index];
+    auto& tensor_data = state.tensor_data;
+    auto& tensor_stale = state.tensor_stale;
+
     // Intermediates
     if (m_function->get_temporary_pool_size())
     {
-        m_memory_buffer_sizes.push_back(m_function->get_temporary_pool_size());
+        if (state_index == 0)
+        {
+            m_memory_buffer_sizes.push_back(m_function->get_temporary_pool_size());
+        }
 
         for (auto& node : m_function->get_ordered_ops())
         {
             for (auto tensor : node->liveness_new_list)
             {
-                intermediates_offsets.emplace_back(tensor_data[tensor->get_name()],
-                                                   tensor->get_pool_offset());
+                state.intermediates_offsets.emplace_back(tensor_data[tensor->get_name()],
+                                                         tensor->get_pool_offset());
                 m_tensor_roles[tensor->get_name()] = CPUTensorRole::INTERMEDIATE;
             }
         }
@@ -1219,9 +1786,9 @@ void runtime::cpu::CPU_ExternalFunction::build()
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
             shared_ptr<descriptor::TensorView> tv = param->get_output_tensor_view(i);
-            function_input_index.emplace_back(tensor_data[tv->get_tensor().get_name()],
-                                              arg_index,
-                                              tensor_stale[tv->get_tensor().get_name()]);
+            state.function_input_index.emplace_back(tensor_data[tv->get_tensor().get_name()],
+                                                    arg_index,
+                                                    tensor_stale[tv->get_tensor().get_name()]);
             m_tensor_roles[tv->get_tensor().get_name()] = CPUTensorRole::INPUT;
             propagate_in_place_input(
                 &param->get_outputs().at(i), tv->get_tensor().get_name(), true);
@@ -1234,7 +1801,7 @@ void runtime::cpu::CPU_ExternalFunction::build()
     {
         shared_ptr<Node> op = m_function->get_output_op(i);
         shared_ptr<descriptor::TensorView> tv = op->get_output_tensor_view();
-        function_output_index.emplace_back(tensor_data[tv->get_tensor().get_name()], i);
+        state.function_output_index.emplace_back(tensor_data[tv->get_tensor().get_name()], i);
         m_tensor_roles[tv->get_tensor().get_name()] = CPUTensorRole::OUTPUT;
 
         auto res = std::dynamic_pointer_cast<ngraph::op::Result>(op);
@@ -1242,7 +1809,8 @@ void runtime::cpu::CPU_ExternalFunction::build()
         {
             shared_ptr<descriptor::TensorView> itv =
                 res->get_inputs().at(0).get_output().get_tensor_view();
-            function_output_index.emplace_back(tensor_data[itv->get_tensor().get_name()], i);
+            state.function_output_index.emplace_back(tensor_data[itv->get_tensor().get_name()],
+                                                     i);
             m_tensor_roles[itv->get_tensor().get_name()] = CPUTensorRole::OUTPUT;
             tensor_alias[itv->get_tensor().get_name()] = tv->get_tensor().get_name();
             propagate_in_place_output(
@@ -1282,12 +1850,17 @@ void runtime::cpu::CPU_ExternalFunction::build()
             out_names.push_back(tv->get_tensor().get_name());
         }
 
-        m_op_attrs.emplace_back(node->description(), out_names, in_names);
+        if (state_index == 0)
+        {
+            m_op_attrs.emplace_back(node->description(), out_names, in_names);
+        }
 
+        auto& functors = state.functors;
         size_t functor_count = functors.size();
         handler->second(this, node.get(), in, out);
 
-        bool disable_caching = computes_result(node.get()) || possibly_overwritten(node.get());
+        bool disable_caching = m_memory_sharing || computes_result(node.get()) ||
+                               possibly_overwritten(node.get());
 
         vector<reference_wrapper<bool>> in_stale, out_stale;
         for (const auto& name : in_names)
@@ -1337,190 +1910,15 @@ void runtime::cpu::CPU_ExternalFunction::build()
             };
         }
 
-        enables.emplace_back(make_pair(enable, functors.size() - functor_count));
-        enable_nodename_list.emplace_back(make_pair(enable, node->get_name()));
-    }
-
-    executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
-        cpu::Timestamp start_ts;
-        int profiler_count = 0;
-
-        if (ctx->first_iteration)
-        {
-            for (auto& p : intermediates_offsets)
-            {
-                p.first.get() = static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
-            }
-        }
-
-        for (const auto& p : function_input_index)
-        {
-            get<0>(p).get() = inputs[get<1>(p)];
-            get<2>(p).get() = ctx->p_en[get<1>(p)];
-        }
-
-        for (const auto& p : function_output_index)
-        {
-            p.first.get() = outputs[p.second];
-        }
-
-        auto functor = functors.begin();
-        if (m_use_tbb)
-        {
-            // Build the flow graph
-            if (ctx->first_iteration)
-            {
-                std::unordered_map<
-                    std::string,
-                    tbb::flow::continue_node<tbb::flow::continue_msg, tbb::flow::lightweight>*>
-                    nodename_tbbnode_map;
-                tbb::flow::continue_node<tbb::flow::continue_msg,
-                                         tbb::flow::lightweight>* flowgraph_node_start =
-                    new tbb::flow::continue_node<tbb::flow::continue_msg, tbb::flow::lightweight>(
-                        *(ctx->G), [&](const tbb::flow::continue_msg& msg) {});
-                auto it = enable_nodename_list.begin();
-                for (const auto& p : enables)
-                {
-                    std::vector<std::function<void(CPURuntimeContext*)>> ftrs;
-                    for (size_t j = 0; j < p.second; j++)
-                    {
-                        ftrs.push_back(*functor);
-                        std::advance(functor, 1);
-                    }
-
-                    tbb::flow::continue_node<tbb::flow::continue_msg, tbb::flow::lightweight>*
-                        flowgraph_node = new tbb::flow::continue_node<tbb::flow::continue_msg,
-                                                                      tbb::flow::lightweight>(
-                            *(ctx->G), [&, ftrs](const tbb::flow::continue_msg& msg) {
-                                if (p.first(ctx) || ctx->first_iteration)
-                                {
-                                    for (size_t j = 0; j < p.second; j++)
-                                    {
-                                        if (runtime::cpu::IsTracingEnabled())
-                                        {
-                                            start_ts = cpu::Clock::now();
-                                        }
-                                        ftrs[j](ctx);
-                                        if (runtime::cpu::IsTracingEnabled())
-                                        {
-                                            ctx->op_durations[profiler_count++] =
-                                                (std::chrono::duration_cast<cpu::Timescale>(
-                                                     cpu::Clock::now() - start_ts))
-                                                    .count();
-                                        }
-                                    }
-                                }
-                                else
-                                {
-                                    if (runtime::cpu::IsTracingEnabled())
-                                    {
-                                        for (size_t j = 0; j < p.second; j++)
-                                        {
-                                            ctx->op_durations[profiler_count++] = 0;
-                                        }
-                                    }
-                                }
-                            });
-                    nodename_tbbnode_map.insert({it->second, flowgraph_node});
-                    it++;
-                }
-
-                traverse_nodes(
-                    m_function, [&flowgraph_node_start, &nodename_tbbnode_map](shared_ptr<Node> n) {
-                        if (!n->is_parameter() && !n->is_constant())
-                        {
-                            bool is_head = true;
-                            for (auto arg : n->get_arguments())
-                            {
-                                if (!arg->is_parameter() && !arg->is_constant())
-                                {
-                                    is_head = false;
-                                    tbb::flow::make_edge(*(nodename_tbbnode_map[arg->get_name()]),
-                                                         *(nodename_tbbnode_map[n->get_name()]));
-                                }
-                            }
-                            if (is_head)
-                            {
-                                tbb::flow::make_edge(*flowgraph_node_start,
-                                                     *(nodename_tbbnode_map[n->get_name()]));
-                            }
-                        }
-                    });
-
-                if (m_release_function)
-                {
-                    release_function();
-                }
-            }
-            // Execute the flow graph
-            (static_cast<
-                 tbb::flow::continue_node<tbb::flow::continue_msg, tbb::flow::lightweight>*>(
-                 &(*(ctx->G->begin()))))
-                ->try_put(tbb::flow::continue_msg());
-            try
-            {
-                ctx->G->wait_for_all();
-            }
-            catch (...)
-            {
-                throw;
-            }
-        }
-        else
-        {
-            for (const auto& p : enables)
-            {
-                if (p.first(ctx) || ctx->first_iteration)
-                {
-                    for (size_t j = 0; j < p.second; j++)
-                    {
-                        if (runtime::cpu::IsTracingEnabled())
-                        {
-                            start_ts = cpu::Clock::now();
-                        }
-                        (*functor)(ctx);
-                        if (runtime::cpu::IsTracingEnabled())
-                        {
-                            ctx->op_durations[profiler_count++] =
-                                (std::chrono::duration_cast<cpu::Timescale>(cpu::Clock::now() -
-                                                                            start_ts))
-                                    .count();
-                        }
-
-                        std::advance(functor, 1);
-                    }
-                }
-                else
-                {
-                    if (runtime::cpu::IsTracingEnabled())
-                    {
-                        for (size_t j = 0; j < p.second; j++)
-                        {
-                            ctx->op_durations[profiler_count++] = 0;
-                        }
-                    }
-                    std::advance(functor, p.second);
-                }
-            }
-        }
-        ctx->first_iteration = false;
-
-        if (runtime::cpu::IsTracingEnabled())
-        {
-            assert(m_op_attrs.size() == profiler_count);
-        }
-    };
-
-    m_is_built = true;
-
-    if (m_release_function && !m_use_tbb)
-    {
-        release_function();
+        state.enables.emplace_back(make_pair(enable, functors.size() - functor_count));
+        state.mkldnn_only.push_back(is_mkldnn_only(node.get()));
+        state.enable_nodename_list.emplace_back(make_pair(enable, node->get_name()));
     }
 }
 
 void*& runtime::cpu::CPU_ExternalFunction::get_tensor_data(const std::string& name)
 {
+    auto& tensor_data = m_executor_states[m_building_state]->tensor_data;
     if (tensor_alias.count(name))
     {
         return tensor_data[tensor_alias[name]];
@@ -1550,6 +1948,27 @@ shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
                                                             m_compiled_function);
 }
 
+size_t runtime::cpu::CPU_ExternalFunction::acquire_executor_state()
+{
+    unique_lock<mutex> lock(m_state_mutex);
+    while (m_free_states.empty())
+    {
+        m_state_available.wait(lock);
+    }
+    size_t state_index = m_free_states.back();
+    m_free_states.pop_back();
+    return state_index;
+}
+
+void runtime::cpu::CPU_ExternalFunction::release_executor_state(size_t state_index)
+{
+    {
+        lock_guard<mutex> lock(m_state_mutex);
+        m_free_states.push_back(state_index);
+    }
+    m_state_available.notify_one();
+}
+
 const runtime::cpu::LayoutDescriptorPtrs&
     runtime::cpu::CPU_ExternalFunction::get_parameter_layout_descriptors()
 {
@@ -16,10 +16,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
@@ -37,6 +40,7 @@
 
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_inter_op_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
@@ -50,6 +54,7 @@ namespace ngraph
             class CPU_ExternalFunction;
             class CPU_Emitter;
             class CPU_CallFrame;
+            class CPU_ThreadPool;
 
 #if !defined(NGRAPH_DEX_ONLY)
 
@@ -94,6 +99,9 @@ namespace ngraph
                                      bool release_function = true);
                 ~CPU_ExternalFunction();
                 std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame> make_call_frame();
+                // Number of codegen compiles in this process that loaded their object code from
+                // the NGRAPH_CPU_CODEGEN_CACHE_DIR cache
+                static size_t get_codegen_cache_hit_count();
 
                 const LayoutDescriptorPtrs& get_parameter_layout_descriptors();
                 const LayoutDescriptorPtrs& get_result_layout_descriptors();
@@ -102,6 +110,8 @@ namespace ngraph
                     return m_memory_buffer_sizes;
                 }
                 const std::vector<OpAttributes>& get_op_attrs() const { return m_op_attrs; }
+                // Identifies the ops of m_op_attrs in records of the tracer
+                uint32_t get_trace_function() const { return m_trace_function; }
                 const std::unique_ptr<MKLDNNEmitter>& get_mkldnn_emitter() const
                 {
                     return m_mkldnn_emitter;
@@ -112,11 +122,16 @@ namespace ngraph
                 // Temporary Memory Pool alignment
                 static constexpr size_t s_memory_pool_alignment = 4096;
 
+                // Builders append to the functor list and bind to the tensor pointers of
+                // the executor state currently under construction
                 std::list<std::function<void(CPURuntimeContext*)>>& get_functors()
                 {
-                    return functors;
+                    return m_executor_states[m_building_state]->functors;
+                }
+                std::unordered_map<std::string, void*>& get_tensor_data()
+                {
+                    return m_executor_states[m_building_state]->tensor_data;
                 }
-                std::unordered_map<std::string, void*>& get_tensor_data() { return tensor_data; }
                 void*& get_tensor_data(const std::string& name);
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>&
                     get_executor()
@@ -129,6 +144,26 @@ namespace ngraph
                     return callees;
                 }
                 bool is_direct_execution() const { return m_direct_execution; }
+                // True if consecutive MKLDNN ops are submitted to MKLDNN in one stream
+                bool is_batching_mkldnn_primitives() const { return m_batch_mkldnn_primitives; }
+                // Number of calls that may execute concurrently on this function
+                size_t get_concurrency() const { return m_concurrency; }
+                // Scheduler that runs independent ops in parallel under direct execution,
+                // or nullptr if ops run one after another
+                const std::shared_ptr<CPU_InterOpScheduler>& get_inter_op_scheduler() const
+                {
+                    return m_inter_op_scheduler;
+                }
+                // Intra-op pool that calls run on, or nullptr for the process-wide pool
+                const std::shared_ptr<CPU_ThreadPool>& get_thread_pool() const
+                {
+                    return m_thread_pool;
+                }
+                // Check out an executor state for the duration of one call. Blocks until
+                // one is available.
+                size_t acquire_executor_state();
+                void release_executor_state(size_t state_index);
+
             protected:
                 void build();
 
@@ -150,6 +185,10 @@ namespace ngraph
                                                std::string output_name,
                                                bool dex);
                 bool computes_result(Node* node);
+                void build_executor_state(size_t state_index);
+                // Blends the op times measured by one scheduled call into the op costs and
+                // recomputes the op priorities
+                void update_op_costs(const std::vector<double>& op_times);
 
 #if !defined(NGRAPH_DEX_ONLY)
                 void emit_debug_function_entry(codegen::CodeWriter& writer,
@@ -203,28 +242,82 @@ namespace ngraph
                 LayoutDescriptorPtrs result_layout_descriptors;
                 std::vector<size_t> m_memory_buffer_sizes;
                 std::vector<OpAttributes> m_op_attrs;
+                uint32_t m_trace_function;
+                bool m_trace_registered;
 
                 std::unique_ptr<MKLDNNEmitter> m_mkldnn_emitter;
 
                 std::string m_function_name;
 
-                std::list<std::function<void(CPURuntimeContext*)>> functors;
-                std::list<std::pair<std::function<bool(CPURuntimeContext*)>, size_t>> enables;
-                std::list<std::pair<std::function<bool(CPURuntimeContext*)>, std::string>>
-                    enable_nodename_list;
+                // Functors and tensor pointers used by a single in-flight call. Each
+                // concurrently executing call owns one of these.
+                struct ExecutorState
+                {
+                    std::list<std::function<void(CPURuntimeContext*)>> functors;
+                    std::list<std::pair<std::function<bool(CPURuntimeContext*)>, size_t>> enables;
+                    // Whether each op in enables only runs MKLDNN primitives
+                    std::list<bool> mkldnn_only;
+                    std::list<std::pair<std::function<bool(CPURuntimeContext*)>, std::string>>
+                        enable_nodename_list;
+                    std::unordered_map<std::string, void*> tensor_data;
+                    std::unordered_map<std::string, bool> tensor_stale;
+                    std::list<std::pair<std::reference_wrapper<void*>, size_t>>
+                        intermediates_offsets;
+                    std::list<std::tuple<std::reference_wrapper<void*>,
+                                         size_t,
+                                         std::reference_wrapper<bool>>>
+                        function_input_index;
+                    std::list<std::pair<std::reference_wrapper<void*>, size_t>>
+                        function_output_index;
+
+                    // Ops indexed as in m_op_graph, for the inter-op scheduler
+                    struct ScheduledOp
+                    {
+                        std::function<bool(CPURuntimeContext*)>* enable;
+                        std::list<std::function<void(CPURuntimeContext*)>>::iterator functors;
+                        size_t functor_count;
+                    };
+                    std::vector<ScheduledOp> scheduled_ops;
+                    std::vector<double> op_priorities;
+                    // Value of m_op_priorities_version when op_priorities was copied
+                    size_t op_priorities_version = 0;
+                    // Nanoseconds each op took in the last call, negative if it was skipped
+                    std::vector<double> op_times;
+                    size_t scheduled_calls = 0;
+                };
+
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>
                     executor;
-                std::unordered_map<std::string, void*> tensor_data;
-                std::unordered_map<std::string, bool> tensor_stale;
+                std::vector<std::unique_ptr<ExecutorState>> m_executor_states;
+                size_t m_building_state;
                 std::unordered_map<std::string, std::string> tensor_alias;
-                std::list<std::pair<std::reference_wrapper<void*>, size_t>> intermediates_offsets;
-                std::list<
-                    std::tuple<std::reference_wrapper<void*>, size_t, std::reference_wrapper<bool>>>
-                    function_input_index;
-                std::list<std::pair<std::reference_wrapper<void*>, size_t>> function_output_index;
+                // Non-parameter, non-constant arguments of each op, used to wire the TBB
+                // flow graph after the function has been released
+                std::list<std::pair<std::string, std::vector<std::string>>> m_op_dependencies;
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
                 bool m_is_built;
                 bool m_direct_execution;
+                bool m_batch_mkldnn_primitives;
+                // Intermediates share pool memory, so ops may not skip recomputing outputs
+                // that were cached by an earlier call
+                bool m_memory_sharing;
+
+                std::shared_ptr<CPU_InterOpScheduler> m_inter_op_scheduler;
+                std::shared_ptr<CPU_ThreadPool> m_thread_pool;
+                CPU_InterOpScheduler::Graph m_op_graph;
+                // Estimated cost of each op, static until the first scheduled call measures it
+                std::vector<double> m_op_costs;
+                bool m_op_costs_measured;
+                // Costs m_op_priorities was computed from, and a count of the recomputations
+                std::vector<double> m_op_priority_costs;
+                std::vector<double> m_op_priorities;
+                std::atomic<size_t> m_op_priorities_version;
+                std::mutex m_op_cost_mutex;
+
+                size_t m_concurrency;
+                std::vector<size_t> m_free_states;
+                std::mutex m_state_mutex;
+                std::condition_variable m_state_available;
             };
         }
     }
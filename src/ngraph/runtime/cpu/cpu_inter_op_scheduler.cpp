@@ -0,0 +1,188 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "ngraph/runtime/cpu/cpu_inter_op_scheduler.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::CPU_InterOpScheduler::CPU_InterOpScheduler(size_t num_threads)
+    : m_shutdown(false)
+{
+    for (size_t i = 1; i < num_threads; i++)
+    {
+        m_workers.emplace_back(&CPU_InterOpScheduler::worker, this);
+    }
+}
+
+runtime::cpu::CPU_InterOpScheduler::~CPU_InterOpScheduler()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_changed.notify_all();
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void runtime::cpu::CPU_InterOpScheduler::run(const Graph& graph,
+                                             const vector<double>& priorities,
+                                             const function<void(size_t)>& run_op)
+{
+    size_t op_count = graph.dependency_counts.size();
+    if (op_count == 0)
+    {
+        return;
+    }
+
+    Call call;
+    call.graph = &graph;
+    call.priorities = &priorities;
+    call.run_op = &run_op;
+    call.pending = graph.dependency_counts;
+    call.remaining = op_count;
+
+    unique_lock<mutex> lock(m_mutex);
+    for (size_t op = 0; op < op_count; op++)
+    {
+        if (call.pending[op] == 0)
+        {
+            push_ready(&call, op);
+        }
+    }
+    m_changed.notify_all();
+
+    // Help out until the last op of this call is done
+    while (call.remaining > 0)
+    {
+        if (m_ready.empty())
+        {
+            m_changed.wait(lock);
+        }
+        else
+        {
+            execute(lock);
+        }
+    }
+
+    // A wakeup this thread consumed may have been meant for ops of other calls that it now
+    // leaves behind, so hand it on
+    if (!m_ready.empty())
+    {
+        m_changed.notify_one();
+    }
+    lock.unlock();
+
+    if (call.exception)
+    {
+        rethrow_exception(call.exception);
+    }
+}
+
+vector<double>
+    runtime::cpu::CPU_InterOpScheduler::get_priorities(const Graph& graph,
+                                                       const vector<double>& costs)
+{
+    vector<double> priorities(costs.size());
+    for (size_t i = costs.size(); i-- > 0;)
+    {
+        double successor_priority = 0;
+        for (size_t successor : graph.successors[i])
+        {
+            successor_priority = max(successor_priority, priorities[successor]);
+        }
+        priorities[i] = costs[i] + successor_priority;
+    }
+    return priorities;
+}
+
+void runtime::cpu::CPU_InterOpScheduler::worker()
+{
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+        while (!m_shutdown && m_ready.empty())
+        {
+            m_changed.wait(lock);
+        }
+        if (m_shutdown)
+        {
+            return;
+        }
+        execute(lock);
+    }
+}
+
+void runtime::cpu::CPU_InterOpScheduler::execute(unique_lock<mutex>& lock)
+{
+    Call* call = get<1>(m_ready.top());
+    size_t op = get<2>(m_ready.top());
+    m_ready.pop();
+
+    // Once an op of the call has failed the remaining ones are retired without running
+    if (!call->exception)
+    {
+        lock.unlock();
+        exception_ptr exception;
+        try
+        {
+            (*call->run_op)(op);
+        }
+        catch (...)
+        {
+            exception = current_exception();
+        }
+        lock.lock();
+        if (exception && !call->exception)
+        {
+            call->exception = exception;
+        }
+    }
+
+    size_t ready_count = 0;
+    for (size_t successor : call->graph->successors[op])
+    {
+        if (--call->pending[successor] == 0)
+        {
+            push_ready(call, successor);
+            ready_count++;
+        }
+    }
+
+    // call may be destroyed by its owner as soon as remaining drops to zero
+    if (--call->remaining == 0)
+    {
+        m_changed.notify_all();
+    }
+    else if (ready_count > 1)
+    {
+        // This thread picks up one of the new ops itself
+        for (size_t i = 1; i < ready_count; i++)
+        {
+            m_changed.notify_one();
+        }
+    }
+}
+
+void runtime::cpu::CPU_InterOpScheduler::push_ready(Call* call, size_t op)
+{
+    m_ready.emplace((*call->priorities)[op], call, op);
+}
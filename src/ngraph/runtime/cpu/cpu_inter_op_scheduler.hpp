@@ -0,0 +1,113 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Runs the ops of a function graph on a fixed set of threads as their
+            // dependencies complete. Whenever several ops are ready, the one with the
+            // highest priority (longest estimated path to the end of the graph) runs first,
+            // so the critical path is never held up behind cheap side branches.
+            //
+            // A scheduler is shared by all functions compiled on one backend. Several calls
+            // may run on it at once; their ready ops compete in the same queue.
+            class CPU_InterOpScheduler
+            {
+            public:
+                // Dependency structure and priorities of one call. ops are numbered in
+                // topological order.
+                struct Graph
+                {
+                    // Number of predecessors of each op
+                    std::vector<size_t> dependency_counts;
+                    std::vector<std::vector<size_t>> successors;
+                };
+
+                // num_threads includes the calling thread, so num_threads - 1 workers are
+                // started
+                CPU_InterOpScheduler(size_t num_threads);
+                ~CPU_InterOpScheduler();
+                CPU_InterOpScheduler(const CPU_InterOpScheduler&) = delete;
+                CPU_InterOpScheduler& operator=(const CPU_InterOpScheduler&) = delete;
+
+                size_t get_num_threads() const { return m_workers.size() + 1; }
+                // Calls run_op for every op of graph once all its predecessors have returned
+                // and blocks until the last op is done. The calling thread executes ops too.
+                // If run_op throws, no further ops of this call are started and the first
+                // exception is rethrown once the running ones have finished.
+                void run(const Graph& graph,
+                         const std::vector<double>& priorities,
+                         const std::function<void(size_t)>& run_op);
+
+                // Upward rank of each op: its own cost plus the most expensive path through
+                // its successors
+                static std::vector<double> get_priorities(const Graph& graph,
+                                                          const std::vector<double>& costs);
+
+            private:
+                struct Call
+                {
+                    const Graph* graph;
+                    const std::vector<double>* priorities;
+                    const std::function<void(size_t)>* run_op;
+                    std::vector<size_t> pending;
+                    size_t remaining;
+                    std::exception_ptr exception;
+                };
+
+                // (priority, call, op)
+                typedef std::tuple<double, Call*, size_t> ReadyOp;
+                struct ReadyOpCompare
+                {
+                    bool operator()(const ReadyOp& a, const ReadyOp& b) const
+                    {
+                        // Ties go to the op that comes first in topological order
+                        return std::get<0>(a) < std::get<0>(b) ||
+                               (std::get<0>(a) == std::get<0>(b) &&
+                                std::get<2>(a) > std::get<2>(b));
+                    }
+                };
+
+                void worker();
+                // Pops and executes one ready op. Called and returns with m_mutex held.
+                void execute(std::unique_lock<std::mutex>& lock);
+                void push_ready(Call* call, size_t op);
+
+                std::mutex m_mutex;
+                // Signalled when ops become ready, when a call completes and on shutdown
+                std::condition_variable m_changed;
+                std::priority_queue<ReadyOp, std::vector<ReadyOp>, ReadyOpCompare> m_ready;
+                bool m_shutdown;
+                std::vector<std::thread> m_workers;
+            };
+        }
+    }
+}
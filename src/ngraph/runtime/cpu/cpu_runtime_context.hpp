@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <vector>
 
 #define TBB_PREVIEW_GLOBAL_CONTROL 1
 #include <tbb/flow_graph.h>
@@ -50,8 +51,13 @@ namespace ngraph
             extern "C" {
             struct CPURuntimeContext
             {
-                int64_t* op_durations;
+                // Nonzero when the tracer sampled this call, in which case ops report when
+                // they ran with cpu::trace_op
+                uint32_t trace_session;
+                // Identifies the function of this context with the tracer
+                uint32_t trace_function;
                 bool* p_en;
+                size_t state_index;
                 bool first_iteration;
                 mkldnn::primitive* const* mkldnn_primitives;
                 std::vector<AlignedBuffer*> memory_buffers;
@@ -59,6 +65,10 @@ namespace ngraph
                 tbb::flow::graph* G;
                 tbb::global_control* c;
                 tbb::task_scheduler_init* init;
+                // When set, MKLDNN primitives are queued in mkldnn_pending_primitives and
+                // submitted together by mkldnn_flush_primitives
+                bool mkldnn_defer_primitives;
+                std::vector<mkldnn::primitive*> mkldnn_pending_primitives;
             };
             }
         }
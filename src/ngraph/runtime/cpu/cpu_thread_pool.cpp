@@ -0,0 +1,238 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <fstream>
+#include <string>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+// MKLDNN runs its primitives on the OpenMP runtime it is linked with
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Affinity of the calling thread as last read or set through this file. Scopes are entered for
+// every call and every scheduled op, so the affinity is only queried once per thread and only
+// set when it changes.
+struct ThreadCpus
+{
+    bool known = false;
+    vector<int> cpus;
+};
+
+static ThreadCpus& get_thread_cpus_cache()
+{
+    thread_local ThreadCpus thread_cpus;
+    return thread_cpus;
+}
+
+// Affinity of the calling thread, empty if it cannot be queried
+static const vector<int>& get_thread_cpus()
+{
+    ThreadCpus& cache = get_thread_cpus_cache();
+    if (!cache.known)
+    {
+        cache.known = true;
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) == 0)
+        {
+            for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            {
+                if (CPU_ISSET(cpu, &set))
+                {
+                    cache.cpus.push_back(cpu);
+                }
+            }
+        }
+#endif
+    }
+    return cache.cpus;
+}
+
+static void set_thread_cpus(const vector<int>& cpus)
+{
+    ThreadCpus& cache = get_thread_cpus_cache();
+    if (cache.known && cache.cpus == cpus)
+    {
+        return;
+    }
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus)
+    {
+        CPU_SET(cpu, &set);
+    }
+    if (sched_setaffinity(0, sizeof(set), &set) != 0)
+    {
+        // Query again next time rather than trust a mask that was not applied
+        cache.known = false;
+        cache.cpus.clear();
+        return;
+    }
+#endif
+    cache.known = true;
+    cache.cpus = cpus;
+}
+
+// Starts each worker pinned to the next CPU of the pool
+class runtime::cpu::CPU_ThreadPool::Environment : public Eigen::StlThreadEnvironment
+{
+public:
+    Environment(const vector<int>& cpus)
+        : m_cpus(cpus)
+        , m_next_cpu(0)
+    {
+    }
+
+    EnvThread* CreateThread(std::function<void()> f)
+    {
+        if (m_cpus.empty())
+        {
+            return Eigen::StlThreadEnvironment::CreateThread(move(f));
+        }
+        int cpu = m_cpus[m_next_cpu++ % m_cpus.size()];
+        return Eigen::StlThreadEnvironment::CreateThread([cpu, f]() {
+            set_thread_cpus({cpu});
+            f();
+        });
+    }
+
+private:
+    vector<int> m_cpus;
+    size_t m_next_cpu;
+};
+
+runtime::cpu::CPU_ThreadPool::CPU_ThreadPool(size_t num_threads)
+    : m_num_threads(num_threads)
+    , m_scope_count(0)
+{
+    start();
+}
+
+runtime::cpu::CPU_ThreadPool::CPU_ThreadPool(const vector<int>& cpus)
+    : m_num_threads(cpus.size())
+    , m_cpus(cpus)
+    , m_scope_count(0)
+{
+    start();
+}
+
+void runtime::cpu::CPU_ThreadPool::start()
+{
+    if (m_num_threads == 0)
+    {
+        throw ngraph_error("Thread pool must have at least one thread");
+    }
+    m_pool.reset(new Eigen::ThreadPoolTempl<Environment>(static_cast<int>(m_num_threads),
+                                                         Environment(m_cpus)));
+    m_device.reset(new Eigen::ThreadPoolDevice(m_pool.get(), static_cast<int>(m_num_threads)));
+}
+
+runtime::cpu::CPU_ThreadPool::~CPU_ThreadPool()
+{
+    // The device refers to the pool
+    m_device.reset();
+    m_pool.reset();
+}
+
+shared_ptr<runtime::cpu::CPU_ThreadPool>
+    runtime::cpu::CPU_ThreadPool::create_for_numa_node(size_t node)
+{
+    vector<int> cpus = get_numa_node_cpus(node);
+    if (cpus.empty())
+    {
+        throw ngraph_error("No CPUs found for NUMA node " + to_string(node));
+    }
+    return make_shared<CPU_ThreadPool>(cpus);
+}
+
+vector<int> runtime::cpu::CPU_ThreadPool::get_numa_node_cpus(size_t node)
+{
+    // The list looks like "0-3,8-11"
+    vector<int> cpus;
+    ifstream in("/sys/devices/system/node/node" + to_string(node) + "/cpulist");
+    string list;
+    if (!getline(in, list))
+    {
+        return cpus;
+    }
+    for (const string& range : split(list, ',', true))
+    {
+        if (range.empty())
+        {
+            continue;
+        }
+        vector<string> bounds = split(range, '-', true);
+        int first = stoi(bounds.front());
+        int last = stoi(bounds.back());
+        for (int cpu = first; cpu <= last; cpu++)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+runtime::cpu::CPU_ThreadPool::Scope::Scope(CPU_ThreadPool* pool, bool keep_affinity)
+    : m_active(pool != nullptr && &eigen::get_thread_pool_device() != &pool->get_device())
+    , m_previous_device(nullptr)
+    , m_previous_omp_threads(0)
+{
+    if (m_active)
+    {
+        pool->m_scope_count++;
+        m_previous_device = eigen::set_thread_pool_device(&pool->get_device());
+#if defined(_OPENMP)
+        m_previous_omp_threads = omp_get_max_threads();
+        omp_set_num_threads(static_cast<int>(pool->get_num_threads()));
+#endif
+        if (!pool->get_cpus().empty())
+        {
+            if (!keep_affinity)
+            {
+                m_previous_cpus = get_thread_cpus();
+            }
+            set_thread_cpus(pool->get_cpus());
+        }
+    }
+}
+
+runtime::cpu::CPU_ThreadPool::Scope::~Scope()
+{
+    if (m_active)
+    {
+        if (!m_previous_cpus.empty())
+        {
+            set_thread_cpus(m_previous_cpus);
+        }
+#if defined(_OPENMP)
+        omp_set_num_threads(m_previous_omp_threads);
+#endif
+        eigen::set_thread_pool_device(m_previous_device);
+    }
+}
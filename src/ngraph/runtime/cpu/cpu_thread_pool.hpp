@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Intra-op thread pool of a CPU backend. The Eigen kernels of a call run on its
+            // threads, and MKLDNN primitives are limited to the same number of OpenMP
+            // threads, so the two share one budget instead of each sizing itself to the
+            // whole machine. A pool may be pinned to a set of CPUs, for example one NUMA
+            // node, so that backends in one process can each own a socket.
+            class CPU_ThreadPool
+            {
+            public:
+                // num_threads threads that may run on any CPU
+                CPU_ThreadPool(size_t num_threads);
+                // One thread pinned to each of cpus
+                CPU_ThreadPool(const std::vector<int>& cpus);
+                ~CPU_ThreadPool();
+                CPU_ThreadPool(const CPU_ThreadPool&) = delete;
+                CPU_ThreadPool& operator=(const CPU_ThreadPool&) = delete;
+
+                // One thread pinned to each CPU of a NUMA node
+                static std::shared_ptr<CPU_ThreadPool> create_for_numa_node(size_t node);
+                // CPUs of a NUMA node as listed by the kernel, empty if unknown
+                static std::vector<int> get_numa_node_cpus(size_t node);
+
+                size_t get_num_threads() const { return m_num_threads; }
+                // CPUs the pool is pinned to, empty if it is not pinned
+                const std::vector<int>& get_cpus() const { return m_cpus; }
+                Eigen::ThreadPoolDevice& get_device() { return *m_device; }
+                // Number of scopes that have made this pool the intra-op pool of a thread
+                size_t get_scope_count() const { return m_scope_count; }
+                // Makes pool the intra-op pool of the calling thread until the scope is
+                // left: Eigen kernels run on it, OpenMP regions started by MKLDNN use at
+                // most its number of threads, and the thread itself runs on the pool's
+                // CPUs. Nested scopes of the same pool do nothing. pool may be nullptr, in
+                // which case the process-wide pool stays in use. With keep_affinity the
+                // thread stays on the pool's CPUs after the scope, which suits threads that
+                // only ever work for this pool.
+                class Scope
+                {
+                public:
+                    Scope(CPU_ThreadPool* pool, bool keep_affinity = false);
+                    ~Scope();
+                    Scope(const Scope&) = delete;
+                    Scope& operator=(const Scope&) = delete;
+
+                private:
+                    bool m_active;
+                    Eigen::ThreadPoolDevice* m_previous_device;
+                    int m_previous_omp_threads;
+                    std::vector<int> m_previous_cpus;
+                };
+
+            private:
+                class Environment;
+
+                void start();
+
+                size_t m_num_threads;
+                std::vector<int> m_cpus;
+                std::atomic<size_t> m_scope_count;
+                std::unique_ptr<Eigen::ThreadPoolInterface> m_pool;
+                std::unique_ptr<Eigen::ThreadPoolDevice> m_device;
+            };
+        }
+    }
+}
@@ -14,65 +14,308 @@
 * limitations under the License.
 *******************************************************************************/
 
-#include <fstream>
+#include <cstdlib>
 #include <map>
+#include <unistd.h>
 
-#include "cpu_tracing.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_tracing.hpp"
+#include "nlohmann/json.hpp"
 
-void ngraph::runtime::cpu::to_json(nlohmann::json& json, const TraceEvent& event)
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Ring of the calling thread. The tracer holds a second reference, so a ring whose only
+    // owner is the tracer belongs to a thread that exited.
+    thread_local shared_ptr<runtime::cpu::TraceRing> t_ring;
+
+    // How often the flush thread drains the rings while a capture runs
+    const chrono::milliseconds s_flush_period(100);
+}
+
+struct runtime::cpu::Tracer::FunctionOps
+{
+    string Name;
+    vector<OpAttributes> Ops;
+};
+
+runtime::cpu::TraceRing::TraceRing(uint32_t tid)
+    : m_tid(tid)
+    , m_records(new TraceRecord[s_capacity])
+    , m_head(0)
+    , m_tail(0)
+    , m_dropped(0)
+{
+}
+
+bool runtime::cpu::TraceRing::push(const TraceRecord& record)
+{
+    size_t head = m_head.load(memory_order_relaxed);
+    if (head - m_tail.load(memory_order_acquire) == s_capacity)
+    {
+        m_dropped.fetch_add(1, memory_order_relaxed);
+        return false;
+    }
+    m_records[head % s_capacity] = record;
+    m_head.store(head + 1, memory_order_release);
+    return true;
+}
+
+void runtime::cpu::TraceRing::drain(vector<TraceRecord>& records)
+{
+    size_t tail = m_tail.load(memory_order_relaxed);
+    size_t head = m_head.load(memory_order_acquire);
+    for (; tail != head; tail++)
+    {
+        records.push_back(m_records[tail % s_capacity]);
+    }
+    m_tail.store(tail, memory_order_release);
+}
+
+runtime::cpu::Tracer& runtime::cpu::Tracer::get()
+{
+    static Tracer tracer;
+    return tracer;
+}
+
+runtime::cpu::Tracer::Tracer()
+    : m_epoch(Clock::now())
+    , m_session(0)
+    , m_calls(0)
+    , m_sample_interval(1)
+    , m_capture_session(0)
+    , m_next_session(1)
+    , m_next_tid(0)
+    , m_next_function(0)
+    , m_first_event(true)
+    , m_dropped(0)
+    , m_stop_flush(false)
+{
+    const char* file_name = getenv("NGRAPH_CPU_TRACING");
+    if (file_name != nullptr)
+    {
+        string name = file_name;
+        if (name.size() < 5 || name.compare(name.size() - 5, 5, ".json") != 0)
+        {
+            name = "cpu.timeline.json";
+        }
+        const char* interval = getenv("NGRAPH_CPU_TRACING_SAMPLE_INTERVAL");
+        start(name, interval == nullptr ? 1 : strtoul(interval, nullptr, 10));
+    }
+}
+
+runtime::cpu::Tracer::~Tracer()
+{
+    stop();
+}
+
+void runtime::cpu::Tracer::start(const string& file_name, size_t sample_interval)
+{
+    lock_guard<mutex> capture_lock(m_capture_mutex);
+    stop_capture();
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_out.open(file_name);
+        if (!m_out)
+        {
+            throw ngraph_error("Unable to open trace file " + file_name);
+        }
+        m_out << "[";
+        m_first_event = true;
+        m_dropped = 0;
+        m_capture_session = m_next_session++;
+    }
+
+    m_stop_flush = false;
+    m_flush_thread = thread(&Tracer::flush_loop, this);
+
+    m_calls.store(0, memory_order_relaxed);
+    m_sample_interval.store(max(sample_interval, size_t(1)), memory_order_relaxed);
+    m_session.store(m_capture_session, memory_order_release);
+}
+
+void runtime::cpu::Tracer::stop()
+{
+    lock_guard<mutex> capture_lock(m_capture_mutex);
+    stop_capture();
+}
+
+void runtime::cpu::Tracer::stop_capture()
+{
+    if (!m_flush_thread.joinable())
+    {
+        return;
+    }
+
+    // Calls sampled before this point may still be adding records; those arriving after the
+    // last flush are dropped by the next capture
+    m_session.store(0, memory_order_release);
+    {
+        lock_guard<mutex> lock(m_flush_mutex);
+        m_stop_flush = true;
+    }
+    m_flush_wakeup.notify_one();
+    m_flush_thread.join();
+    flush(true);
+}
+
+void runtime::cpu::Tracer::flush_loop()
 {
-    std::map<std::string, std::string> args;
-    for (size_t i = 0; i < event.Inputs.size(); i++)
+    unique_lock<mutex> lock(m_flush_mutex);
+    while (!m_stop_flush)
+    {
+        m_flush_wakeup.wait_for(lock, s_flush_period);
+        lock.unlock();
+        flush(false);
+        lock.lock();
+    }
+}
+
+void runtime::cpu::Tracer::flush(bool finish)
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    vector<TraceRecord> records;
+    for (auto ring = m_rings.begin(); ring != m_rings.end();)
+    {
+        (*ring)->drain(records);
+        m_dropped += (*ring)->take_dropped();
+        if (ring->use_count() == 1)
+        {
+            ring = m_rings.erase(ring);
+        }
+        else
+        {
+            ring++;
+        }
+    }
+
+    unsigned int pid = static_cast<unsigned int>(getpid());
+    for (const TraceRecord& record : records)
+    {
+        auto function = m_functions.find(record.Function);
+        if (record.Session != m_capture_session || function == m_functions.end() ||
+            record.Op >= function->second->Ops.size())
+        {
+            continue;
+        }
+        const OpAttributes& op = function->second->Ops[record.Op];
+
+        map<string, string> args;
+        args["Function"] = function->second->Name;
+        for (size_t i = 0; i < op.Inputs.size(); i++)
+        {
+            args["Input" + to_string(i + 1)] = op.Inputs[i];
+        }
+        for (size_t i = 0; i < op.Outputs.size(); i++)
+        {
+            args["Output" + to_string(i + 1)] = op.Outputs[i];
+        }
+
+        nlohmann::json event{{"ph", "X"},
+                             {"cat", "Op"},
+                             {"name", op.Description},
+                             {"pid", pid},
+                             {"tid", record.TID},
+                             {"ts", record.Start},
+                             {"dur", record.End - record.Start},
+                             {"args", args}};
+        m_out << (m_first_event ? "\n" : ",\n") << event;
+        m_first_event = false;
+    }
+
+    for (uint32_t function : m_retired_functions)
+    {
+        m_functions.erase(function);
+    }
+    m_retired_functions.clear();
+
+    if (finish)
     {
-        args["Input" + std::to_string(i + 1)] = event.Inputs[i];
+        m_out << "\n]\n";
+        m_out.close();
+        if (m_dropped != 0)
+        {
+            NGRAPH_WARN << "CPU trace rings overflowed, " << m_dropped
+                        << " op records were dropped";
+        }
+        m_capture_session = 0;
     }
-    for (size_t i = 0; i < event.Outputs.size(); i++)
+    else
     {
-        args["Output" + std::to_string(i + 1)] = event.Outputs[i];
+        m_out.flush();
     }
+}
+
+uint32_t runtime::cpu::Tracer::register_function(const string& name,
+                                                 const vector<OpAttributes>& op_attrs)
+{
+    auto ops = make_shared<FunctionOps>();
+    ops->Name = name;
+    ops->Ops = op_attrs;
 
-    json = nlohmann::json{{"ph", event.Phase},
-                          {"cat", event.Category},
-                          {"name", event.Name},
-                          {"pid", event.PID},
-                          {"tid", event.TID},
-                          {"ts", event.Timestamp},
-                          {"dur", event.Duration},
-                          {"args", args}};
+    lock_guard<mutex> lock(m_mutex);
+    uint32_t function = m_next_function++;
+    m_functions[function] = ops;
+    return function;
 }
 
-void ngraph::runtime::cpu::GenerateTimeline(const std::vector<OpAttributes>& op_attrs,
-                                            int64_t* op_durations,
-                                            const std::string& file_name)
+void runtime::cpu::Tracer::unregister_function(uint32_t function)
 {
-    nlohmann::json timeline;
-    std::list<TraceEvent> trace;
-    std::ofstream out(file_name);
+    lock_guard<mutex> lock(m_mutex);
+    if (m_capture_session == 0)
+    {
+        m_functions.erase(function);
+    }
+    else
+    {
+        // Records of the function may still wait in the rings
+        m_retired_functions.push_back(function);
+    }
+}
 
-    int64_t ts = 0;
-    for (size_t i = 0; i < op_attrs.size(); i++)
+runtime::cpu::TraceRing* runtime::cpu::Tracer::get_ring()
+{
+    if (!t_ring)
     {
-        trace.emplace_back("X",
-                           "Op",
-                           op_attrs[i].Description,
-                           0,
-                           0,
-                           ts,
-                           op_durations[i],
-                           op_attrs[i].Outputs,
-                           op_attrs[i].Inputs);
-        ts += op_durations[i];
+        lock_guard<mutex> lock(m_mutex);
+        t_ring = make_shared<TraceRing>(m_next_tid++);
+        m_rings.push_back(t_ring);
     }
+    return t_ring.get();
+}
 
-    timeline["traceEvents"] = trace;
-    out << timeline;
-    out.close();
+void runtime::cpu::Tracer::record(uint32_t session,
+                                  uint32_t function,
+                                  uint32_t op,
+                                  const Timestamp& start,
+                                  const Timestamp& end)
+{
+    TraceRing* ring = get_ring();
+    TraceRecord record;
+    record.Session = session;
+    record.Function = function;
+    record.Op = op;
+    record.TID = ring->get_tid();
+    record.Start = chrono::duration_cast<Timescale>(start - m_epoch).count();
+    record.End = chrono::duration_cast<Timescale>(end - m_epoch).count();
+    ring->push(record);
+}
 
-    return;
+void runtime::cpu::trace_op(CPURuntimeContext* ctx, size_t op, const Timestamp& start)
+{
+    Timestamp end = Clock::now();
+    Tracer::get().record(
+        ctx->trace_session, ctx->trace_function, static_cast<uint32_t>(op), start, end);
 }
 
-bool ngraph::runtime::cpu::IsTracingEnabled()
+bool runtime::cpu::IsTracingEnabled()
 {
-    static bool enabled = (std::getenv("NGRAPH_CPU_TRACING") != nullptr);
+    static bool enabled = (getenv("NGRAPH_CPU_TRACING") != nullptr);
     return enabled;
 }
@@ -16,12 +16,18 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
-#include "ngraph/runtime/cpu/cpu_external_function.hpp"
-#include "nlohmann/json.hpp"
+#include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 
 namespace ngraph
 {
@@ -29,48 +35,125 @@ namespace ngraph
     {
         namespace cpu
         {
-            struct TraceEvent
+            struct OpAttributes;
+
+            // One op of a traced call. Times are in microseconds since the tracer started.
+            struct TraceRecord
+            {
+                uint32_t Session;
+                uint32_t Function;
+                uint32_t Op;
+                uint32_t TID;
+                int64_t Start;
+                int64_t End;
+            };
+
+            // Fixed size ring of trace records with a single writer, the thread owning it, and
+            // a single reader, the flush thread. The writer drops records rather than wait when
+            // the ring is full.
+            class TraceRing
+            {
+            public:
+                TraceRing(uint32_t tid);
+
+                uint32_t get_tid() const { return m_tid; }
+                bool push(const TraceRecord& record);
+                void drain(std::vector<TraceRecord>& records);
+                // Number of records dropped since the last call
+                size_t take_dropped() { return m_dropped.exchange(0, std::memory_order_relaxed); }
+            private:
+                static constexpr size_t s_capacity = 8192;
+
+                uint32_t m_tid;
+                std::unique_ptr<TraceRecord[]> m_records;
+                // Monotonic counts of records written and read; the slot is the count modulo
+                // the capacity
+                std::atomic<size_t> m_head;
+                std::atomic<size_t> m_tail;
+                std::atomic<size_t> m_dropped;
+            };
+
+            // Process-wide collector of op traces. Ops of sampled calls are recorded into a ring
+            // of the thread running them, and a background thread drains the rings into a
+            // trace file in the Chrome trace event format while a capture runs.
+            class Tracer
             {
-                // This should be a single character
-                // but the JSON encoder nlohmann::json
-                // is broken and doesn't handle character fields
-                std::string Phase;
-                std::string Category;
-                const std::string& Name;
-                unsigned int PID;
-                unsigned int TID;
-                int64_t Timestamp;
-                int64_t Duration;
-                const std::vector<std::string>& Outputs;
-                const std::vector<std::string>& Inputs;
-
-                TraceEvent(const std::string& ph,
-                           const std::string& cat,
-                           const std::string& name,
-                           unsigned int pid,
-                           unsigned int tid,
-                           int64_t ts,
-                           int64_t dur,
-                           const std::vector<std::string>& outputs,
-                           const std::vector<std::string>& inputs)
-                    : Phase(ph)
-                    , Category(cat)
-                    , Name(name)
-                    , PID(pid)
-                    , TID(tid)
-                    , Timestamp(ts)
-                    , Duration(dur)
-                    , Outputs(outputs)
-                    , Inputs(inputs)
+            public:
+                static Tracer& get();
+                ~Tracer();
+
+                // Starts a capture that traces every sample_interval'th call into file_name,
+                // stopping a capture in progress first
+                void start(const std::string& file_name, size_t sample_interval = 1);
+                // Stops the capture and finishes writing its trace file
+                void stop();
+                bool is_capturing() const { return m_session.load(std::memory_order_relaxed) != 0; }
+                // Session to trace the next call under, or 0 if it is not sampled
+                uint32_t sample()
                 {
+                    uint32_t session = m_session.load(std::memory_order_relaxed);
+                    if (session != 0 && m_calls.fetch_add(1, std::memory_order_relaxed) %
+                                                m_sample_interval.load(
+                                                    std::memory_order_relaxed) !=
+                                            0)
+                    {
+                        session = 0;
+                    }
+                    return session;
                 }
+
+                // Functions are registered with their ops once compiled, so that records only
+                // carry indices
+                uint32_t register_function(const std::string& name,
+                                           const std::vector<OpAttributes>& op_attrs);
+                void unregister_function(uint32_t function);
+
+                void record(uint32_t session,
+                            uint32_t function,
+                            uint32_t op,
+                            const Timestamp& start,
+                            const Timestamp& end);
+
+            private:
+                struct FunctionOps;
+
+                Tracer();
+                void stop_capture();
+                TraceRing* get_ring();
+                void flush_loop();
+                void flush(bool finish);
+
+                Timestamp m_epoch;
+                std::atomic<uint32_t> m_session;
+                std::atomic<size_t> m_calls;
+                std::atomic<size_t> m_sample_interval;
+                // Serializes start and stop
+                std::mutex m_capture_mutex;
+
+                // Guards everything below
+                std::mutex m_mutex;
+                // Session being written, which may already be stopped while it is finished
+                uint32_t m_capture_session;
+                uint32_t m_next_session;
+                std::vector<std::shared_ptr<TraceRing>> m_rings;
+                uint32_t m_next_tid;
+                std::unordered_map<uint32_t, std::shared_ptr<FunctionOps>> m_functions;
+                std::vector<uint32_t> m_retired_functions;
+                uint32_t m_next_function;
+                std::ofstream m_out;
+                bool m_first_event;
+                size_t m_dropped;
+
+                std::mutex m_flush_mutex;
+                std::condition_variable m_flush_wakeup;
+                bool m_stop_flush;
+                std::thread m_flush_thread;
             };
 
-            void to_json(nlohmann::json& json, const TraceEvent& event);
+            // Records that op of the function of ctx ran from start until now on this thread
+            void trace_op(CPURuntimeContext* ctx, size_t op, const Timestamp& start);
 
-            void GenerateTimeline(const std::vector<OpAttributes>& op_attrs,
-                                  int64_t* op_durations,
-                                  const std::string& file_name);
+            // True when NGRAPH_CPU_TRACING requests a capture of the whole process
             bool IsTracingEnabled();
         }
     }
@@ -42,7 +42,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<char, 1, Eigen::RowMajor>> in1(
                         static_cast<char*>(input1), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) =
+                    out.device(eigen::get_thread_pool_device()) =
                         (in0 && in1).template cast<char>();
                 }
             }
@@ -41,7 +41,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
                         static_cast<ElementType*>(input0), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) =
+                    out.device(eigen::get_thread_pool_device()) =
                         in0.unaryExpr(Eigen::internal::scalar_atan_op<ElementType>());
                 }
             }
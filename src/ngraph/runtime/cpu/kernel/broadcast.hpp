@@ -58,7 +58,7 @@ namespace ngraph
                         factors[i] = output_shape[i] / input_shape[i];
                     }
 
-                    out.device(eigen::global_thread_pool_device) = in.broadcast(factors);
+                    out.device(eigen::get_thread_pool_device()) = in.broadcast(factors);
                 }
             }
         }
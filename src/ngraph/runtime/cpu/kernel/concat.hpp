@@ -60,7 +60,7 @@ namespace ngraph
 
                         Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
                             static_cast<ElementType*>(inputs[i].get()), in_dims);
-                        out.slice(concat_pos, in_dims).device(eigen::global_thread_pool_device) =
+                        out.slice(concat_pos, in_dims).device(eigen::get_thread_pool_device()) =
                             in;
                         concat_pos[axis] += in_dims[axis];
                     }
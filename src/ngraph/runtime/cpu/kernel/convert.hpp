@@ -20,6 +20,8 @@
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 
 namespace ngraph
 {
@@ -41,10 +43,56 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<InputElementType, 1, Eigen::RowMajor>> in(
                         static_cast<InputElementType*>(input), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) =
+                    out.device(eigen::get_thread_pool_device()) =
                         in.template cast<OutputElementType>();
                 }
 
+                // Eigen has no packet math for the 16-bit floating point storage types, so
+                // conversions to and from them are plain loops over thread pool ranges. The
+                // bit manipulation in bfloat16/float16 is branch-light and inlined, which lets
+                // the compiler vectorise the f32 <-> 16-bit loops.
+                template <typename InputElementType, typename OutputElementType>
+                void convert_16bit(void* input, void* output, size_t count)
+                {
+                    auto in = static_cast<const InputElementType*>(input);
+                    auto out = static_cast<OutputElementType*>(output);
+
+                    auto convert_range = [in, out](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            out[i] = static_cast<OutputElementType>(in[i]);
+                        }
+                    };
+
+                    Eigen::TensorOpCost cost(
+                        sizeof(InputElementType), sizeof(OutputElementType), 4);
+                    eigen::get_thread_pool_device().parallelFor(count, cost, convert_range);
+                }
+
+                template <typename InputElementType>
+                void convert_to_bf16(void* input, void* output, size_t count)
+                {
+                    convert_16bit<InputElementType, bfloat16>(input, output, count);
+                }
+
+                template <typename InputElementType>
+                void convert_to_f16(void* input, void* output, size_t count)
+                {
+                    convert_16bit<InputElementType, float16>(input, output, count);
+                }
+
+                template <typename OutputElementType>
+                void convert_from_bf16(void* input, void* output, size_t count)
+                {
+                    convert_16bit<bfloat16, OutputElementType>(input, output, count);
+                }
+
+                template <typename OutputElementType>
+                void convert_from_f16(void* input, void* output, size_t count)
+                {
+                    convert_16bit<float16, OutputElementType>(input, output, count);
+                }
+
                 template <typename InputElementType>
                 void convert_to_float32(void* input, void* output, size_t count)
                 {
@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <vector>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
+#include "ngraph/runtime/cpu/kernel/convert.hpp"
 #include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
 #include "ngraph/shape.hpp"
@@ -77,7 +80,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, Input1Rank, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in1_dims);
 
-                    out.device(eigen::global_thread_pool_device) = in0.contract(in1, dot_dims);
+                    out.device(eigen::get_thread_pool_device()) = in0.contract(in1, dot_dims);
                 }
 
                 template <typename ElementType>
@@ -95,7 +98,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in1(
                         static_cast<ElementType*>(input1), in1_dims);
 
-                    out.device(eigen::global_thread_pool_device) = in0[0] * in1;
+                    out.device(eigen::get_thread_pool_device()) = in0[0] * in1;
                 }
 
                 template <typename ElementType>
@@ -163,6 +166,51 @@ namespace ngraph
                                    out_shape,
                                    reduction_axes_count);
                 }
+
+                // Dot over a 16-bit floating point storage type. The caller widens the
+                // operands to f32 into wide_arg0 and wide_arg1, which lets it keep scratch
+                // buffers across calls and widen constant operands only once. The contraction
+                // runs and accumulates in f32 on the same Eigen kernels as float into wide_out,
+                // and the result is rounded once when it is narrowed back into out.
+                template <typename ElementType>
+                void dot_widened(float* wide_arg0,
+                                 float* wide_arg1,
+                                 float* wide_out,
+                                 void* out,
+                                 const Shape& arg0_shape,
+                                 const Shape& arg1_shape,
+                                 const Shape& out_shape,
+                                 size_t reduction_axes_count)
+                {
+                    float* a = wide_arg0;
+                    float* b = wide_arg1;
+                    float* c = wide_out;
+                    auto arg0_rank = arg0_shape.size();
+                    auto arg1_rank = arg1_shape.size();
+                    if (reduction_axes_count == 1 && arg0_rank == 2 && arg1_rank == 2)
+                    {
+                        dot<float, 2, 2, 1>(a, b, c, arg0_shape, arg1_shape, out_shape);
+                    }
+                    else if (reduction_axes_count == 1 && arg0_rank == 2 && arg1_rank == 1)
+                    {
+                        dot<float, 2, 1, 1>(a, b, c, arg0_shape, arg1_shape, out_shape);
+                    }
+                    else if (reduction_axes_count == 1 && arg0_rank == 1 && arg1_rank == 1)
+                    {
+                        dot<float, 1, 1, 1>(a, b, c, arg0_shape, arg1_shape, out_shape);
+                    }
+                    else if (reduction_axes_count == 1 && arg0_rank == 3 && arg1_rank == 2)
+                    {
+                        dot<float, 3, 2, 1>(a, b, c, arg0_shape, arg1_shape, out_shape);
+                    }
+                    else
+                    {
+                        reference::dot<float>(
+                            a, b, c, arg0_shape, arg1_shape, out_shape, reduction_axes_count);
+                    }
+
+                    convert_16bit<float, ElementType>(c, out, shape_size(out_shape));
+                }
             }
         }
     }
@@ -38,7 +38,7 @@ namespace ngraph
                         return count;
                     }
                     else if (ngraph_intra_op_parallelism &&
-                             (count == std::atoi(ngraph_intra_op_parallelism)))
+                             (count = std::atoi(ngraph_intra_op_parallelism)))
                     {
                         return count;
                     }
@@ -52,6 +52,21 @@ namespace ngraph
                 Eigen::ThreadPool global_thread_pool(GetNumCores());
                 Eigen::ThreadPoolDevice global_thread_pool_device(&global_thread_pool,
                                                                   global_thread_pool.NumThreads());
+
+                static thread_local Eigen::ThreadPoolDevice* s_thread_pool_device = nullptr;
+
+                Eigen::ThreadPoolDevice& get_thread_pool_device()
+                {
+                    return s_thread_pool_device ? *s_thread_pool_device
+                                                : global_thread_pool_device;
+                }
+
+                Eigen::ThreadPoolDevice* set_thread_pool_device(Eigen::ThreadPoolDevice* device)
+                {
+                    Eigen::ThreadPoolDevice* previous = s_thread_pool_device;
+                    s_thread_pool_device = device;
+                    return previous;
+                }
             }
         }
     }
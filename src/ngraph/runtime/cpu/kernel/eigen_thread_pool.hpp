@@ -29,6 +29,14 @@ namespace ngraph
             {
                 extern Eigen::ThreadPool global_thread_pool;
                 extern Eigen::ThreadPoolDevice global_thread_pool_device;
+
+                // Device the Eigen kernels run on from the calling thread: the device set by
+                // set_thread_pool_device, or the global pool's if none is set
+                Eigen::ThreadPoolDevice& get_thread_pool_device();
+
+                // Sets the calling thread's device and returns the previous one, which may
+                // be nullptr
+                Eigen::ThreadPoolDevice* set_thread_pool_device(Eigen::ThreadPoolDevice* device);
             }
         }
     }
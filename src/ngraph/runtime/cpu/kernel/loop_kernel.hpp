@@ -0,0 +1,145 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace loop
+                {
+                    enum class Opcode
+                    {
+                        Abs,
+                        Add,
+                        Divide,
+                        Exp,
+                        Maximum,
+                        Minimum,
+                        Multiply,
+                        Negative,
+                        Relu,
+                        Sigmoid,
+                        Subtract,
+                        Tanh
+                    };
+
+                    // Computes slot out from slot arg0 and, for binary ops, slot arg1
+                    struct Instruction
+                    {
+                        Opcode opcode;
+                        size_t out;
+                        size_t arg0;
+                        size_t arg1;
+                    };
+
+                    // Elements per tile. The temporaries of a tile stay in L1 cache, so
+                    // every tensor is read or written once per kernel.
+                    constexpr size_t tile_size = 512;
+                }
+
+                // Runs program over count elements, one tile at a time. Slots below
+                // tensor_count refer to tensors, the inputs and outputs of the kernel;
+                // the next temp_count slots are temporaries of one tile.
+                template <typename ElementType>
+                void loop_kernel(const std::vector<loop::Instruction>& program,
+                                 void* const* tensors,
+                                 size_t tensor_count,
+                                 size_t temp_count,
+                                 size_t count)
+                {
+                    using namespace loop;
+                    using Array = Eigen::Map<Eigen::Array<ElementType, Eigen::Dynamic, 1>>;
+
+                    auto run_tiles = [&](Eigen::Index first, Eigen::Index last) {
+                        std::vector<ElementType> temps(temp_count * tile_size);
+                        std::vector<ElementType*> slots(tensor_count + temp_count);
+                        for (size_t i = 0; i < temp_count; i++)
+                        {
+                            slots[tensor_count + i] = temps.data() + i * tile_size;
+                        }
+
+                        for (Eigen::Index tile = first; tile < last; tile++)
+                        {
+                            size_t offset = tile * tile_size;
+                            Eigen::Index n = std::min(tile_size, count - offset);
+                            for (size_t i = 0; i < tensor_count; i++)
+                            {
+                                slots[i] = static_cast<ElementType*>(tensors[i]) + offset;
+                            }
+
+                            for (const Instruction& instruction : program)
+                            {
+                                Array out(slots[instruction.out], n);
+                                Array arg0(slots[instruction.arg0], n);
+                                switch (instruction.opcode)
+                                {
+                                case Opcode::Abs: out = arg0.abs(); break;
+                                case Opcode::Add:
+                                    out = arg0 + Array(slots[instruction.arg1], n);
+                                    break;
+                                case Opcode::Divide:
+                                    out = arg0 / Array(slots[instruction.arg1], n);
+                                    break;
+                                case Opcode::Exp: out = arg0.exp(); break;
+                                case Opcode::Maximum:
+                                    out = arg0.max(Array(slots[instruction.arg1], n));
+                                    break;
+                                case Opcode::Minimum:
+                                    out = arg0.min(Array(slots[instruction.arg1], n));
+                                    break;
+                                case Opcode::Multiply:
+                                    out = arg0 * Array(slots[instruction.arg1], n);
+                                    break;
+                                case Opcode::Negative: out = -arg0; break;
+                                case Opcode::Relu: out = arg0.max(ElementType(0)); break;
+                                case Opcode::Sigmoid:
+                                    out = (ElementType(1) + (-arg0).exp()).inverse();
+                                    break;
+                                case Opcode::Subtract:
+                                    out = arg0 - Array(slots[instruction.arg1], n);
+                                    break;
+                                case Opcode::Tanh: out = arg0.tanh(); break;
+                                }
+                            }
+                        }
+                    };
+
+                    // Every tensor element is loaded or stored once; each op costs a few
+                    // cycles per element
+                    Eigen::TensorOpCost cost(sizeof(ElementType) * tensor_count * tile_size,
+                                             0,
+                                             program.size() * tile_size);
+                    size_t tile_count = (count + tile_size - 1) / tile_size;
+                    eigen::get_thread_pool_device().parallelFor(tile_count, cost, run_tiles);
+                }
+            }
+        }
+    }
+}
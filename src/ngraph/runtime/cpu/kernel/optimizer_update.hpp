@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cmath>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Updates read each input element before writing the matching output element,
+                // so outputs may alias their inputs
+
+                template <typename ElementType>
+                using UpdateTensor =
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>>;
+
+                template <typename ElementType>
+                UpdateTensor<ElementType> update_tensor(void* data, size_t count)
+                {
+                    Eigen::array<Eigen::Index, 1> dims;
+                    dims[0] = count;
+                    return UpdateTensor<ElementType>(static_cast<ElementType*>(data), dims);
+                }
+
+                template <typename ElementType>
+                void sgd_update(
+                    void* weights, void* gradient, void* out_weights, float lr, size_t count)
+                {
+                    auto w = update_tensor<ElementType>(weights, count);
+                    auto g = update_tensor<ElementType>(gradient, count);
+                    auto out_w = update_tensor<ElementType>(out_weights, count);
+
+                    out_w.device(eigen::get_thread_pool_device()) = w - g * ElementType(lr);
+                }
+
+                // Momentum and Adam produce several outputs per element, so they are plain
+                // loops over thread pool ranges that compute every output in one pass instead
+                // of one Eigen assignment per output
+                template <typename ElementType>
+                void momentum_update(void* weights,
+                                     void* velocity,
+                                     void* gradient,
+                                     void* out_weights,
+                                     void* out_velocity,
+                                     float lr,
+                                     float momentum,
+                                     size_t count)
+                {
+                    auto w = static_cast<const ElementType*>(weights);
+                    auto v = static_cast<const ElementType*>(velocity);
+                    auto g = static_cast<const ElementType*>(gradient);
+                    auto out_w = static_cast<ElementType*>(out_weights);
+                    auto out_v = static_cast<ElementType*>(out_velocity);
+                    ElementType lr_t(lr);
+                    ElementType momentum_t(momentum);
+
+                    auto update_range = [=](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            ElementType w_i = w[i];
+                            ElementType v_i = v[i] * momentum_t + g[i];
+                            out_v[i] = v_i;
+                            out_w[i] = w_i - v_i * lr_t;
+                        }
+                    };
+
+                    Eigen::TensorOpCost cost(3 * sizeof(ElementType), 2 * sizeof(ElementType), 4);
+                    eigen::get_thread_pool_device().parallelFor(count, cost, update_range);
+                }
+
+                template <typename ElementType>
+                void adam_update(void* weights,
+                                 void* m,
+                                 void* v,
+                                 void* gradient,
+                                 void* out_weights,
+                                 void* out_m,
+                                 void* out_v,
+                                 float lr,
+                                 float beta1,
+                                 float beta2,
+                                 float epsilon,
+                                 size_t count)
+                {
+                    auto w = static_cast<const ElementType*>(weights);
+                    auto m0 = static_cast<const ElementType*>(m);
+                    auto v0 = static_cast<const ElementType*>(v);
+                    auto g = static_cast<const ElementType*>(gradient);
+                    auto out_w = static_cast<ElementType*>(out_weights);
+                    auto m1 = static_cast<ElementType*>(out_m);
+                    auto v1 = static_cast<ElementType*>(out_v);
+                    ElementType lr_t(lr);
+                    ElementType beta1_t(beta1);
+                    ElementType beta2_t(beta2);
+                    ElementType epsilon_t(epsilon);
+
+                    auto update_range = [=](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            ElementType w_i = w[i];
+                            ElementType g_i = g[i];
+                            ElementType m_i = m0[i] * beta1_t + g_i * (1 - beta1_t);
+                            ElementType v_i = v0[i] * beta2_t + g_i * g_i * (1 - beta2_t);
+                            m1[i] = m_i;
+                            v1[i] = v_i;
+                            out_w[i] = w_i - m_i * lr_t / (std::sqrt(v_i) + epsilon_t);
+                        }
+                    };
+
+                    Eigen::TensorOpCost cost(4 * sizeof(ElementType), 3 * sizeof(ElementType), 12);
+                    eigen::get_thread_pool_device().parallelFor(count, cost, update_range);
+                }
+            }
+        }
+    }
+}
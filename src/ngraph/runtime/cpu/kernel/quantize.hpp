@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename T>
+                struct round_to_nearest_even
+                {
+                    T operator()(T x) const { return std::nearbyint(x); }
+                };
+
+                template <typename RealElementType, typename QuantizedElementType>
+                void quantize(
+                    void* input, void* output, size_t count, float scale, int32_t zero_point)
+                {
+                    Eigen::array<Eigen::Index, 1> out_dims, in_dims;
+
+                    out_dims[0] = in_dims[0] = count;
+
+                    Eigen::TensorMap<Eigen::Tensor<QuantizedElementType, 1, Eigen::RowMajor>> out(
+                        static_cast<QuantizedElementType*>(output), out_dims);
+                    Eigen::TensorMap<Eigen::Tensor<RealElementType, 1, Eigen::RowMajor>> in(
+                        static_cast<RealElementType*>(input), in_dims);
+
+                    auto lowest = static_cast<RealElementType>(
+                        std::numeric_limits<QuantizedElementType>::lowest());
+                    auto highest = static_cast<RealElementType>(
+                        std::numeric_limits<QuantizedElementType>::max());
+
+                    out.device(eigen::get_thread_pool_device()) =
+                        ((in / static_cast<RealElementType>(scale))
+                             .unaryExpr(round_to_nearest_even<RealElementType>()) +
+                         static_cast<RealElementType>(zero_point))
+                            .cwiseMax(lowest)
+                            .cwiseMin(highest)
+                            .template cast<QuantizedElementType>();
+                }
+
+                template <typename QuantizedElementType, typename RealElementType>
+                void dequantize(
+                    void* input, void* output, size_t count, float scale, int32_t zero_point)
+                {
+                    Eigen::array<Eigen::Index, 1> out_dims, in_dims;
+
+                    out_dims[0] = in_dims[0] = count;
+
+                    Eigen::TensorMap<Eigen::Tensor<RealElementType, 1, Eigen::RowMajor>> out(
+                        static_cast<RealElementType*>(output), out_dims);
+                    Eigen::TensorMap<Eigen::Tensor<QuantizedElementType, 1, Eigen::RowMajor>> in(
+                        static_cast<QuantizedElementType*>(input), in_dims);
+
+                    out.device(eigen::get_thread_pool_device()) =
+                        (in.template cast<RealElementType>() -
+                         static_cast<RealElementType>(zero_point)) *
+                        static_cast<RealElementType>(scale);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,78 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include "ngraph/runtime/reference/quantized_convolution.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename DataElementType,
+                          typename FilterElementType,
+                          typename OutputElementType>
+                void quantized_convolution(void* input0,
+                                           void* input1,
+                                           void* bias,
+                                           void* output,
+                                           const Shape& arg0_shape,
+                                           const Shape& arg1_shape,
+                                           const Shape& result_shape,
+                                           const Strides& window_movement_strides,
+                                           const Strides& window_dilation_strides,
+                                           const CoordinateDiff& padding_below,
+                                           const CoordinateDiff& padding_above,
+                                           float data_scale,
+                                           int32_t data_zero_point,
+                                           float filter_scale,
+                                           int32_t filter_zero_point,
+                                           float output_scale,
+                                           int32_t output_zero_point,
+                                           bool with_relu)
+                {
+                    reference::quantized_convolution<DataElementType,
+                                                     FilterElementType,
+                                                     OutputElementType>(
+                        static_cast<const DataElementType*>(input0),
+                        static_cast<const FilterElementType*>(input1),
+                        static_cast<const int32_t*>(bias),
+                        static_cast<OutputElementType*>(output),
+                        arg0_shape,
+                        arg1_shape,
+                        result_shape,
+                        window_movement_strides,
+                        window_dilation_strides,
+                        padding_below,
+                        padding_above,
+                        data_scale,
+                        data_zero_point,
+                        filter_scale,
+                        filter_zero_point,
+                        output_scale,
+                        output_zero_point,
+                        with_relu);
+                }
+            }
+        }
+    }
+}
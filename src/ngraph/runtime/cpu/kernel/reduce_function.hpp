@@ -16,14 +16,23 @@
 
 #pragma once
 
+#include <functional>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/axis_set.hpp"
-#include "ngraph/runtime/backend.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/and.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/or.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/runtime/reference/reduce.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 
@@ -35,6 +44,130 @@ namespace ngraph
         {
             namespace kernel
             {
+                // Reduction Functions whose body is one commutative elementwise op applied to
+                // the two parameters, which are lowered to the native reduction kernels
+                enum class NativeReducer
+                {
+                    None,
+                    Add,
+                    Multiply,
+                    Maximum,
+                    Minimum,
+                    And,
+                    Or
+                };
+
+                inline NativeReducer get_native_reducer(const Function& function)
+                {
+                    const auto& params = function.get_parameters();
+                    if (params.size() != 2 || function.get_output_size() != 1)
+                    {
+                        return NativeReducer::None;
+                    }
+
+                    auto body = function.get_output_op(0)->get_argument(0);
+                    auto body_args = body->get_arguments();
+                    if (body_args.size() != 2 ||
+                        !((body_args[0] == params[0] && body_args[1] == params[1]) ||
+                          (body_args[0] == params[1] && body_args[1] == params[0])))
+                    {
+                        return NativeReducer::None;
+                    }
+
+                    if (std::dynamic_pointer_cast<op::Add>(body))
+                    {
+                        return NativeReducer::Add;
+                    }
+                    if (std::dynamic_pointer_cast<op::Multiply>(body))
+                    {
+                        return NativeReducer::Multiply;
+                    }
+                    if (std::dynamic_pointer_cast<op::Maximum>(body))
+                    {
+                        return NativeReducer::Maximum;
+                    }
+                    if (std::dynamic_pointer_cast<op::Minimum>(body))
+                    {
+                        return NativeReducer::Minimum;
+                    }
+                    if (std::dynamic_pointer_cast<op::And>(body))
+                    {
+                        return NativeReducer::And;
+                    }
+                    if (std::dynamic_pointer_cast<op::Or>(body))
+                    {
+                        return NativeReducer::Or;
+                    }
+                    return NativeReducer::None;
+                }
+
+                // Native reductions ignore the initial value of Reduce, so it is folded into
+                // each result afterwards
+                template <typename ElementType>
+                void reduce_fold_initial(void* initial,
+                                         void* output,
+                                         size_t count,
+                                         NativeReducer reducer)
+                {
+                    Eigen::array<Eigen::Index, 1> out_dims;
+                    out_dims[0] = count;
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> out(
+                        static_cast<ElementType*>(output), out_dims);
+                    auto init = out.constant(*static_cast<ElementType*>(initial));
+                    auto& device = eigen::get_thread_pool_device();
+
+                    switch (reducer)
+                    {
+                    case NativeReducer::Add: out.device(device) = out + init; break;
+                    case NativeReducer::Multiply: out.device(device) = out * init; break;
+                    // Booleans are 0 or 1, so And and Or are their minimum and maximum
+                    case NativeReducer::Maximum:
+                    case NativeReducer::Or: out.device(device) = out.cwiseMax(init); break;
+                    case NativeReducer::Minimum:
+                    case NativeReducer::And: out.device(device) = out.cwiseMin(init); break;
+                    case NativeReducer::None: break;
+                    }
+                }
+
+                // Reduction Function compiled once, whose call frame is bound to scalar argument
+                // and result tensors reused for every pair of elements. Calls must not overlap,
+                // so each executor state of the calling function owns one.
+                class ScalarFunction
+                {
+                public:
+                    ScalarFunction(const std::shared_ptr<CPU_ExternalFunction>& external_function,
+                                   const element::Type& element_type)
+                        : m_call_frame(external_function->make_call_frame())
+                    {
+                        for (size_t i = 0; i < 2; i++)
+                        {
+                            auto tv = std::make_shared<CPUTensorView>(element_type, Shape{});
+                            m_args[i] = tv->get_data_ptr();
+                            m_inputs.push_back(tv);
+                        }
+                        auto tv = std::make_shared<CPUTensorView>(element_type, Shape{});
+                        m_result = tv->get_data_ptr();
+                        m_outputs.push_back(tv);
+                    }
+
+                    template <typename ElementType>
+                    ElementType call(ElementType x, ElementType y)
+                    {
+                        *reinterpret_cast<ElementType*>(m_args[0]) = x;
+                        *reinterpret_cast<ElementType*>(m_args[1]) = y;
+                        m_call_frame->call(m_outputs, m_inputs);
+                        return *reinterpret_cast<ElementType*>(m_result);
+                    }
+
+                private:
+                    std::shared_ptr<CPU_CallFrame> m_call_frame;
+                    TensorViewPtrs m_inputs;
+                    TensorViewPtrs m_outputs;
+                    char* m_args[2];
+                    char* m_result;
+                };
+
                 template <typename ElementType>
                 struct Reducer
                 {
@@ -42,37 +175,24 @@ namespace ngraph
                     static const bool IsStateful = false;
 
                     ElementType initial;
-                    const std::shared_ptr<CPU_ExternalFunction>& external_function;
-                    std::shared_ptr<Backend> backend;
+                    ScalarFunction* function;
 
-                    Reducer(ElementType x, const std::shared_ptr<CPU_ExternalFunction>& ef)
+                    Reducer(ElementType x, ScalarFunction* f)
                         : initial(x)
-                        , external_function(ef)
-                        , backend(runtime::Backend::create("CPU"))
+                        , function(f)
                     {
                     }
 
                     void reduce(const ElementType v, ElementType* R)
                     {
-                        TensorViewPtrs inputs, outputs;
-                        ElementType p __attribute__((aligned(NGRAPH_CPU_ALIGNMENT))) = v;
-                        ElementType q __attribute__((aligned(NGRAPH_CPU_ALIGNMENT))) = *R;
-                        ElementType r __attribute__((aligned(NGRAPH_CPU_ALIGNMENT)));
-
-                        inputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &p));
-                        inputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &q));
-                        outputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &r));
-                        auto call_frame = external_function->make_call_frame();
-                        call_frame->call(outputs, inputs);
-                        *R = r;
+                        *R = function->call<ElementType>(v, *R);
                     }
                     ElementType initialize() const { return initial; }
                     ElementType finalize(const ElementType R) const { return R; }
                 };
 
+                // The reduction Function is not reentrant, so the reduction runs on the calling
+                // thread rather than the thread pool
                 template <typename ElementType, unsigned int Rank, unsigned int ReductionDims>
                 void reduce_function(void* input0,
                                      void* input1,
@@ -80,7 +200,7 @@ namespace ngraph
                                      const Shape& input_shape,
                                      const Shape& output_shape,
                                      const AxisSet& reduction_axes,
-                                     const std::shared_ptr<CPU_ExternalFunction>& external_function)
+                                     const std::shared_ptr<ScalarFunction>& function)
                 {
                     Eigen::array<Eigen::Index, Rank> in_dims;
                     Eigen::array<Eigen::Index, Rank - ReductionDims> out_dims;
@@ -108,9 +228,8 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
                         static_cast<ElementType*>(input0), in_dims);
                     Reducer<ElementType> reducer(*static_cast<ElementType*>(input1),
-                                                 external_function);
-                    out.device(eigen::global_thread_pool_device) =
-                        in.reduce(reduction_dims, reducer);
+                                                 function.get());
+                    out = in.reduce(reduction_dims, reducer);
                 }
 
                 template <typename ElementType, unsigned int Rank>
@@ -121,7 +240,7 @@ namespace ngraph
                     const Shape& input_shape,
                     const Shape& output_shape,
                     const AxisSet& reduction_axes,
-                    const std::shared_ptr<CPU_ExternalFunction>& external_function)
+                    const std::shared_ptr<ScalarFunction>& function)
                 {
                     reduce_function<ElementType, Rank, 1>(input0,
                                                           input1,
@@ -129,7 +248,7 @@ namespace ngraph
                                                           input_shape,
                                                           output_shape,
                                                           reduction_axes,
-                                                          external_function);
+                                                          function);
                 }
 
                 template <typename ElementType>
@@ -140,7 +259,7 @@ namespace ngraph
                     const Shape& input_shape,
                     const Shape& output_shape,
                     const AxisSet& reduction_axes,
-                    const std::shared_ptr<CPU_ExternalFunction>& external_function)
+                    const std::shared_ptr<ScalarFunction>& function)
                 {
                     reduce_function<ElementType, 2, 2>(input0,
                                                        input1,
@@ -148,7 +267,7 @@ namespace ngraph
                                                        input_shape,
                                                        output_shape,
                                                        reduction_axes,
-                                                       external_function);
+                                                       function);
                 }
 
                 template <typename ElementType>
@@ -159,7 +278,7 @@ namespace ngraph
                     const Shape& input_shape,
                     const Shape& output_shape,
                     const AxisSet& reduction_axes,
-                    const std::shared_ptr<CPU_ExternalFunction>& external_function)
+                    const std::shared_ptr<ScalarFunction>& function)
                 {
                     reduce_function<ElementType, 3, 2>(input0,
                                                        input1,
@@ -167,7 +286,28 @@ namespace ngraph
                                                        input_shape,
                                                        output_shape,
                                                        reduction_axes,
-                                                       external_function);
+                                                       function);
+                }
+
+                template <typename ElementType>
+                void reduce_function_ref(void* input0,
+                                         void* input1,
+                                         void* output,
+                                         const Shape& input_shape,
+                                         const Shape& output_shape,
+                                         const AxisSet& reduction_axes,
+                                         const std::shared_ptr<ScalarFunction>& function)
+                {
+                    reference::reduce<ElementType>(
+                        static_cast<const ElementType*>(input0),
+                        static_cast<const ElementType*>(input1),
+                        static_cast<ElementType*>(output),
+                        input_shape,
+                        output_shape,
+                        reduction_axes,
+                        [&](ElementType x, ElementType y) {
+                            return function->call<ElementType>(x, y);
+                        });
                 }
             }
         }
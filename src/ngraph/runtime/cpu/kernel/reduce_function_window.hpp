@@ -16,10 +16,9 @@
 
 #pragma once
 
-#include "ngraph/runtime/backend.hpp"
-#include "ngraph/runtime/cpu/cpu_external_function.hpp"
-#include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include <functional>
 
+#include "ngraph/runtime/cpu/kernel/reduce_function.hpp"
 #include "ngraph/runtime/reference/reduce_window.hpp"
 
 namespace ngraph
@@ -31,44 +30,68 @@ namespace ngraph
             namespace kernel
             {
                 template <typename ElementType>
-                void reduce_function_window(
-                    void* input0,
-                    void* input1,
-                    void* output,
-                    const Shape& input_shape,
-                    const Shape& output_shape,
-                    const Shape& window_shape,
-                    const Strides& window_movement_strides,
-                    const std::shared_ptr<CPU_ExternalFunction>& external_function)
+                void reduce_function_window(void* input0,
+                                            void* input1,
+                                            void* output,
+                                            const Shape& input_shape,
+                                            const Shape& output_shape,
+                                            const Shape& window_shape,
+                                            const Strides& window_movement_strides,
+                                            const std::shared_ptr<ScalarFunction>& function)
                 {
-                    auto backend = runtime::Backend::create("CPU");
-
-                    auto reducer = [&](ElementType a, ElementType b) {
-                        TensorViewPtrs inputs, outputs;
-
-                        ElementType p __attribute__((aligned(NGRAPH_CPU_ALIGNMENT))) = a;
-                        ElementType q __attribute__((aligned(NGRAPH_CPU_ALIGNMENT))) = b;
-                        ElementType r __attribute__((aligned(NGRAPH_CPU_ALIGNMENT)));
-
-                        inputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &p));
-                        inputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &q));
-                        outputs.emplace_back(backend->create_tensor(
-                            ngraph::element::from<ElementType>(), Shape{}, &r));
-
-                        auto call_frame = external_function->make_call_frame();
-                        call_frame->call(outputs, inputs);
+                    reference::reduce_window<ElementType>(
+                        static_cast<const ElementType*>(input0),
+                        static_cast<const ElementType*>(input1),
+                        static_cast<ElementType*>(output),
+                        input_shape,
+                        output_shape,
+                        [&](ElementType a, ElementType b) {
+                            return function->call<ElementType>(a, b);
+                        },
+                        window_shape,
+                        window_movement_strides);
+                }
 
-                        return r;
-                    };
+                template <typename ElementType>
+                void reduce_function_window_native(void* input0,
+                                                   void* input1,
+                                                   void* output,
+                                                   const Shape& input_shape,
+                                                   const Shape& output_shape,
+                                                   const Shape& window_shape,
+                                                   const Strides& window_movement_strides,
+                                                   NativeReducer reducer)
+                {
+                    std::function<ElementType(ElementType, ElementType)> f;
+                    switch (reducer)
+                    {
+                    case NativeReducer::Add:
+                        f = [](ElementType a, ElementType b) -> ElementType { return a + b; };
+                        break;
+                    case NativeReducer::Multiply:
+                        f = [](ElementType a, ElementType b) -> ElementType { return a * b; };
+                        break;
+                    case NativeReducer::Maximum:
+                        f = [](ElementType a, ElementType b) { return a > b ? a : b; };
+                        break;
+                    case NativeReducer::Minimum:
+                        f = [](ElementType a, ElementType b) { return a < b ? a : b; };
+                        break;
+                    case NativeReducer::And:
+                        f = [](ElementType a, ElementType b) -> ElementType { return a && b; };
+                        break;
+                    case NativeReducer::Or:
+                        f = [](ElementType a, ElementType b) -> ElementType { return a || b; };
+                        break;
+                    case NativeReducer::None: throw ngraph_error("Unsupported reducer");
+                    }
 
                     reference::reduce_window<ElementType>(static_cast<const ElementType*>(input0),
                                                           static_cast<const ElementType*>(input1),
                                                           static_cast<ElementType*>(output),
                                                           input_shape,
                                                           output_shape,
-                                                          reducer,
+                                                          f,
                                                           window_shape,
                                                           window_movement_strides);
                 }
@@ -49,7 +49,7 @@ namespace ngraph
                         static_cast<ElementType*>(output), out_dims);
                     Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
                         static_cast<ElementType*>(input), in_dims);
-                    out.device(eigen::global_thread_pool_device) = in.sum();
+                    out.device(eigen::get_thread_pool_device()) = in.sum();
                 }
 
                 template <typename ElementType, unsigned int Rank>
@@ -76,7 +76,7 @@ namespace ngraph
                         static_cast<ElementType*>(output), out_dims);
                     Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
                         static_cast<ElementType*>(input), in_dims);
-                    out.device(eigen::global_thread_pool_device) = in.sum(reduction_dim);
+                    out.device(eigen::get_thread_pool_device()) = in.sum(reduction_dim);
                 }
 
                 template <typename ElementType, unsigned int Rank, unsigned int ReductionDims>
@@ -111,7 +111,7 @@ namespace ngraph
                         out(static_cast<ElementType*>(output), out_dims);
                     Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
                         static_cast<ElementType*>(input), in_dims);
-                    out.device(eigen::global_thread_pool_device) = in.sum(reduction_dims);
+                    out.device(eigen::get_thread_pool_device()) = in.sum(reduction_dims);
                 }
 
                 template <typename ElementType, unsigned int Rank>
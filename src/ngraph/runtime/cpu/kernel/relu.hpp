@@ -42,7 +42,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
                         static_cast<ElementType*>(input0), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) = in0.cwiseMax(ElementType(0));
+                    out.device(eigen::get_thread_pool_device()) = in0.cwiseMax(ElementType(0));
                 }
 
                 template <typename ElementType>
@@ -57,7 +57,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
                         static_cast<ElementType*>(input0), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) =
+                    out.device(eigen::get_thread_pool_device()) =
                         in0.cwiseMax(ElementType(0)).cwiseMin(alpha);
                 }
 
@@ -57,58 +57,58 @@ namespace ngraph
                     case 0 /*Logistic|Logistic*/:
                     {
                         auto c = (in0.exp() * in1.exp()) / ((in0.exp() + 1.f) * (in1.exp() + 1.f));
-                        out_tm.device(eigen::global_thread_pool_device) = c;
+                        out_tm.device(eigen::get_thread_pool_device()) = c;
                     }
                     break;
                     case 1 /*Logistic|Tanh*/:
                     {
                         auto c = (in0.exp() * ((in1 * 2.f).exp() - 1.f)) /
                                  ((in0.exp() + 1.f) * ((in1 * 2.f).exp() + 1.f));
-                        out_tm.device(eigen::global_thread_pool_device) = c;
+                        out_tm.device(eigen::get_thread_pool_device()) = c;
                     }
                     break;
                     case 2 /*Logistic|Identity*/:
                     {
                         auto c = (in0.exp() * in1) / (in0.exp() + 1.f);
-                        out_tm.device(eigen::global_thread_pool_device) = c;
+                        out_tm.device(eigen::get_thread_pool_device()) = c;
                     }
                     break;
                     case 3 /*Tanh|Logistic*/:
                     {
                         auto c = (((in0 * 2.f).exp() - 1.f) * in1.exp()) /
                                  (((in0 * 2.f).exp() + 1.f) * (in1.exp() + 1.f));
-                        out_tm.device(eigen::global_thread_pool_device) = c;
+                        out_tm.device(eigen::get_thread_pool_device()) = c;
                     }
                     break;
                     case 4 /*Tanh|Tanh*/:
                     {
                         auto c = (((in0 * 2.f).exp() - 1.f) * ((in1 * 2.f).exp() - 1.f)) /
                                  (((in0 * 2.f).exp() + 1.f) * ((in1 * 2.f).exp() + 1.f));
-                        out_tm.device(eigen::global_thread_pool_device) = c;
+                        out_tm.device(eigen::get_thread_pool_device()) = c;
                     }
                     break;
                     case 5 /*Tanh|Identity*/:
                     {
                         auto c = (((in0 * 2.f).exp() - 1.f) * in1) / ((in0 * 2.f).exp() + 1.f);
-                        out_tm.device(eigen::global_thread_pool_device) = c;
+                        out_tm.device(eigen::get_thread_pool_device()) = c;
                     }
                     break;
                     case 6 /*Identity|Logistic*/:
                     {
                         auto c = (in0 * in1.exp()) / (in1.exp() + 1.f);
-                        out_tm.device(eigen::global_thread_pool_device) = c;
+                        out_tm.device(eigen::get_thread_pool_device()) = c;
                     }
                     break;
                     case 7 /*Identity|Tanh*/:
                     {
                         auto c = (in0 * ((in1 * 2.f).exp() - 1.f)) / ((in1 * 2.f).exp() + 1.f);
-                        out_tm.device(eigen::global_thread_pool_device) = c;
+                        out_tm.device(eigen::get_thread_pool_device()) = c;
                     }
                     break;
                     case 8 /*Identity|Identity*/:
                     {
                         auto c = (in0 * in1);
-                        out_tm.device(eigen::global_thread_pool_device) = c;
+                        out_tm.device(eigen::get_thread_pool_device()) = c;
                     }
                     break;
                     default: throw ngraph_error("unsupported combination for SigmoidMultiply");
@@ -137,8 +137,8 @@ namespace ngraph
                                   ((in1.exp() + 1.f) * ((in0.exp() + 1.f) * (in0.exp() + 1.f)));
                         auto i1 = delta * (in0.exp() * in1.exp()) /
                                   ((in0.exp() + 1.f) * ((in1.exp() + 1.f) * (in1.exp() + 1.f)));
-                        i0_delta.device(eigen::global_thread_pool_device) = i0;
-                        i1_delta.device(eigen::global_thread_pool_device) = i1;
+                        i0_delta.device(eigen::get_thread_pool_device()) = i0;
+                        i1_delta.device(eigen::get_thread_pool_device()) = i1;
                     }
                     break;
                     case 1 /*Logistic|Tanh*/:
@@ -149,8 +149,8 @@ namespace ngraph
                         auto i1 = delta * (in0.exp() * (4.f * (in1 * 2.f).exp())) /
                                   ((in0.exp() + 1.f) *
                                    (((in1 * 2.f).exp() + 1.f) * ((in1 * 2.f).exp() + 1.f)));
-                        i0_delta.device(eigen::global_thread_pool_device) = i0;
-                        i1_delta.device(eigen::global_thread_pool_device) = i1;
+                        i0_delta.device(eigen::get_thread_pool_device()) = i0;
+                        i1_delta.device(eigen::get_thread_pool_device()) = i1;
                     }
                     break;
                     case 2 /*Logistic|Identity*/:
@@ -158,8 +158,8 @@ namespace ngraph
                         auto i0 =
                             delta * (in1 * in0.exp()) / ((in0.exp() + 1.f) * (in0.exp() + 1.f));
                         auto i1 = delta * in0.exp() / ((in0.exp() + 1.f));
-                        i0_delta.device(eigen::global_thread_pool_device) = i0;
-                        i1_delta.device(eigen::global_thread_pool_device) = i1;
+                        i0_delta.device(eigen::get_thread_pool_device()) = i0;
+                        i1_delta.device(eigen::get_thread_pool_device()) = i1;
                     }
                     break;
                     case 3 /*Tanh|Logistic*/:
@@ -170,8 +170,8 @@ namespace ngraph
                         auto i1 =
                             delta * (((in0 * 2.f).exp() - 1.f) * in1.exp()) /
                             (((in0 * 2.f).exp() + 1.f) * ((in1.exp() + 1.f) * (in1.exp() + 1.f)));
-                        i0_delta.device(eigen::global_thread_pool_device) = i0;
-                        i1_delta.device(eigen::global_thread_pool_device) = i1;
+                        i0_delta.device(eigen::get_thread_pool_device()) = i0;
+                        i1_delta.device(eigen::get_thread_pool_device()) = i1;
                     }
                     break;
                     case 4 /*Tanh|Tanh*/:
@@ -182,8 +182,8 @@ namespace ngraph
                         auto i1 = delta * (((in0 * 2.f).exp() - 1.f) * (4.f * (in1 * 2.f).exp())) /
                                   (((in0 * 2.f).exp() + 1.f) *
                                    (((in1 * 2.f).exp() + 1.f) * ((in1 * 2.f).exp() + 1.f)));
-                        i0_delta.device(eigen::global_thread_pool_device) = i0;
-                        i1_delta.device(eigen::global_thread_pool_device) = i1;
+                        i0_delta.device(eigen::get_thread_pool_device()) = i0;
+                        i1_delta.device(eigen::get_thread_pool_device()) = i1;
                     }
                     break;
                     case 5 /*Tanh|Identity*/:
@@ -191,8 +191,8 @@ namespace ngraph
                         auto i0 = delta * (in1 * (4.f * (in0 * 2.f).exp())) /
                                   (((in0 * 2.f).exp() + 1.f) * ((in0 * 2.f).exp() + 1.f));
                         auto i1 = delta * ((in0 * 2.f).exp() - 1.f) / ((in0 * 2.f).exp() + 1.f);
-                        i0_delta.device(eigen::global_thread_pool_device) = i0;
-                        i1_delta.device(eigen::global_thread_pool_device) = i1;
+                        i0_delta.device(eigen::get_thread_pool_device()) = i0;
+                        i1_delta.device(eigen::get_thread_pool_device()) = i1;
                     }
                     break;
                     case 6 /*Identity|Logistic*/:
@@ -200,8 +200,8 @@ namespace ngraph
                         auto i0 = delta * (in1.exp()) / (in1.exp() + 1.f);
                         auto i1 =
                             delta * (in0 * in1.exp()) / ((in1.exp() + 1.f) * (in1.exp() + 1.f));
-                        i0_delta.device(eigen::global_thread_pool_device) = i0;
-                        i1_delta.device(eigen::global_thread_pool_device) = i1;
+                        i0_delta.device(eigen::get_thread_pool_device()) = i0;
+                        i1_delta.device(eigen::get_thread_pool_device()) = i1;
                     }
                     break;
                     case 7 /*Identity|Tanh*/:
@@ -209,16 +209,16 @@ namespace ngraph
                         auto i0 = delta * ((in1 * 2.f).exp() - 1.f) / ((in1 * 2.f).exp() + 1.f);
                         auto i1 = delta * (in0 * (4.f * (in1 * 2.f).exp())) /
                                   (((in1 * 2.f).exp() + 1.f) * ((in1 * 2.f).exp() + 1.f));
-                        i0_delta.device(eigen::global_thread_pool_device) = i0;
-                        i1_delta.device(eigen::global_thread_pool_device) = i1;
+                        i0_delta.device(eigen::get_thread_pool_device()) = i0;
+                        i1_delta.device(eigen::get_thread_pool_device()) = i1;
                     }
                     break;
                     case 8 /*Identity|Identity*/:
                     {
                         auto i0 = delta * in1;
                         auto i1 = delta * in0;
-                        i0_delta.device(eigen::global_thread_pool_device) = i0;
-                        i1_delta.device(eigen::global_thread_pool_device) = i1;
+                        i0_delta.device(eigen::get_thread_pool_device()) = i0;
+                        i1_delta.device(eigen::get_thread_pool_device()) = i1;
                     }
                     break;
                     default: throw ngraph_error("unsupported combination for SigmoidMultiply");
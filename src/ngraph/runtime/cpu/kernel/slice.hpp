@@ -53,7 +53,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
                         static_cast<ElementType*>(input), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) = in.slice(indices, out_dims);
+                    out.device(eigen::get_thread_pool_device()) = in.slice(indices, out_dims);
                 }
 
                 template <typename ElementType, unsigned int Rank>
@@ -82,7 +82,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
                         static_cast<ElementType*>(input), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) =
+                    out.device(eigen::get_thread_pool_device()) =
                         in.stridedSlice(start_indices, stop_indices, strides);
                 }
             }
@@ -41,7 +41,7 @@ namespace ngraph
                     Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in(
                         static_cast<ElementType*>(input), in_dims);
 
-                    out.device(eigen::global_thread_pool_device) = in.sqrt();
+                    out.device(eigen::get_thread_pool_device()) = in.sqrt();
                 }
             }
         }
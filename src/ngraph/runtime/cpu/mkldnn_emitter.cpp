@@ -275,6 +275,165 @@ size_t MKLDNNEmitter::build_convolution_forward(const mkldnn::memory::desc& inpu
     return conv_index;
 }
 
+size_t MKLDNNEmitter::build_quantized_convolution_forward(
+    const mkldnn::memory::desc& input_data_desc,
+    const mkldnn::memory::desc& weights_desc,
+    const mkldnn::memory::desc& result_desc,
+    const ngraph::Strides& strides,
+    const ngraph::Strides& dilation_strides,
+    const ngraph::CoordinateDiff& padding_below,
+    const ngraph::CoordinateDiff& padding_above,
+    float output_scale,
+    const mkldnn::post_ops& pops)
+{
+    const size_t input_data_index = build_memory_primitive(input_data_desc);
+    const size_t weights_index = build_memory_primitive(weights_desc);
+    const size_t result_index = build_memory_primitive(result_desc);
+
+    mkldnn::primitive_attr conv_attr;
+    conv_attr.set_post_ops(pops);
+    conv_attr.set_int_output_round_mode(mkldnn::round_mode::round_nearest);
+    conv_attr.set_output_scales(0, {output_scale});
+
+    size_t conv_index = -1;
+    try
+    {
+        conv_index = insert_primitive(new mkldnn::convolution_forward(
+            {{mkldnn::prop_kind::forward,
+              mkldnn::algorithm::convolution_direct,
+              input_data_desc,
+              weights_desc,
+              result_desc,
+              mkldnn::memory::dims(strides.begin(), strides.end()),
+              mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
+              mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+              mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+              mkldnn::padding_kind::zero},
+             conv_attr,
+             mkldnn_utils::global_cpu_engine},
+            *m_mkldnn_primitives[input_data_index],
+            *m_mkldnn_primitives[weights_index],
+            *m_mkldnn_primitives[result_index]));
+
+        m_primitive_deps[conv_index] = {input_data_index, weights_index, result_index};
+    }
+    catch (const mkldnn::error& e)
+    {
+        throw ngraph_error("Could not create mkldnn quantized convolution " + e.message);
+    }
+    return conv_index;
+}
+
+size_t MKLDNNEmitter::build_quantized_convolution_forward(
+    const mkldnn::memory::desc& input_data_desc,
+    const mkldnn::memory::desc& weights_desc,
+    const mkldnn::memory::desc& bias_desc,
+    const mkldnn::memory::desc& result_desc,
+    const ngraph::Strides& strides,
+    const ngraph::Strides& dilation_strides,
+    const ngraph::CoordinateDiff& padding_below,
+    const ngraph::CoordinateDiff& padding_above,
+    float output_scale,
+    const mkldnn::post_ops& pops)
+{
+    const size_t input_data_index = build_memory_primitive(input_data_desc);
+    const size_t weights_index = build_memory_primitive(weights_desc);
+    const size_t bias_index = build_memory_primitive(bias_desc);
+    const size_t result_index = build_memory_primitive(result_desc);
+
+    mkldnn::primitive_attr conv_attr;
+    conv_attr.set_post_ops(pops);
+    conv_attr.set_int_output_round_mode(mkldnn::round_mode::round_nearest);
+    conv_attr.set_output_scales(0, {output_scale});
+
+    size_t conv_index = -1;
+    try
+    {
+        conv_index = insert_primitive(new mkldnn::convolution_forward(
+            {{mkldnn::prop_kind::forward,
+              mkldnn::algorithm::convolution_direct,
+              input_data_desc,
+              weights_desc,
+              bias_desc,
+              result_desc,
+              mkldnn::memory::dims(strides.begin(), strides.end()),
+              mkldnn::memory::dims(dilation_strides.begin(), dilation_strides.end()),
+              mkldnn::memory::dims(padding_below.begin(), padding_below.end()),
+              mkldnn::memory::dims(padding_above.begin(), padding_above.end()),
+              mkldnn::padding_kind::zero},
+             conv_attr,
+             mkldnn_utils::global_cpu_engine},
+            *m_mkldnn_primitives[input_data_index],
+            *m_mkldnn_primitives[weights_index],
+            *m_mkldnn_primitives[bias_index],
+            *m_mkldnn_primitives[result_index]));
+
+        m_primitive_deps[conv_index] = {input_data_index, weights_index, bias_index, result_index};
+    }
+    catch (const mkldnn::error& e)
+    {
+        throw ngraph_error("Could not create mkldnn quantized convolution " + e.message);
+    }
+    return conv_index;
+}
+
+size_t MKLDNNEmitter::build_quantized_convolution(const ngraph::Node* node)
+{
+    auto convolution = static_cast<const ngraph::op::QuantizedConvolution*>(node);
+
+    Strides window_dilation_strides_adjusted;
+    for (size_t s : convolution->get_window_dilation_strides())
+    {
+        window_dilation_strides_adjusted.push_back(s - 1);
+    }
+
+    auto data_desc = mkldnn_utils::get_input_mkldnn_md(node, 0);
+    auto weights_desc = mkldnn_utils::get_input_mkldnn_md(node, 1);
+    if (weights_desc.data.format == mkldnn_nchw)
+    {
+        weights_desc.data.format = mkldnn_oihw;
+    }
+    auto result_desc = mkldnn_utils::get_output_mkldnn_md(node, 0);
+
+    // Zero points are all zero on this path, so the requantization is a single multiplier
+    // applied to the int32 accumulator (plus bias) before the Relu post-op.
+    float output_scale = convolution->get_data_scale() * convolution->get_filter_scale() /
+                         convolution->get_output_scale();
+
+    mkldnn::post_ops ops;
+    if (convolution->with_relu())
+    {
+        const float ops_scale = 1.f;
+        const float ops_alpha = -0.f; // relu negative slope
+        const float ops_beta = 0.f;
+        ops.append_eltwise(ops_scale, mkldnn::algorithm::eltwise_relu, ops_alpha, ops_beta);
+    }
+
+    if (convolution->with_bias())
+    {
+        auto bias_desc = mkldnn_utils::get_input_mkldnn_md(node, 2);
+        return build_quantized_convolution_forward(data_desc,
+                                                   weights_desc,
+                                                   bias_desc,
+                                                   result_desc,
+                                                   convolution->get_window_movement_strides(),
+                                                   window_dilation_strides_adjusted,
+                                                   convolution->get_padding_below(),
+                                                   convolution->get_padding_above(),
+                                                   output_scale,
+                                                   ops);
+    }
+    return build_quantized_convolution_forward(data_desc,
+                                               weights_desc,
+                                               result_desc,
+                                               convolution->get_window_movement_strides(),
+                                               window_dilation_strides_adjusted,
+                                               convolution->get_padding_below(),
+                                               convolution->get_padding_above(),
+                                               output_scale,
+                                               ops);
+}
+
 size_t MKLDNNEmitter::build_convolution_backward_weights_bias(
     const mkldnn::memory::desc& in_data_desc,
     const mkldnn::memory::desc& in_delta_desc,
@@ -432,7 +591,7 @@ size_t MKLDNNEmitter::build_pooling_forward(mkldnn::algorithm pooling_algorithm,
     size_t result_index = build_memory_primitive(result_desc);
 
     size_t primitive_index = insert_primitive(new mkldnn::pooling_forward(
-        {{mkldnn::prop_kind::forward_inference,
+        {{mkldnn::prop_kind::forward,
           pooling_algorithm,
           input_desc,
           result_desc,
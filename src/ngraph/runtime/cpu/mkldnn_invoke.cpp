@@ -35,6 +35,11 @@ extern "C" void ngraph::runtime::cpu::mkldnn_utils::set_memory_ptr(CPURuntimeCon
 extern "C" void ngraph::runtime::cpu::mkldnn_utils::mkldnn_invoke_primitive(CPURuntimeContext* ctx,
                                                                             size_t primitive_index)
 {
+    if (ctx->mkldnn_defer_primitives)
+    {
+        ctx->mkldnn_pending_primitives.push_back(ctx->mkldnn_primitives[primitive_index]);
+        return;
+    }
     mkldnn::stream s(mkldnn::stream::kind::eager);
     try
     {
@@ -45,3 +50,28 @@ extern "C" void ngraph::runtime::cpu::mkldnn_utils::mkldnn_invoke_primitive(CPUR
         throw ngraph_error("Could not run mkdnn primitive " + e.message);
     }
 }
+
+extern "C" void ngraph::runtime::cpu::mkldnn_utils::mkldnn_flush_primitives(CPURuntimeContext* ctx)
+{
+    if (ctx->mkldnn_pending_primitives.empty())
+    {
+        return;
+    }
+    std::vector<mkldnn::primitive> primitives;
+    primitives.reserve(ctx->mkldnn_pending_primitives.size());
+    for (mkldnn::primitive* primitive : ctx->mkldnn_pending_primitives)
+    {
+        primitives.push_back(*primitive);
+    }
+    ctx->mkldnn_pending_primitives.clear();
+
+    mkldnn::stream s(mkldnn::stream::kind::eager);
+    try
+    {
+        s.submit(primitives).wait();
+    }
+    catch (const mkldnn::error& e)
+    {
+        throw ngraph_error("Could not run mkdnn primitive " + e.message);
+    }
+}
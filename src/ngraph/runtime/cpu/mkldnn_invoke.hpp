@@ -32,6 +32,8 @@ namespace ngraph
                     set_memory_ptr(CPURuntimeContext* ctx, size_t primitive_index, void* ptr);
                 extern "C" void mkldnn_invoke_primitive(CPURuntimeContext* ctx,
                                                         size_t primitive_index);
+                // Runs the primitives queued by mkldnn_invoke_primitive in a single stream
+                extern "C" void mkldnn_flush_primitives(CPURuntimeContext* ctx);
             }
         }
     }
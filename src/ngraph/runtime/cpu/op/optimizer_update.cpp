@@ -0,0 +1,116 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// All inputs of an update are elementwise, so they must agree with the weights
+static void check_update_args(const string& op_name, const NodeVector& args)
+{
+    const auto& weights = args.at(0);
+    if (!weights->get_element_type().is_real())
+    {
+        throw ngraph_error(op_name + " weights must be floating point");
+    }
+    for (const auto& arg : args)
+    {
+        if (arg->get_element_type() != weights->get_element_type() ||
+            arg->get_shape() != weights->get_shape())
+        {
+            throw ngraph_error(op_name + " arguments must have the type and shape of the weights");
+        }
+    }
+}
+
+op::SGDUpdate::SGDUpdate(shared_ptr<Node> weights, shared_ptr<Node> gradient, float learning_rate)
+    : RequiresTensorViewArgs("SGDUpdate", {weights, gradient})
+    , m_learning_rate(learning_rate)
+{
+    check_update_args("SGDUpdate", {weights, gradient});
+    set_value_type_checked(weights->get_element_type(), weights->get_shape());
+}
+
+shared_ptr<Node> op::SGDUpdate::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 2)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<SGDUpdate>(new_args.at(0), new_args.at(1), m_learning_rate);
+}
+
+op::MomentumUpdate::MomentumUpdate(shared_ptr<Node> weights,
+                                   shared_ptr<Node> velocity,
+                                   shared_ptr<Node> gradient,
+                                   float learning_rate,
+                                   float momentum)
+    : RequiresTensorViewArgs("MomentumUpdate", {weights, velocity, gradient})
+    , m_learning_rate(learning_rate)
+    , m_momentum(momentum)
+{
+    check_update_args("MomentumUpdate", {weights, velocity, gradient});
+    add_output(weights->get_element_type(), weights->get_shape());
+    add_output(velocity->get_element_type(), velocity->get_shape());
+}
+
+shared_ptr<Node> op::MomentumUpdate::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 3)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<MomentumUpdate>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_learning_rate, m_momentum);
+}
+
+op::AdamUpdate::AdamUpdate(shared_ptr<Node> weights,
+                           shared_ptr<Node> m,
+                           shared_ptr<Node> v,
+                           shared_ptr<Node> gradient,
+                           float learning_rate,
+                           float beta1,
+                           float beta2,
+                           float epsilon)
+    : RequiresTensorViewArgs("AdamUpdate", {weights, m, v, gradient})
+    , m_learning_rate(learning_rate)
+    , m_beta1(beta1)
+    , m_beta2(beta2)
+    , m_epsilon(epsilon)
+{
+    check_update_args("AdamUpdate", {weights, m, v, gradient});
+    add_output(weights->get_element_type(), weights->get_shape());
+    add_output(m->get_element_type(), m->get_shape());
+    add_output(v->get_element_type(), v->get_shape());
+}
+
+shared_ptr<Node> op::AdamUpdate::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 4)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<AdamUpdate>(new_args.at(0),
+                                   new_args.at(1),
+                                   new_args.at(2),
+                                   new_args.at(3),
+                                   m_learning_rate,
+                                   m_beta1,
+                                   m_beta2,
+                                   m_epsilon);
+}
@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/node.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Stochastic gradient descent step, weights - learning_rate * gradient.
+        ///
+        /// Output 0 may share memory with the weights.
+        class SGDUpdate : public util::RequiresTensorViewArgs
+        {
+        public:
+            /// \brief Constructs a SGDUpdate operation.
+            ///
+            /// \param weights Weights to update.
+            /// \param gradient Gradient of the loss with respect to the weights.
+            /// \param learning_rate Step size.
+            SGDUpdate(std::shared_ptr<Node> weights,
+                      std::shared_ptr<Node> gradient,
+                      float learning_rate);
+
+            float get_learning_rate() const { return m_learning_rate; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        private:
+            float m_learning_rate;
+        };
+
+        /// \brief Gradient descent step with momentum.
+        ///
+        /// Computes velocity' = momentum * velocity + gradient and
+        /// weights' = weights - learning_rate * velocity', as outputs 0 (weights') and
+        /// 1 (velocity'). Each output may share memory with the matching input.
+        class MomentumUpdate : public util::RequiresTensorViewArgs
+        {
+        public:
+            MomentumUpdate(std::shared_ptr<Node> weights,
+                           std::shared_ptr<Node> velocity,
+                           std::shared_ptr<Node> gradient,
+                           float learning_rate,
+                           float momentum);
+
+            float get_learning_rate() const { return m_learning_rate; }
+            float get_momentum() const { return m_momentum; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        private:
+            float m_learning_rate;
+            float m_momentum;
+        };
+
+        /// \brief Adam step without bias correction.
+        ///
+        /// Computes m' = beta1 * m + (1 - beta1) * gradient,
+        /// v' = beta2 * v + (1 - beta2) * gradient^2 and
+        /// weights' = weights - learning_rate * m' / (sqrt(v') + epsilon), as outputs
+        /// 0 (weights'), 1 (m') and 2 (v'). Each output may share memory with the matching input.
+        class AdamUpdate : public util::RequiresTensorViewArgs
+        {
+        public:
+            AdamUpdate(std::shared_ptr<Node> weights,
+                       std::shared_ptr<Node> m,
+                       std::shared_ptr<Node> v,
+                       std::shared_ptr<Node> gradient,
+                       float learning_rate,
+                       float beta1,
+                       float beta2,
+                       float epsilon);
+
+            float get_learning_rate() const { return m_learning_rate; }
+            float get_beta1() const { return m_beta1; }
+            float get_beta2() const { return m_beta2; }
+            float get_epsilon() const { return m_epsilon; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        private:
+            float m_learning_rate;
+            float m_beta1;
+            float m_beta2;
+            float m_epsilon;
+        };
+    }
+}
@@ -32,6 +32,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/lrn.hpp"
 #include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
@@ -43,6 +44,7 @@
 #include "ngraph/runtime/cpu/op/group_conv.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 
@@ -315,6 +317,31 @@ namespace ngraph
                     }
                 }
 
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::QuantizedConvolution)
+                {
+                    auto convolution = static_cast<op::QuantizedConvolution*>(node);
+
+                    auto data_rank = node->get_input_shape(0).size();
+                    auto weights_rank = node->get_input_shape(1).size();
+
+                    // MKLDNN int8 convolutions take u8 activations and s8 weights and have no
+                    // notion of zero points, so anything else runs on the reference kernel
+                    bool symmetric = convolution->get_data_zero_point() == 0 &&
+                                     convolution->get_filter_zero_point() == 0 &&
+                                     convolution->get_output_zero_point() == 0;
+
+                    if (symmetric && data_rank == 4 && weights_rank == 4 &&
+                        node->get_input_element_type(0) == element::u8 &&
+                        node->get_input_element_type(1) == element::i8)
+                    {
+                        auto op_annotations =
+                            std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                        op_annotations->set_mkldnn_op(true);
+                        convolution->set_op_annotations(op_annotations);
+                    }
+                }
+
                 template <>
                 void CPUAssignment::ASSIGN_DECL(ngraph::op::ConvolutionBiasBackpropFiltersBias)
                 {
@@ -659,6 +686,44 @@ namespace ngraph
                         bounded_relu->set_op_annotations(op_annotations);
                     }
                 }
+
+                // The first states inputs of an optimizer update (weights and optimizer state)
+                // may be overwritten by the matching outputs when nothing else reads them.
+                // Parameters and constants are never overwritten, so this only applies to
+                // states computed in the function, such as the outputs of an earlier step.
+                static void assign_in_place_update(ngraph::op::Op* update, size_t states)
+                {
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                    for (size_t i = 0; i < states; i++)
+                    {
+                        auto arg = update->get_argument(i);
+                        if (!arg->is_parameter() && !arg->is_constant() &&
+                            get_user_count(arg.get()) == 1)
+                        {
+                            op_annotations->add_in_place_oi_pair({i, i, true});
+                        }
+                    }
+                    update->set_op_annotations(op_annotations);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::SGDUpdate)
+                {
+                    assign_in_place_update(static_cast<ngraph::op::SGDUpdate*>(node), 1);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::MomentumUpdate)
+                {
+                    assign_in_place_update(static_cast<ngraph::op::MomentumUpdate*>(node), 2);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::AdamUpdate)
+                {
+                    assign_in_place_update(static_cast<ngraph::op::AdamUpdate*>(node), 3);
+                }
             }
         }
     }
@@ -675,6 +740,11 @@ static const runtime::cpu::pass::AssignOpMap s_dispatcher{
     {TI(ngraph::op::BatchNorm), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::BatchNorm>},
     {TI(ngraph::op::BoundedRelu),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::BoundedRelu>},
+    {TI(ngraph::op::SGDUpdate), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::SGDUpdate>},
+    {TI(ngraph::op::MomentumUpdate),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::MomentumUpdate>},
+    {TI(ngraph::op::AdamUpdate),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::AdamUpdate>},
     {TI(ngraph::op::BatchNormBackprop),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::BatchNormBackprop>},
     {TI(ngraph::op::Convolution),
@@ -702,6 +772,8 @@ static const runtime::cpu::pass::AssignOpMap s_dispatcher{
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::ConvolutionBias>},
     {TI(ngraph::op::ConvolutionBiasBackpropFiltersBias),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::ConvolutionBiasBackpropFiltersBias>},
+    {TI(ngraph::op::QuantizedConvolution),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::QuantizedConvolution>},
     {TI(ngraph::op::LRN), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::LRN>},
     {TI(ngraph::op::Relu), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Relu>},
     {TI(ngraph::op::ReluBackprop),
@@ -15,7 +15,9 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include <unordered_set>
 
@@ -53,6 +55,7 @@
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/util.hpp"
 
@@ -1287,3 +1290,223 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_bounded_relu()
     auto m = std::make_shared<pattern::Matcher>(min, callback);
     this->add_matcher(m);
 }
+
+// Reads a constant whose elements all hold the same f32 value
+static bool get_uniform_f32_constant(std::shared_ptr<ngraph::Node> node, float& value)
+{
+    auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node);
+    if (!constant || constant->get_element_type() != ngraph::element::f32)
+    {
+        return false;
+    }
+    auto values = constant->get_vector<float>();
+    if (values.empty() ||
+        std::any_of(values.begin(), values.end(), [&](float v) { return v != values[0]; }))
+    {
+        return false;
+    }
+    value = values[0];
+    return true;
+}
+
+// Label for a scalar hyperparameter, possibly broadcast to the shape of the weights
+static std::shared_ptr<ngraph::Node>
+    make_hyperparameter_label(std::shared_ptr<ngraph::pattern::op::Label>& label)
+{
+    auto constant_pred = [](std::shared_ptr<ngraph::Node> n) {
+        return std::dynamic_pointer_cast<ngraph::op::Constant>(n) != nullptr;
+    };
+    auto broadcast_pred = [](std::shared_ptr<ngraph::Node> n) {
+        return std::dynamic_pointer_cast<ngraph::op::Broadcast>(n) != nullptr;
+    };
+    label = std::make_shared<ngraph::pattern::op::Label>(
+        ngraph::element::f32, ngraph::Shape{}, constant_pred);
+    return std::make_shared<ngraph::pattern::op::Skip>(label, broadcast_pred);
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_sgd_update()
+{
+    auto weights = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto gradient = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    std::shared_ptr<pattern::op::Label> learning_rate;
+    auto scaled_gradient =
+        std::make_shared<op::Multiply>(make_hyperparameter_label(learning_rate), gradient);
+    auto updated_weights = std::make_shared<op::Subtract>(weights, scaled_gradient);
+
+    pattern::graph_rewrite_callback callback = [weights, gradient, learning_rate](
+        pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_sgd_update against "
+                     << m.get_match_root()->get_name();
+
+        auto pattern_map = m.get_pattern_map();
+        float lr;
+        if (m.get_match_root()->get_element_type() != element::f32 ||
+            !get_uniform_f32_constant(pattern_map[learning_rate], lr))
+        {
+            return false;
+        }
+        if (pattern_map[gradient]->get_shape() != m.get_match_root()->get_shape() ||
+            pattern_map[weights]->get_shape() != m.get_match_root()->get_shape())
+        {
+            return false;
+        }
+
+        auto sgd = std::make_shared<op::SGDUpdate>(pattern_map[weights], pattern_map[gradient], lr);
+        ngraph::replace_node(m.get_match_root(), sgd);
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(updated_weights, callback);
+    this->add_matcher(m);
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_momentum_update()
+{
+    auto weights = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto velocity = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto gradient = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    std::shared_ptr<pattern::op::Label> learning_rate;
+    std::shared_ptr<pattern::op::Label> momentum;
+
+    auto decayed_velocity =
+        std::make_shared<op::Multiply>(make_hyperparameter_label(momentum), velocity);
+    auto new_velocity = std::make_shared<op::Add>(decayed_velocity, gradient);
+    auto new_velocity_label =
+        std::make_shared<pattern::op::Label>(new_velocity, nullptr, NodeVector{new_velocity});
+    auto step = std::make_shared<op::Multiply>(make_hyperparameter_label(learning_rate),
+                                               new_velocity_label);
+    auto updated_weights = std::make_shared<op::Subtract>(weights, step);
+
+    pattern::graph_rewrite_callback callback =
+        [weights, velocity, gradient, learning_rate, momentum, new_velocity_label](
+            pattern::Matcher& m) {
+            NGRAPH_DEBUG << "In a callback for construct_momentum_update against "
+                         << m.get_match_root()->get_name();
+
+            auto pattern_map = m.get_pattern_map();
+            float lr;
+            float mu;
+            if (m.get_match_root()->get_element_type() != element::f32 ||
+                !get_uniform_f32_constant(pattern_map[learning_rate], lr) ||
+                !get_uniform_f32_constant(pattern_map[momentum], mu))
+            {
+                return false;
+            }
+            const Shape& shape = m.get_match_root()->get_shape();
+            if (pattern_map[weights]->get_shape() != shape ||
+                pattern_map[velocity]->get_shape() != shape ||
+                pattern_map[gradient]->get_shape() != shape)
+            {
+                return false;
+            }
+
+            auto update = std::make_shared<op::MomentumUpdate>(
+                pattern_map[weights], pattern_map[velocity], pattern_map[gradient], lr, mu);
+            auto goe0 = std::make_shared<op::GetOutputElement>(update, 0);
+            auto goe1 = std::make_shared<op::GetOutputElement>(update, 1);
+            ngraph::replace_node(m.get_match_root(), goe0);
+            ngraph::replace_node(pattern_map[new_velocity_label], goe1);
+            return true;
+        };
+
+    auto m = std::make_shared<pattern::Matcher>(updated_weights, callback);
+    this->add_matcher(m);
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_adam_update()
+{
+    auto weights = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto m1 = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto m2 = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto gradient = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    std::shared_ptr<pattern::op::Label> learning_rate;
+    std::shared_ptr<pattern::op::Label> beta1;
+    std::shared_ptr<pattern::op::Label> beta2;
+    std::shared_ptr<pattern::op::Label> one_minus_beta1;
+    std::shared_ptr<pattern::op::Label> one_minus_beta2;
+    std::shared_ptr<pattern::op::Label> epsilon;
+
+    // m' = beta1 * m + (1 - beta1) * g
+    auto new_m1 = std::make_shared<op::Add>(
+        std::make_shared<op::Multiply>(make_hyperparameter_label(beta1), m1),
+        std::make_shared<op::Multiply>(make_hyperparameter_label(one_minus_beta1), gradient));
+    auto new_m1_label = std::make_shared<pattern::op::Label>(new_m1, nullptr, NodeVector{new_m1});
+
+    // v' = beta2 * v + (1 - beta2) * g * g
+    auto new_m2 = std::make_shared<op::Add>(
+        std::make_shared<op::Multiply>(make_hyperparameter_label(beta2), m2),
+        std::make_shared<op::Multiply>(make_hyperparameter_label(one_minus_beta2),
+                                       std::make_shared<op::Multiply>(gradient, gradient)));
+    auto new_m2_label = std::make_shared<pattern::op::Label>(new_m2, nullptr, NodeVector{new_m2});
+
+    // w' = w - lr * m' / (sqrt(v') + epsilon)
+    auto denominator = std::make_shared<op::Add>(std::make_shared<op::Sqrt>(new_m2_label),
+                                                 make_hyperparameter_label(epsilon));
+    auto step = std::make_shared<op::Divide>(
+        std::make_shared<op::Multiply>(make_hyperparameter_label(learning_rate), new_m1_label),
+        denominator);
+    auto updated_weights = std::make_shared<op::Subtract>(weights, step);
+
+    pattern::graph_rewrite_callback callback = [weights,
+                                                m1,
+                                                m2,
+                                                gradient,
+                                                learning_rate,
+                                                beta1,
+                                                beta2,
+                                                one_minus_beta1,
+                                                one_minus_beta2,
+                                                epsilon,
+                                                new_m1_label,
+                                                new_m2_label](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_adam_update against "
+                     << m.get_match_root()->get_name();
+
+        auto pattern_map = m.get_pattern_map();
+        float lr, b1, b2, c1, c2, eps;
+        if (m.get_match_root()->get_element_type() != element::f32 ||
+            !get_uniform_f32_constant(pattern_map[learning_rate], lr) ||
+            !get_uniform_f32_constant(pattern_map[beta1], b1) ||
+            !get_uniform_f32_constant(pattern_map[beta2], b2) ||
+            !get_uniform_f32_constant(pattern_map[one_minus_beta1], c1) ||
+            !get_uniform_f32_constant(pattern_map[one_minus_beta2], c2) ||
+            !get_uniform_f32_constant(pattern_map[epsilon], eps))
+        {
+            return false;
+        }
+
+        // The gradient coefficients are folded into the op as 1 - beta
+        const float tolerance = 4 * std::numeric_limits<float>::epsilon();
+        if (std::abs(c1 - (1.0f - b1)) > tolerance || std::abs(c2 - (1.0f - b2)) > tolerance)
+        {
+            NGRAPH_DEBUG << "Adam gradient coefficients are not 1 - beta";
+            return false;
+        }
+
+        const Shape& shape = m.get_match_root()->get_shape();
+        if (pattern_map[weights]->get_shape() != shape || pattern_map[m1]->get_shape() != shape ||
+            pattern_map[m2]->get_shape() != shape || pattern_map[gradient]->get_shape() != shape)
+        {
+            return false;
+        }
+
+        auto update = std::make_shared<op::AdamUpdate>(pattern_map[weights],
+                                                       pattern_map[m1],
+                                                       pattern_map[m2],
+                                                       pattern_map[gradient],
+                                                       lr,
+                                                       b1,
+                                                       b2,
+                                                       eps);
+        auto goe0 = std::make_shared<op::GetOutputElement>(update, 0);
+        auto goe1 = std::make_shared<op::GetOutputElement>(update, 1);
+        auto goe2 = std::make_shared<op::GetOutputElement>(update, 2);
+        ngraph::replace_node(m.get_match_root(), goe0);
+        ngraph::replace_node(pattern_map[new_m1_label], goe1);
+        ngraph::replace_node(pattern_map[new_m2_label], goe2);
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(updated_weights, callback);
+    this->add_matcher(m);
+}
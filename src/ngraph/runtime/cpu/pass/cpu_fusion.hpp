@@ -65,6 +65,9 @@ public:
             construct_conv_bias_add();
             construct_conv_bias_add_relu();
             construct_bounded_relu();
+            construct_momentum_update();
+            construct_adam_update();
+            construct_sgd_update();
         }
 
         if (fusions & DIFFERENTIABLE_FUSIONS)
@@ -91,4 +94,7 @@ private:
     void construct_conv_bias_add();
     void construct_conv_bias_add_relu();
     void construct_bounded_relu();
+    void construct_sgd_update();
+    void construct_momentum_update();
+    void construct_adam_update();
 };
@@ -23,12 +23,17 @@
 #include "ngraph/log.hpp"
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
 #include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
 #include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
 #include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
@@ -56,6 +61,7 @@ public:
     {
         for (auto n : f->get_ordered_ops())
         {
+            m_order.insert(std::make_pair(n, m_order.size()));
             if (is_fusible(n))
             {
                 auto arg_from_fusible_group = collect_fusible_args(n);
@@ -74,7 +80,9 @@ public:
                     lkgraph.m_nodes.push_back(n);
                     for (auto arg : n->get_arguments())
                     {
-                        if (is_leaf(arg))
+                        if (!is_member(arg, smallest_head) &&
+                            std::find(lkgraph.m_inputs.begin(), lkgraph.m_inputs.end(), arg) ==
+                                lkgraph.m_inputs.end())
                         {
                             lkgraph.m_inputs.push_back(arg);
                         }
@@ -108,14 +116,27 @@ private:
     {
         static const std::set<std::type_index> fusible_ops_set{TI(ngraph::op::Abs),
                                                                TI(ngraph::op::Add),
+                                                               TI(ngraph::op::Divide),
+                                                               TI(ngraph::op::Exp),
+                                                               TI(ngraph::op::Maximum),
+                                                               TI(ngraph::op::Minimum),
+                                                               TI(ngraph::op::Multiply),
                                                                TI(ngraph::op::Negative),
-                                                               TI(ngraph::op::Subtract),
                                                                TI(ngraph::op::Relu),
-                                                               TI(ngraph::op::Minimum),
-                                                               TI(ngraph::op::Maximum)};
+                                                               TI(ngraph::op::Sigmoid),
+                                                               TI(ngraph::op::Subtract),
+                                                               TI(ngraph::op::Tanh)};
 
         const Node& node = *n;
-        return fusible_ops_set.count(TI(node)) != 0;
+        if (fusible_ops_set.count(TI(node)) == 0)
+        {
+            return false;
+        }
+
+        // Loop kernels only read and write tensors in the native layout, so tensors that
+        // MKLDNN keeps in blocked layouts (rank 4 and up) are left to their MKLDNN ops
+        auto& et = n->get_element_type();
+        return (et == element::f32 || et == element::f64) && n->get_shape().size() < 4;
 
         // return (std::dynamic_pointer_cast<op::util::BinaryElementwiseArithmetic>(n) ||
         //         std::dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(n));
@@ -144,6 +165,12 @@ private:
         NGRAPH_DEBUG << "Inputs: " << m_graphs.at(head).m_inputs << std::endl;
     }
 
+    bool is_member(std::shared_ptr<Node> n, std::shared_ptr<Node> head) const
+    {
+        auto it = m_heads.find(n);
+        return it != m_heads.end() && it->second == head;
+    }
+
     std::shared_ptr<Node> collect_fusible_args(std::shared_ptr<Node> n)
     {
         std::shared_ptr<Node> arg_from_fusible_group;
@@ -166,11 +193,27 @@ private:
                 }
             }
         }
+
+        //an argument computed outside the group after the group's head may depend on
+        //a member, and the loop kernel would then depend on itself
+        if (arg_from_fusible_group)
+        {
+            auto head = m_heads.at(arg_from_fusible_group);
+            for (auto arg : n->get_arguments())
+            {
+                if (!is_leaf(arg) && !is_member(arg, head) &&
+                    m_order.at(arg) > m_order.at(head))
+                {
+                    return {nullptr};
+                }
+            }
+        }
         return arg_from_fusible_group;
     }
 
     std::unordered_map<std::shared_ptr<Node>, LKGraph> m_graphs;
     std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<Node>> m_heads;
+    std::unordered_map<std::shared_ptr<Node>, size_t> m_order;
 };
 
 bool ngraph::runtime::cpu::pass::CPULoopKernelFusion::run_on_function(
@@ -29,7 +29,9 @@
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/skip.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
 
@@ -116,3 +118,51 @@ void ngraph::runtime::cpu::pass::CPUPostLayoutOptimizations::construct_weight_fu
     auto m = make_shared<pattern::Matcher>(conv, callback);
     this->add_matcher(m);
 }
+
+void ngraph::runtime::cpu::pass::CPUPostLayoutOptimizations::construct_constant_convert_layout()
+{
+    auto w_const = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{16, 4, 3, 3}, pattern::has_class<ngraph::op::Constant>());
+    auto tvt = w_const->get_outputs().at(0).get_tensor_view().get();
+    auto lt_desc = std::make_shared<runtime::cpu::LayoutDescriptor>(*tvt);
+    auto cvt_lt = std::make_shared<runtime::cpu::op::ConvertLayout>(w_const, lt_desc);
+
+    pattern::graph_rewrite_callback callback = [w_const](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_constant_convert_layout against "
+                     << m.get_match_root()->get_name();
+
+        auto m_cvt_lt = m.get_match_root();
+        auto m_w_const =
+            std::static_pointer_cast<ngraph::op::Constant>(m.get_pattern_map()[w_const]);
+        auto input_desc = mkldnn_utils::get_input_mkldnn_md(m_cvt_lt.get(), 0);
+        auto result_desc = mkldnn_utils::get_output_mkldnn_md(m_cvt_lt.get(), 0);
+        auto layout = m_cvt_lt->get_output_tensor_view()->get_tensor_view_layout();
+
+        // Blocked MKLDNN layouts may pad the tensor, so the reordered data can take more
+        // space than the shape implies
+        auto buffer = std::make_shared<runtime::AlignedBuffer>(layout->get_allocated_size(), 64);
+        try
+        {
+            mkldnn::memory input({input_desc, mkldnn_utils::global_cpu_engine},
+                                 const_cast<void*>(m_w_const->get_data_ptr()));
+            mkldnn::memory result({result_desc, mkldnn_utils::global_cpu_engine},
+                                  buffer->get_ptr());
+            mkldnn::stream s(mkldnn::stream::kind::eager);
+            s.submit({mkldnn::reorder(input, result)}).wait();
+        }
+        catch (const mkldnn::error& e)
+        {
+            NGRAPH_DEBUG << "Could not reorder " << m_w_const->get_name() << ": " << e.message;
+            return false;
+        }
+
+        auto new_const = std::make_shared<ngraph::op::Constant>(
+            m_w_const->get_element_type(), m_cvt_lt->get_shape(), buffer->get_ptr(), buffer);
+        new_const->get_output_tensor_view()->set_tensor_view_layout(layout);
+        ngraph::replace_node(m_cvt_lt, new_const);
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(cvt_lt, callback);
+    this->add_matcher(m);
+}
@@ -38,6 +38,9 @@ public:
         : GraphRewrite()
     {
         construct_weight_fusion();
+        construct_constant_convert_layout();
     }
     void construct_weight_fusion();
+    /// Reorders constants into the layout their users expect at compile time
+    void construct_constant_convert_layout();
 };
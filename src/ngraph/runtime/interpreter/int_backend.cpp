@@ -22,6 +22,7 @@
 #include "ngraph/pass/assign_layout.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -65,52 +66,36 @@ bool runtime::interpreter::INTBackend::compile(shared_ptr<Function> function)
         pass::Manager pass_manager;
         pass_manager.register_pass<pass::AssignLayout<DenseTensorViewLayout>>();
         pass_manager.register_pass<pass::Liveness>();
+        pass_manager.register_pass<pass::MemoryLayout>(runtime::alignment);
         pass_manager.run_passes(function);
+
+        build_plan(function, instance);
     }
 
     return true;
 }
 
-bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
-                                            const vector<shared_ptr<runtime::TensorView>>& outputs,
-                                            const vector<shared_ptr<runtime::TensorView>>& inputs)
+void runtime::interpreter::INTBackend::build_plan(shared_ptr<Function> function,
+                                                  FunctionInstance& instance)
 {
-    validate_call(function, outputs, inputs);
-
-    compile(function);
-    FunctionInstance& instance = m_function_map[function];
-
-    // convert inputs to HostTensorView
-    vector<shared_ptr<runtime::HostTensorView>> func_inputs;
-    for (auto tv : inputs)
-    {
-        func_inputs.push_back(static_pointer_cast<runtime::HostTensorView>(tv));
-    }
-    if (instance.m_nan_check_enabled)
-    {
-        perform_nan_check(func_inputs);
-    }
+    // All intermediate tensors share one buffer laid out by pass::MemoryLayout
+    instance.m_arena.reset(
+        new AlignedBuffer(function->get_temporary_pool_size(), runtime::alignment));
 
-    // convert outputs to HostTensorView
-    vector<shared_ptr<runtime::HostTensorView>> func_outputs;
-    for (auto tv : outputs)
-    {
-        func_outputs.push_back(static_pointer_cast<runtime::HostTensorView>(tv));
-    }
-
-    // map function params -> HostTensorView
-    unordered_map<descriptor::TensorView*, shared_ptr<runtime::HostTensorView>> tensor_map;
+    // map function params -> call input index
+    unordered_map<descriptor::TensorView*, size_t> input_index;
     size_t input_count = 0;
     for (auto param : function->get_parameters())
     {
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
             descriptor::TensorView* tv = param->get_output_tensor_view(i).get();
-            tensor_map.insert({tv, func_inputs[input_count++]});
+            input_index.insert({tv, input_count++});
         }
     }
 
-    // map function outputs -> HostTensorView
+    // map function outputs -> call output index
+    unordered_map<descriptor::TensorView*, size_t> output_index;
     for (size_t output_count = 0; output_count < function->get_output_size(); ++output_count)
     {
         auto output = function->get_output_op(output_count);
@@ -119,46 +104,33 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
             throw ngraph_error("One of function's outputs isn't op::Result");
         }
         descriptor::TensorView* tv = output->get_output_tensor_view(0).get();
-        tensor_map.insert({tv, func_outputs[output_count]});
+        output_index.insert({tv, output_count});
     }
 
-    // for each ordered op in the graph
+    unordered_map<descriptor::TensorView*, shared_ptr<runtime::HostTensorView>> tensor_map;
     for (shared_ptr<Node> op : function->get_ordered_ops())
     {
-        if (op->description() == "Parameter")
+        if (op->is_parameter())
         {
             continue;
         }
 
-        // get op inputs from map
-        vector<shared_ptr<runtime::HostTensorView>> op_inputs;
-        for (const descriptor::Input& input : op->get_inputs())
+        // Constants are read in place rather than copied on every call
+        if (auto constant = dynamic_pointer_cast<op::Constant>(op))
         {
-            descriptor::TensorView* tv = input.get_output().get_tensor_view().get();
-            op_inputs.push_back(tensor_map.at(tv));
+            descriptor::TensorView* tv = op->get_output_tensor_view(0).get();
+            tensor_map.insert(
+                {tv,
+                 make_shared<runtime::HostTensorView>(op->get_output_element_type(0),
+                                                      op->get_output_shape(0),
+                                                      const_cast<void*>(constant->get_data_ptr()),
+                                                      op->get_output_tensor(0).get_name())});
+            continue;
         }
 
-        // get op outputs from map or create
-        vector<shared_ptr<runtime::HostTensorView>> op_outputs;
-        for (size_t i = 0; i < op->get_output_size(); ++i)
-        {
-            descriptor::TensorView* tv = op->get_output_tensor_view(i).get();
-            shared_ptr<runtime::HostTensorView> htv;
-            if (!contains_key(tensor_map, tv))
-            {
-                // the output tensor is not in the tensor map so create a new tensor
-                const Shape& shape = op->get_output_shape(i);
-                const element::Type& type = op->get_output_element_type(i);
-                string name = op->get_output_tensor(i).get_name();
-                htv = make_shared<runtime::HostTensorView>(type, shape, name);
-                tensor_map.insert({tv, htv});
-            }
-            else
-            {
-                htv = tensor_map.at(tv);
-            }
-            op_outputs.push_back(htv);
-        }
+        PlanStep step;
+        step.m_node = op.get();
+        step.m_op_id = get_typeid(*op);
 
         // get op type
         element::Type type;
@@ -178,87 +150,172 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
         {
             type = op->get_outputs().at(0).get_element_type();
         }
+        step.m_kernel = get_kernel(type, *op);
 
-        if (instance.m_performance_counters_enabled)
+        for (const descriptor::Input& input : op->get_inputs())
         {
-            instance.m_timer_map[op.get()].start();
+            descriptor::TensorView* tv = input.get_output().get_tensor_view().get();
+            auto it = input_index.find(tv);
+            if (it != input_index.end())
+            {
+                instance.m_input_bindings.push_back(
+                    {instance.m_plan.size(), step.m_inputs.size(), it->second});
+                step.m_inputs.push_back(nullptr);
+            }
+            else
+            {
+                step.m_inputs.push_back(tensor_map.at(tv));
+            }
         }
-        generate_calls(type, *op, op_outputs, op_inputs);
+
+        for (size_t i = 0; i < op->get_output_size(); ++i)
+        {
+            descriptor::TensorView* tv = op->get_output_tensor_view(i).get();
+            auto it = output_index.find(tv);
+            if (it != output_index.end())
+            {
+                instance.m_output_bindings.push_back(
+                    {instance.m_plan.size(), step.m_outputs.size(), it->second});
+                step.m_outputs.push_back(nullptr);
+            }
+            else
+            {
+                descriptor::Tensor& tensor = op->get_output_tensor(i);
+                auto htv = make_shared<runtime::HostTensorView>(
+                    tensor.get_element_type(),
+                    op->get_output_shape(i),
+                    instance.m_arena->get_ptr(tensor.get_pool_offset()),
+                    tensor.get_name());
+                tensor_map.insert({tv, htv});
+                step.m_outputs.push_back(htv);
+            }
+        }
+
+        instance.m_plan.push_back(move(step));
+    }
+}
+
+bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
+                                            const vector<shared_ptr<runtime::TensorView>>& outputs,
+                                            const vector<shared_ptr<runtime::TensorView>>& inputs)
+{
+    validate_call(function, outputs, inputs);
+
+    compile(function);
+    FunctionInstance& instance = m_function_map[function];
+
+    // convert inputs to HostTensorView
+    vector<shared_ptr<runtime::HostTensorView>> func_inputs;
+    for (auto tv : inputs)
+    {
+        func_inputs.push_back(static_pointer_cast<runtime::HostTensorView>(tv));
+    }
+    if (instance.m_nan_check_enabled)
+    {
+        perform_nan_check(func_inputs);
+    }
+
+    // bind the caller's tensors into the plan
+    for (const PlanBinding& binding : instance.m_input_bindings)
+    {
+        instance.m_plan[binding.m_step].m_inputs[binding.m_index] = func_inputs[binding.m_tensor];
+    }
+    for (const PlanBinding& binding : instance.m_output_bindings)
+    {
+        instance.m_plan[binding.m_step].m_outputs[binding.m_index] =
+            static_pointer_cast<runtime::HostTensorView>(outputs[binding.m_tensor]);
+    }
+
+    for (PlanStep& step : instance.m_plan)
+    {
         if (instance.m_performance_counters_enabled)
         {
-            instance.m_timer_map[op.get()].stop();
+            instance.m_timer_map[step.m_node].start();
         }
-        if (instance.m_nan_check_enabled)
+        (this->*step.m_kernel)(*step.m_node, step.m_op_id, step.m_outputs, step.m_inputs);
+        if (instance.m_performance_counters_enabled)
         {
-            perform_nan_check(op_outputs, op.get());
+            instance.m_timer_map[step.m_node].stop();
         }
-
-        // delete any obsolete tensors
-        for (const descriptor::Tensor* t : op->liveness_free_list)
+        if (instance.m_nan_check_enabled)
         {
-            for (auto it = tensor_map.begin(); it != tensor_map.end(); ++it)
-            {
-                if (it->second->get_tensor().get_name() == t->get_name())
-                {
-                    tensor_map.erase(it);
-                    break;
-                }
-            }
+            perform_nan_check(step.m_outputs, step.m_node);
         }
     }
 
     return true;
 }
 
-void runtime::interpreter::INTBackend::generate_calls(
-    const element::Type& type,
-    Node& op,
-    const vector<shared_ptr<HostTensorView>>& outputs,
-    const vector<shared_ptr<HostTensorView>>& inputs)
+runtime::interpreter::OP_TYPEID runtime::interpreter::INTBackend::get_typeid(const Node& node)
+{
+// This expands the op list in int_op_tbl.hpp into a list of enumerations that look like this:
+// {"Abs", runtime::interpreter::OP_TYPEID::Abs},
+// {"Acos", runtime::interpreter::OP_TYPEID::Acos},
+// ...
+#define NGRAPH_OP(a) {#a, runtime::interpreter::OP_TYPEID::a},
+    static const unordered_map<string, OP_TYPEID> typeid_map{
+#include "ngraph/runtime/interpreter/int_op_tbl.hpp"
+    };
+#undef NGRAPH_OP
+    auto it = typeid_map.find(node.description());
+    return it == typeid_map.end() ? OP_TYPEID::UnknownOp : it->second;
+}
+
+runtime::interpreter::INTBackend::OpKernel
+    runtime::interpreter::INTBackend::get_kernel(const element::Type& type, const Node& op)
 {
+    OpKernel kernel;
     if (type == element::boolean)
     {
-        op_engine<char>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<char>;
+    }
+    else if (type == element::bf16)
+    {
+        kernel = &INTBackend::op_engine<bfloat16>;
+    }
+    else if (type == element::f16)
+    {
+        kernel = &INTBackend::op_engine<float16>;
     }
     else if (type == element::f32)
     {
-        op_engine<float>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<float>;
     }
     else if (type == element::f64)
     {
-        op_engine<double>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<double>;
     }
     else if (type == element::i8)
     {
-        op_engine<int8_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<int8_t>;
     }
     else if (type == element::i16)
     {
-        op_engine<int16_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<int16_t>;
     }
     else if (type == element::i32)
     {
-        op_engine<int32_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<int32_t>;
     }
     else if (type == element::i64)
     {
-        op_engine<int64_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<int64_t>;
     }
     else if (type == element::u8)
     {
-        op_engine<uint8_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<uint8_t>;
     }
     else if (type == element::u16)
     {
-        op_engine<uint16_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<uint16_t>;
     }
     else if (type == element::u32)
     {
-        op_engine<uint32_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<uint32_t>;
     }
     else if (type == element::u64)
     {
-        op_engine<uint64_t>(op, outputs, inputs);
+        kernel = &INTBackend::op_engine<uint64_t>;
     }
     else
     {
@@ -266,6 +323,7 @@ void runtime::interpreter::INTBackend::generate_calls(
         ss << "unsupported element type " << type << " op " << op.get_name();
         throw ngraph_error(ss.str());
     }
+    return kernel;
 }
 
 void runtime::interpreter::INTBackend::set_nan_check(shared_ptr<Function> func, bool enable)
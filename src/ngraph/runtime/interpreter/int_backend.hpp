@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/host_tensor_view.hpp"
 #include "ngraph/runtime/tensor_view.hpp"
@@ -33,6 +34,7 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/lrn.hpp"
@@ -42,6 +44,8 @@
 #include "ngraph/op/one_hot.hpp"
 #include "ngraph/op/pad.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/replace_slice.hpp"
@@ -73,6 +77,7 @@
 #include "ngraph/runtime/reference/copy.hpp"
 #include "ngraph/runtime/reference/cos.hpp"
 #include "ngraph/runtime/reference/cosh.hpp"
+#include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/divide.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
 #include "ngraph/runtime/reference/equal.hpp"
@@ -98,6 +103,8 @@
 #include "ngraph/runtime/reference/pad.hpp"
 #include "ngraph/runtime/reference/power.hpp"
 #include "ngraph/runtime/reference/product.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/runtime/reference/quantized_convolution.hpp"
 #include "ngraph/runtime/reference/reduce.hpp"
 #include "ngraph/runtime/reference/reduce_window.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
@@ -131,6 +138,18 @@ namespace ngraph
         namespace interpreter
         {
             class INTBackend;
+
+// This expands the op list in int_op_tbl.hpp into a list of enumerations that look like this:
+// Abs,
+// Acos,
+// ...
+#define NGRAPH_OP(a) a,
+            enum class OP_TYPEID
+            {
+#include "ngraph/runtime/interpreter/int_op_tbl.hpp"
+                UnknownOp
+            };
+#undef NGRAPH_OP
         }
     }
 }
@@ -156,6 +175,33 @@ public:
         get_performance_data(std::shared_ptr<Function> func) const override;
 
 private:
+    using OpKernel = void (INTBackend::*)(Node& node,
+                                          OP_TYPEID op_id,
+                                          const std::vector<std::shared_ptr<HostTensorView>>& out,
+                                          const std::vector<std::shared_ptr<HostTensorView>>& args);
+
+    /// One op of a compiled function with its kernel and tensors resolved. Function parameters
+    /// and results are bound into m_inputs and m_outputs on each call, all other tensors live
+    /// in the function's arena or are views of constant data.
+    class PlanStep
+    {
+    public:
+        Node* m_node;
+        OP_TYPEID m_op_id;
+        OpKernel m_kernel;
+        std::vector<std::shared_ptr<HostTensorView>> m_inputs;
+        std::vector<std::shared_ptr<HostTensorView>> m_outputs;
+    };
+
+    /// Where a function parameter or result is used in the plan
+    class PlanBinding
+    {
+    public:
+        size_t m_step;
+        size_t m_index;
+        size_t m_tensor;
+    };
+
     class FunctionInstance
     {
     public:
@@ -163,57 +209,93 @@ private:
         bool m_nan_check_enabled = false;
         bool m_performance_counters_enabled = false;
         std::unordered_map<const Node*, stopwatch> m_timer_map;
+        std::vector<PlanStep> m_plan;
+        std::vector<PlanBinding> m_input_bindings;
+        std::vector<PlanBinding> m_output_bindings;
+        std::unique_ptr<AlignedBuffer> m_arena;
     };
     std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensorView>>&,
                                   const Node* op = nullptr);
 
-    void generate_calls(const element::Type& type,
-                        Node& op,
-                        const std::vector<std::shared_ptr<HostTensorView>>& outputs,
-                        const std::vector<std::shared_ptr<HostTensorView>>& inputs);
+    static OP_TYPEID get_typeid(const Node& node);
+    OpKernel get_kernel(const element::Type& type, const Node& op);
+    void build_plan(std::shared_ptr<Function> function, FunctionInstance& instance);
+
+    template <typename DATA, typename FILTER, typename OUT>
+    void quantized_convolution(const op::QuantizedConvolution* qc,
+                               const std::vector<std::shared_ptr<HostTensorView>>& out,
+                               const std::vector<std::shared_ptr<HostTensorView>>& args)
+    {
+        reference::quantized_convolution<DATA, FILTER, OUT>(
+            args[0]->get_data_ptr<DATA>(),
+            args[1]->get_data_ptr<FILTER>(),
+            qc->with_bias() ? args[2]->get_data_ptr<int32_t>() : nullptr,
+            out[0]->get_data_ptr<OUT>(),
+            args[0]->get_shape(),
+            args[1]->get_shape(),
+            out[0]->get_shape(),
+            qc->get_window_movement_strides(),
+            qc->get_window_dilation_strides(),
+            qc->get_padding_below(),
+            qc->get_padding_above(),
+            qc->get_data_scale(),
+            qc->get_data_zero_point(),
+            qc->get_filter_scale(),
+            qc->get_filter_zero_point(),
+            qc->get_output_scale(),
+            qc->get_output_zero_point(),
+            qc->with_relu());
+    }
 
     template <typename T>
     void op_engine(Node& node,
+                   OP_TYPEID op_id,
                    const std::vector<std::shared_ptr<HostTensorView>>& out,
                    const std::vector<std::shared_ptr<HostTensorView>>& args)
     {
-        std::string node_op = node.description();
-        if (node_op == "Abs")
+        switch (op_id)
+        {
+        case OP_TYPEID::Abs:
         {
             reference::abs<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Acos")
+        case OP_TYPEID::Acos:
         {
             reference::acos<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Add")
+        case OP_TYPEID::Add:
         {
             reference::add<T>(args[0]->get_data_ptr<T>(),
                               args[1]->get_data_ptr<T>(),
                               out[0]->get_data_ptr<T>(),
                               out[0]->get_element_count());
+            break;
         }
 #ifdef NGRAPH_DISTRIBUTED
-        else if (node_op == "AllReduce")
+        case OP_TYPEID::AllReduce:
         {
             reference::allreduce<T>(args[0]->get_data_ptr<T>(),
                                     out[0]->get_data_ptr<T>(),
                                     args[0]->get_element_type(),
                                     static_cast<int>(args[0]->get_element_count()));
+            break;
         }
 #endif
-        else if (node_op == "And")
+        case OP_TYPEID::And:
         {
             reference::logical_and(args[0]->get_data_ptr<T>(),
                                    args[1]->get_data_ptr<T>(),
                                    out[0]->get_data_ptr<T>(),
                                    out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "ArgMin")
+        case OP_TYPEID::ArgMin:
         {
             const op::ArgMin* argmin = static_cast<const op::ArgMin*>(&node);
             if (out[0]->get_element_type() == element::i64)
@@ -236,8 +318,9 @@ private:
             {
                 throw ngraph_error("Unexpected type");
             }
+            break;
         }
-        else if (node_op == "ArgMax")
+        case OP_TYPEID::ArgMax:
         {
             const op::ArgMax* argmax = static_cast<const op::ArgMax*>(&node);
             if (out[0]->get_element_type() == element::i64)
@@ -260,18 +343,21 @@ private:
             {
                 throw ngraph_error("Unexpected type");
             }
+            break;
         }
-        else if (node_op == "Asin")
+        case OP_TYPEID::Asin:
         {
             reference::asin<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Atan")
+        case OP_TYPEID::Atan:
         {
             reference::atan<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "AvgPool")
+        case OP_TYPEID::AvgPool:
         {
             op::AvgPool* avg_pool = dynamic_cast<op::AvgPool*>(&node);
 
@@ -284,16 +370,18 @@ private:
                                    avg_pool->get_padding_below(),
                                    avg_pool->get_padding_above(),
                                    avg_pool->get_include_padding_in_avg_computation());
+            break;
         }
-        else if (node_op == "GetOutputElement")
+        case OP_TYPEID::GetOutputElement:
         {
             const op::GetOutputElement* get_output_element =
                 static_cast<const op::GetOutputElement*>(&node);
             size_t n = get_output_element->get_n();
             size_t num_bytes = out[0]->get_element_count() * out[0]->get_element_type().size();
             std::memcpy(out[0]->get_data_ptr(), args[n]->get_data_ptr(), num_bytes);
+            break;
         }
-        else if (node_op == "BatchNorm")
+        case OP_TYPEID::BatchNorm:
         {
             ngraph::op::BatchNorm* bn = dynamic_cast<ngraph::op::BatchNorm*>(&node);
             if (bn->get_output_size() == 3)
@@ -319,8 +407,9 @@ private:
                                                     reinterpret_cast<T*>(out[0]->get_data_ptr()),
                                                     args[2]->get_shape());
             }
+            break;
         }
-        else if (node_op == "BatchNormBackprop")
+        case OP_TYPEID::BatchNormBackprop:
         {
             ngraph::op::BatchNormBackprop* bn_bprop =
                 dynamic_cast<ngraph::op::BatchNormBackprop*>(&node);
@@ -335,8 +424,9 @@ private:
                                            reinterpret_cast<T*>(out[1]->get_data_ptr()),
                                            reinterpret_cast<T*>(out[2]->get_data_ptr()),
                                            args[2]->get_shape());
+            break;
         }
-        else if (node_op == "AvgPoolBackprop")
+        case OP_TYPEID::AvgPoolBackprop:
         {
             op::AvgPoolBackprop* apb = dynamic_cast<op::AvgPoolBackprop*>(&node);
             reference::avg_pool_backprop<T>(args[0]->get_data_ptr<T>(),
@@ -348,8 +438,9 @@ private:
                                             apb->get_padding_below(),
                                             apb->get_padding_above(),
                                             apb->get_include_padding_in_avg_computation());
+            break;
         }
-        else if (node_op == "Broadcast")
+        case OP_TYPEID::Broadcast:
         {
             op::Broadcast* broadcast = dynamic_cast<op::Broadcast*>(&node);
             Shape in_shape = args[0]->get_shape();
@@ -360,13 +451,15 @@ private:
                                     in_shape,
                                     out_shape,
                                     broadcast_axes);
+            break;
         }
-        else if (node_op == "Ceiling")
+        case OP_TYPEID::Ceiling:
         {
             reference::ceiling<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Concat")
+        case OP_TYPEID::Concat:
         {
             const op::Concat* concat = static_cast<const op::Concat*>(&node);
             std::vector<const T*> in_args;
@@ -381,14 +474,16 @@ private:
                                  in_shapes,
                                  out[0]->get_shape(),
                                  concat->get_concatenation_axis());
+            break;
         }
-        else if (node_op == "Constant")
+        case OP_TYPEID::Constant:
         {
             const op::Constant* c = static_cast<const op::Constant*>(&node);
             reference::constant<T>(
                 c->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Convert")
+        case OP_TYPEID::Convert:
         {
             // const op::Convert* c = static_cast<const op::Convert*>(&node);
             element::Type type = node.get_element_type();
@@ -398,6 +493,18 @@ private:
                                       out[0]->get_data_ptr<char>(),
                                       out[0]->get_element_count());
             }
+            else if (type == element::bf16)
+            {
+                reference::convert<T>(args[0]->get_data_ptr<T>(),
+                                      out[0]->get_data_ptr<bfloat16>(),
+                                      out[0]->get_element_count());
+            }
+            else if (type == element::f16)
+            {
+                reference::convert<T>(args[0]->get_data_ptr<T>(),
+                                      out[0]->get_data_ptr<float16>(),
+                                      out[0]->get_element_count());
+            }
             else if (type == element::f32)
             {
                 reference::convert<T>(args[0]->get_data_ptr<T>(),
@@ -464,8 +571,9 @@ private:
                 ss << "unsupported element type " << type << " op Convert";
                 throw std::runtime_error(ss.str());
             }
+            break;
         }
-        else if (node_op == "Convolution")
+        case OP_TYPEID::Convolution:
         {
             auto c = static_cast<const op::Convolution*>(&node);
             reference::convolution<T>(args[0]->get_data_ptr<T>(),
@@ -486,8 +594,9 @@ private:
                                       0,
                                       1,
                                       false);
+            break;
         }
-        else if (node_op == "ConvolutionBackpropFilters")
+        case OP_TYPEID::ConvolutionBackpropFilters:
         {
             auto c = static_cast<const op::ConvolutionBackpropFilters*>(&node);
             reference::convolution<T>(args[0]->get_data_ptr<T>(),
@@ -508,8 +617,9 @@ private:
                                       1,
                                       0,
                                       false);
+            break;
         }
-        else if (node_op == "ConvolutionBackpropData")
+        case OP_TYPEID::ConvolutionBackpropData:
         {
             // Note that args[1] and args[0] are switched here from the usual order.
             auto c = static_cast<const op::ConvolutionBackpropData*>(&node);
@@ -531,25 +641,57 @@ private:
                                       0,
                                       1,
                                       true);
+            break;
         }
-        else if (node_op == "Cos")
+        case OP_TYPEID::Cos:
         {
             reference::cos<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Cosh")
+        case OP_TYPEID::Cosh:
         {
             reference::cosh<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Divide")
+        case OP_TYPEID::Dequantize:
+        {
+            auto dq = static_cast<const op::Dequantize*>(&node);
+            element::Type type = args[0]->get_element_type();
+            if (type == element::i8)
+            {
+                reference::dequantize<int8_t, T>(args[0]->get_data_ptr<int8_t>(),
+                                                 out[0]->get_data_ptr<T>(),
+                                                 out[0]->get_element_count(),
+                                                 dq->get_scale(),
+                                                 dq->get_zero_point());
+            }
+            else if (type == element::u8)
+            {
+                reference::dequantize<uint8_t, T>(args[0]->get_data_ptr<uint8_t>(),
+                                                  out[0]->get_data_ptr<T>(),
+                                                  out[0]->get_element_count(),
+                                                  dq->get_scale(),
+                                                  dq->get_zero_point());
+            }
+            else
+            {
+                std::stringstream ss;
+                ss << "unsupported element type " << type << " op Dequantize";
+                throw std::runtime_error(ss.str());
+            }
+            break;
+        }
+        case OP_TYPEID::Divide:
         {
             reference::divide<T>(args[0]->get_data_ptr<T>(),
                                  args[1]->get_data_ptr<T>(),
                                  out[0]->get_data_ptr<T>(),
                                  out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Dot")
+        case OP_TYPEID::Dot:
         {
             op::Dot* dot = dynamic_cast<op::Dot*>(&node);
 
@@ -560,26 +702,29 @@ private:
                            args[1]->get_shape(),
                            out[0]->get_shape(),
                            dot->get_reduction_axes_count());
+            break;
         }
-
-        else if (node_op == "Equal")
+        case OP_TYPEID::Equal:
         {
             reference::equal<T>(args[0]->get_data_ptr<T>(),
                                 args[1]->get_data_ptr<T>(),
                                 out[0]->get_data_ptr<char>(),
                                 out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Exp")
+        case OP_TYPEID::Exp:
         {
             reference::exp<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Floor")
+        case OP_TYPEID::Floor:
         {
             reference::floor<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "FunctionCall")
+        case OP_TYPEID::FunctionCall:
         {
             std::shared_ptr<Function> function = node.get_functions()[0];
 
@@ -596,41 +741,47 @@ private:
             }
 
             call(function, outputs, inputs);
+            break;
         }
-        else if (node_op == "Greater")
+        case OP_TYPEID::Greater:
         {
             reference::greater<T>(args[0]->get_data_ptr<T>(),
                                   args[1]->get_data_ptr<T>(),
                                   out[0]->get_data_ptr<char>(),
                                   out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "GreaterEq")
+        case OP_TYPEID::GreaterEq:
         {
             reference::greater_eq<T>(args[0]->get_data_ptr<T>(),
                                      args[1]->get_data_ptr<T>(),
                                      out[0]->get_data_ptr<char>(),
                                      out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Less")
+        case OP_TYPEID::Less:
         {
             reference::less<T>(args[0]->get_data_ptr<T>(),
                                args[1]->get_data_ptr<T>(),
                                out[0]->get_data_ptr<char>(),
                                out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "LessEq")
+        case OP_TYPEID::LessEq:
         {
             reference::less_eq<T>(args[0]->get_data_ptr<T>(),
                                   args[1]->get_data_ptr<T>(),
                                   out[0]->get_data_ptr<char>(),
                                   out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Log")
+        case OP_TYPEID::Log:
         {
             reference::log<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "LRN")
+        case OP_TYPEID::LRN:
         {
             const op::LRN* lrn = static_cast<const op::LRN*>(&node);
             reference::lrn<T>(args[0]->get_data_ptr<T>(),
@@ -640,8 +791,9 @@ private:
                               lrn->get_beta(),
                               lrn->get_bias(),
                               lrn->get_nsize());
+            break;
         }
-        else if (node_op == "Max")
+        case OP_TYPEID::Max:
         {
             const op::Max* max = static_cast<const op::Max*>(&node);
             reference::max<T>(args[0]->get_data_ptr<T>(),
@@ -649,15 +801,17 @@ private:
                               args[0]->get_shape(),
                               out[0]->get_shape(),
                               max->get_reduction_axes());
+            break;
         }
-        else if (node_op == "Maximum")
+        case OP_TYPEID::Maximum:
         {
             reference::maximum<T>(args[0]->get_data_ptr<T>(),
                                   args[1]->get_data_ptr<T>(),
                                   out[0]->get_data_ptr<T>(),
                                   out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "MaxPool")
+        case OP_TYPEID::MaxPool:
         {
             op::MaxPool* max_pool = dynamic_cast<op::MaxPool*>(&node);
 
@@ -669,8 +823,9 @@ private:
                                    max_pool->get_window_movement_strides(),
                                    max_pool->get_padding_below(),
                                    max_pool->get_padding_above());
+            break;
         }
-        else if (node_op == "MaxPoolBackprop")
+        case OP_TYPEID::MaxPoolBackprop:
         {
             op::MaxPoolBackprop* max_pool_backprop = dynamic_cast<op::MaxPoolBackprop*>(&node);
 
@@ -683,8 +838,9 @@ private:
                                             max_pool_backprop->get_window_movement_strides(),
                                             max_pool_backprop->get_padding_below(),
                                             max_pool_backprop->get_padding_above());
+            break;
         }
-        else if (node_op == "Min")
+        case OP_TYPEID::Min:
         {
             const op::Min* min = static_cast<const op::Min*>(&node);
             reference::min<T>(args[0]->get_data_ptr<T>(),
@@ -692,39 +848,45 @@ private:
                               args[0]->get_shape(),
                               out[0]->get_shape(),
                               min->get_reduction_axes());
+            break;
         }
-        else if (node_op == "Minimum")
+        case OP_TYPEID::Minimum:
         {
             reference::minimum<T>(args[0]->get_data_ptr<T>(),
                                   args[1]->get_data_ptr<T>(),
                                   out[0]->get_data_ptr<T>(),
                                   out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Multiply")
+        case OP_TYPEID::Multiply:
         {
             reference::multiply<T>(args[0]->get_data_ptr<T>(),
                                    args[1]->get_data_ptr<T>(),
                                    out[0]->get_data_ptr<T>(),
                                    out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Negative")
+        case OP_TYPEID::Negative:
         {
             reference::negate<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Not")
+        case OP_TYPEID::Not:
         {
             reference::logical_not(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "NotEqual")
+        case OP_TYPEID::NotEqual:
         {
             reference::not_equal<T>(args[0]->get_data_ptr<T>(),
                                     args[1]->get_data_ptr<T>(),
                                     out[0]->get_data_ptr<char>(),
                                     out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "OneHot")
+        case OP_TYPEID::OneHot:
         {
             auto oh = static_cast<const op::OneHot*>(&node);
             reference::one_hot<T>(args[0]->get_data_ptr<T>(),
@@ -732,18 +894,21 @@ private:
                                   args[0]->get_shape(),
                                   out[0]->get_shape(),
                                   oh->get_one_hot_axis());
+            break;
         }
-        else if (node_op == "Or")
+        case OP_TYPEID::Or:
         {
             reference::logical_or(args[0]->get_data_ptr<T>(),
                                   args[1]->get_data_ptr<T>(),
                                   out[0]->get_data_ptr<T>(),
                                   out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Parameter")
+        case OP_TYPEID::Parameter:
         {
+            break;
         }
-        else if (node_op == "Pad")
+        case OP_TYPEID::Pad:
         {
             op::Pad* pad = dynamic_cast<op::Pad*>(&node);
 
@@ -755,15 +920,17 @@ private:
                            pad->get_padding_below(),
                            pad->get_padding_above(),
                            pad->get_padding_interior());
+            break;
         }
-        else if (node_op == "Power")
+        case OP_TYPEID::Power:
         {
             reference::power<T>(args[0]->get_data_ptr<T>(),
                                 args[1]->get_data_ptr<T>(),
                                 out[0]->get_data_ptr<T>(),
                                 out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Product")
+        case OP_TYPEID::Product:
         {
             const op::Product* product = static_cast<const op::Product*>(&node);
             reference::product<T>(args[0]->get_data_ptr<T>(),
@@ -771,8 +938,60 @@ private:
                                   args[0]->get_shape(),
                                   out[0]->get_shape(),
                                   product->get_reduction_axes());
+            break;
+        }
+        case OP_TYPEID::Quantize:
+        {
+            auto q = static_cast<const op::Quantize*>(&node);
+            element::Type type = args[0]->get_element_type();
+            if (type == element::f32)
+            {
+                reference::quantize<float, T>(args[0]->get_data_ptr<float>(),
+                                              out[0]->get_data_ptr<T>(),
+                                              out[0]->get_element_count(),
+                                              q->get_scale(),
+                                              q->get_zero_point());
+            }
+            else if (type == element::f64)
+            {
+                reference::quantize<double, T>(args[0]->get_data_ptr<double>(),
+                                               out[0]->get_data_ptr<T>(),
+                                               out[0]->get_element_count(),
+                                               q->get_scale(),
+                                               q->get_zero_point());
+            }
+            else
+            {
+                std::stringstream ss;
+                ss << "unsupported element type " << type << " op Quantize";
+                throw std::runtime_error(ss.str());
+            }
+            break;
         }
-        else if (node_op == "Reduce")
+        case OP_TYPEID::QuantizedConvolution:
+        {
+            auto qc = static_cast<const op::QuantizedConvolution*>(&node);
+            bool data_signed = args[0]->get_element_type() == element::i8;
+            bool filters_signed = args[1]->get_element_type() == element::i8;
+            if (data_signed && filters_signed)
+            {
+                quantized_convolution<int8_t, int8_t, T>(qc, out, args);
+            }
+            else if (data_signed)
+            {
+                quantized_convolution<int8_t, uint8_t, T>(qc, out, args);
+            }
+            else if (filters_signed)
+            {
+                quantized_convolution<uint8_t, int8_t, T>(qc, out, args);
+            }
+            else
+            {
+                quantized_convolution<uint8_t, uint8_t, T>(qc, out, args);
+            }
+            break;
+        }
+        case OP_TYPEID::Reduce:
         {
             op::Reduce* reduce = dynamic_cast<op::Reduce*>(&node);
             std::shared_ptr<Function> reduction_function = reduce->get_functions()[0];
@@ -797,8 +1016,9 @@ private:
                               node.get_output_shape(0),
                               reduce->get_reduction_axes(),
                               f);
+            break;
         }
-        else if (node_op == "ReduceWindow")
+        case OP_TYPEID::ReduceWindow:
         {
             op::ReduceWindow* reduce_window = dynamic_cast<op::ReduceWindow*>(&node);
             std::shared_ptr<Function> reduction_function = reduce_window->get_functions()[0];
@@ -824,20 +1044,23 @@ private:
                                      f,
                                      reduce_window->get_window_shape(),
                                      reduce_window->get_window_movement_strides());
+            break;
         }
-        else if (node_op == "Relu")
+        case OP_TYPEID::Relu:
         {
             reference::relu<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "ReluBackprop")
+        case OP_TYPEID::ReluBackprop:
         {
             reference::relu_backprop<T>(args[0]->get_data_ptr<T>(),
                                         args[1]->get_data_ptr<T>(),
                                         out[0]->get_data_ptr<T>(),
                                         out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "ReplaceSlice")
+        case OP_TYPEID::ReplaceSlice:
         {
             const op::ReplaceSlice* slice = static_cast<const op::ReplaceSlice*>(&node);
             reference::replace_slice<T>(args[0]->get_data_ptr<T>(),
@@ -848,8 +1071,9 @@ private:
                                         slice->get_upper_bounds(),
                                         slice->get_strides(),
                                         out[0]->get_shape());
+            break;
         }
-        else if (node_op == "Reshape")
+        case OP_TYPEID::Reshape:
         {
             op::Reshape* reshape = dynamic_cast<op::Reshape*>(&node);
             reference::reshape(args[0]->get_data_ptr<T>(),
@@ -857,15 +1081,17 @@ private:
                                args[0]->get_shape(),
                                reshape->get_input_order(),
                                out[0]->get_shape());
+            break;
         }
-        else if (node_op == "Result")
+        case OP_TYPEID::Result:
         {
             op::Result* res = dynamic_cast<op::Result*>(&node);
             reference::result(args[0]->get_data_ptr<T>(),
                               out[0]->get_data_ptr<T>(),
                               shape_size(res->get_shape()));
+            break;
         }
-        else if (node_op == "Reverse")
+        case OP_TYPEID::Reverse:
         {
             op::Reverse* reverse = dynamic_cast<op::Reverse*>(&node);
             reference::reverse(args[0]->get_data_ptr<T>(),
@@ -873,8 +1099,9 @@ private:
                                args[0]->get_shape(),
                                out[0]->get_shape(),
                                reverse->get_reversed_axes());
+            break;
         }
-        else if (node_op == "ReverseSequence")
+        case OP_TYPEID::ReverseSequence:
         {
             op::ReverseSequence* reverse = dynamic_cast<op::ReverseSequence*>(&node);
 
@@ -891,16 +1118,18 @@ private:
             {
                 throw ngraph_error("only int32 indices are supported");
             }
+            break;
         }
-        else if (node_op == "Select")
+        case OP_TYPEID::Select:
         {
             reference::select<T>(args[0]->get_data_ptr<char>(),
                                  args[1]->get_data_ptr<T>(),
                                  args[2]->get_data_ptr<T>(),
                                  out[0]->get_data_ptr<T>(),
                                  out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "SelectAndScatter")
+        case OP_TYPEID::SelectAndScatter:
         {
             ngraph::op::SelectAndScatter* select_and_scatter =
                 dynamic_cast<ngraph::op::SelectAndScatter*>(&node);
@@ -947,35 +1176,41 @@ private:
                                              f_scatter,
                                              select_and_scatter->get_window_shape(),
                                              select_and_scatter->get_window_movement_strides());
+            break;
         }
-        else if (node_op == "Sigmoid")
+        case OP_TYPEID::Sigmoid:
         {
             reference::sigmoid<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "SigmoidBackprop")
+        case OP_TYPEID::SigmoidBackprop:
         {
             reference::sigmoid_backprop<T>(args[0]->get_data_ptr<T>(),
                                            args[1]->get_data_ptr<T>(),
                                            out[0]->get_data_ptr<T>(),
                                            out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Sign")
+        case OP_TYPEID::Sign:
         {
             reference::sign<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Sin")
+        case OP_TYPEID::Sin:
         {
             reference::sin<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Sinh")
+        case OP_TYPEID::Sinh:
         {
             reference::sinh<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Slice")
+        case OP_TYPEID::Slice:
         {
             const op::Slice* slice = static_cast<const op::Slice*>(&node);
             reference::slice<T>(args[0]->get_data_ptr<T>(),
@@ -985,28 +1220,32 @@ private:
                                 slice->get_upper_bounds(),
                                 slice->get_strides(),
                                 out[0]->get_shape());
+            break;
         }
-        else if (node_op == "Softmax")
+        case OP_TYPEID::Softmax:
         {
             const op::Softmax* softmax = static_cast<const op::Softmax*>(&node);
             reference::softmax<T>(args[0]->get_data_ptr<T>(),
                                   out[0]->get_data_ptr<T>(),
                                   out[0]->get_shape(),
                                   softmax->get_axes());
+            break;
         }
-        else if (node_op == "Sqrt")
+        case OP_TYPEID::Sqrt:
         {
             reference::sqrt<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Subtract")
+        case OP_TYPEID::Subtract:
         {
             reference::subtract<T>(args[0]->get_data_ptr<T>(),
                                    args[1]->get_data_ptr<T>(),
                                    out[0]->get_data_ptr<T>(),
                                    out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Sum")
+        case OP_TYPEID::Sum:
         {
             const op::Sum* sum = static_cast<const op::Sum*>(&node);
             reference::sum<T>(args[0]->get_data_ptr<T>(),
@@ -1014,22 +1253,26 @@ private:
                               args[0]->get_shape(),
                               out[0]->get_shape(),
                               sum->get_reduction_axes());
+            break;
         }
-        else if (node_op == "Tan")
+        case OP_TYPEID::Tan:
         {
             reference::tan<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else if (node_op == "Tanh")
+        case OP_TYPEID::Tanh:
         {
             reference::tanh<T>(
                 args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            break;
         }
-        else
+        default:
         {
             std::stringstream ss;
-            ss << "unsupported op " << node_op;
+            ss << "unsupported op " << node.description();
             throw ngraph_error(ss.str());
         }
+        }
     }
 };
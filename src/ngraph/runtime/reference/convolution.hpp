@@ -20,6 +20,7 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/type/element_type.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -164,8 +165,11 @@ namespace ngraph
                     // As we go, we sum up:
                     //
                     //   output[O] += arg0[I] * arg1[F].
+                    //
+                    // in the accumulation type of T, so 16-bit floating point inputs are only
+                    // rounded once, when the result is stored.
 
-                    T result = 0;
+                    typename element::accumulation_type<T>::type result = 0;
 
                     CoordinateTransform::Iterator input_it = input_batch_transform.begin();
                     CoordinateTransform::Iterator filter_it = filter_transform.begin();
@@ -190,7 +194,7 @@ namespace ngraph
 
                         T v = input_batch_transform.has_source_coordinate(input_batch_coord)
                                   ? arg0[input_batch_transform.index(input_batch_coord)]
-                                  : 0;
+                                  : static_cast<T>(0);
 
                         result += v * arg1[filter_transform.index(filter_coord)];
 
@@ -0,0 +1,41 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            template <typename QUANT, typename REAL>
+            void dequantize(
+                const QUANT* arg, REAL* out, size_t count, float scale, int32_t zero_point)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    out[i] = static_cast<REAL>(static_cast<int32_t>(arg[i]) - zero_point) *
+                             static_cast<REAL>(scale);
+                }
+            }
+        }
+    }
+}
@@ -20,6 +20,7 @@
 #include <utility>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/type/element_type.hpp"
 
 namespace ngraph
 {
@@ -82,8 +83,9 @@ namespace ngraph
                         std::copy(
                             arg1_projected_coord.begin(), arg1_projected_coord.end(), out_coord_it);
 
-                        // Zero out to start the sum.
-                        T sum = 0;
+                        // Zero out to start the sum. 16-bit floating point types are summed in
+                        // float and rounded once on the way out.
+                        typename element::accumulation_type<T>::type sum = 0;
 
                         size_t out_index = output_transform.index(out_coord);
 
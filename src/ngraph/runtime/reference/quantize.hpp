@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            template <typename QUANT, typename REAL>
+            QUANT quantize_value(REAL value, float scale, int32_t zero_point)
+            {
+                REAL q = std::nearbyint(value / static_cast<REAL>(scale)) + zero_point;
+                q = std::max(q, static_cast<REAL>(std::numeric_limits<QUANT>::lowest()));
+                q = std::min(q, static_cast<REAL>(std::numeric_limits<QUANT>::max()));
+                return static_cast<QUANT>(q);
+            }
+
+            template <typename REAL, typename QUANT>
+            void quantize(
+                const REAL* arg, QUANT* out, size_t count, float scale, int32_t zero_point)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    out[i] = quantize_value<QUANT>(arg[i], scale, zero_point);
+                }
+            }
+        }
+    }
+}
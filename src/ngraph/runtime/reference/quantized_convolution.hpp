@@ -0,0 +1,106 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            template <typename DATA, typename FILTER, typename OUT>
+            void quantized_convolution(const DATA* data,
+                                       const FILTER* filters,
+                                       const int32_t* bias,
+                                       OUT* out,
+                                       const Shape& data_shape,
+                                       const Shape& filters_shape,
+                                       const Shape& out_shape,
+                                       const Strides& window_movement_strides,
+                                       const Strides& window_dilation_strides,
+                                       const CoordinateDiff& padding_below,
+                                       const CoordinateDiff& padding_above,
+                                       float data_scale,
+                                       int32_t data_zero_point,
+                                       float filter_scale,
+                                       int32_t filter_zero_point,
+                                       float output_scale,
+                                       int32_t output_zero_point,
+                                       bool with_relu)
+            {
+                // Shift both operands by their zero points and accumulate in int32. Padding is
+                // applied after the shift so it contributes real zeros, as in the f32 graph.
+                std::vector<int32_t> shifted_data(shape_size(data_shape));
+                for (size_t i = 0; i < shifted_data.size(); i++)
+                {
+                    shifted_data[i] = static_cast<int32_t>(data[i]) - data_zero_point;
+                }
+                std::vector<int32_t> shifted_filters(shape_size(filters_shape));
+                for (size_t i = 0; i < shifted_filters.size(); i++)
+                {
+                    shifted_filters[i] = static_cast<int32_t>(filters[i]) - filter_zero_point;
+                }
+
+                std::vector<int32_t> accumulator(shape_size(out_shape));
+                convolution<int32_t>(shifted_data.data(),
+                                     shifted_filters.data(),
+                                     accumulator.data(),
+                                     data_shape,
+                                     filters_shape,
+                                     out_shape,
+                                     window_movement_strides,
+                                     window_dilation_strides,
+                                     padding_below,
+                                     padding_above,
+                                     Strides(window_movement_strides.size(), 1),
+                                     0,
+                                     1,
+                                     1,
+                                     0,
+                                     0,
+                                     1,
+                                     false);
+
+                size_t channels = out_shape[1];
+                size_t spatial_size = shape_size(out_shape) / (out_shape[0] * channels);
+                double rescale = static_cast<double>(data_scale) * filter_scale / output_scale;
+                for (size_t i = 0; i < accumulator.size(); i++)
+                {
+                    int64_t acc = accumulator[i];
+                    if (bias)
+                    {
+                        acc += bias[(i / spatial_size) % channels];
+                    }
+                    double value = acc * rescale;
+                    if (with_relu && value < 0)
+                    {
+                        value = 0;
+                    }
+                    out[i] = quantize_value<OUT>(value, 1.0f, output_zero_point);
+                }
+            }
+        }
+    }
+}
@@ -39,6 +39,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/equal.hpp"
@@ -67,6 +68,8 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/relu.hpp"
@@ -105,10 +108,15 @@ T get_or_default(nlohmann::json& j, const std::string& key, const T& default_val
     return j.count(key) != 0 ? j.at(key).get<T>() : default_value;
 }
 
+static void read_node(json&,
+                      std::unordered_map<std::string, std::shared_ptr<Node>>&,
+                      std::unordered_map<std::string, std::shared_ptr<Function>>&,
+                      function<const_data_callback_t>);
+
 static std::shared_ptr<ngraph::Function>
-    read_function(const json&,
-                  std::unordered_map<std::string, std::shared_ptr<Function>>&,
-                  function<const_data_callback_t>);
+    make_function(const json&,
+                  const std::unordered_map<std::string, std::shared_ptr<Node>>&,
+                  std::unordered_map<std::string, std::shared_ptr<Function>>&);
 
 static json write(const ngraph::Function&, bool binary_constant_data);
 static json write(const ngraph::Node&, bool binary_constant_data);
@@ -153,6 +161,9 @@ static element::Type read_element_type(const json& j)
     return element::Type(bitwidth, is_real, is_signed, c_type_string);
 }
 
+// Constant data in serialized files is aligned so it can be used in place when mapped
+static const size_t s_constant_alignment = 64;
+
 void ngraph::serialize(const string& path, shared_ptr<ngraph::Function> func, size_t indent)
 {
     ofstream out(path);
@@ -171,7 +182,7 @@ void ngraph::serialize(ostream& out, shared_ptr<ngraph::Function> func, size_t i
             {
                 uint32_t size = static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
                                                       c->get_output_element_type(0).size());
-                writer.write(c->get_name(), c->get_data_ptr(), size);
+                writer.write(c->get_name(), c->get_data_ptr(), size, s_constant_alignment);
             }
         });
     });
@@ -208,6 +219,43 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
+// Builds the Functions of a serialized graph while parse runs the json parser with the given
+// callback. Each op is constructed as soon as its entry has been parsed and the entry is then
+// dropped, as are Functions once constructed, so the json document is never held in memory.
+// Functions are serialized before any Function that calls them. parse returns what is left
+// of the document, which is only the emptied array of functions.
+static shared_ptr<ngraph::Function>
+    read_functions(function<json(json::parser_callback_t)> parse,
+                   function<const_data_callback_t> const_data)
+{
+    shared_ptr<Function> rc;
+    unordered_map<string, shared_ptr<Function>> function_map;
+    unordered_map<string, shared_ptr<Node>> node_map;
+    string function_key;
+    json remainder = parse([&](int depth, json::parse_event_t event, json& parsed) {
+        // depth 0 is the array of functions, 1 a function, 2 its members and 3 ops
+        bool keep = true;
+        if (depth == 2 && event == json::parse_event_t::key)
+        {
+            function_key = parsed.get<string>();
+        }
+        else if (depth == 3 && event == json::parse_event_t::object_end &&
+                 function_key == "ops")
+        {
+            read_node(parsed, node_map, function_map, const_data);
+            keep = false;
+        }
+        else if (depth == 1 && event == json::parse_event_t::object_end)
+        {
+            rc = make_function(parsed, node_map, function_map);
+            node_map.clear();
+            keep = false;
+        }
+        return keep;
+    });
+    return rc;
+}
+
 shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
 {
     shared_ptr<Function> rc;
@@ -223,38 +271,79 @@ shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
             reader.read(file_info[0].get_name(), data, size);
             string jstr(data, size);
             delete[] data;
-            json js = json::parse(jstr);
-            unordered_map<string, shared_ptr<Function>> function_map;
-            for (json func : js)
-            {
-                shared_ptr<Function> f = read_function(
-                    func,
-                    function_map,
-                    [&](const string& const_name, const element::Type& et, const Shape& shape) {
-                        shared_ptr<Node> const_node;
-                        for (const cpio::FileInfo& info : file_info)
-                        {
-                            if (info.get_name() == const_name)
-                            {
-                                void* const_data = malloc(info.get_size());
-                                reader.read(const_name, const_data, info.get_size());
-                                const_node = make_shared<op::Constant>(et, shape, const_data);
-                                free(const_data);
-                                break;
-                            }
-                        }
-                        return const_node;
-                    });
-                rc = f;
-            }
+            unordered_map<string, const cpio::FileInfo*> file_index;
+            for (const cpio::FileInfo& info : file_info)
+            {
+                file_index.insert({info.get_name(), &info});
+            }
+            rc = read_functions(
+                [&](json::parser_callback_t callback) { return json::parse(jstr, callback); },
+                [&](const string& const_name, const element::Type& et, const Shape& shape) {
+                    shared_ptr<Node> const_node;
+                    auto it = file_index.find(const_name);
+                    if (it != file_index.end())
+                    {
+                        vector<char> const_data(it->second->get_size());
+                        reader.read(const_name, const_data.data(), const_data.size());
+                        const_node = make_shared<op::Constant>(et, shape, const_data.data());
+                    }
+                    return const_node;
+                });
         }
     }
     else
     {
         // json file?
-        std::stringstream ss;
-        ss << in.rdbuf();
-        rc = deserialize(ss.str());
+        rc = read_functions(
+            [&](json::parser_callback_t callback) { return json::parse(in, callback); }, nullptr);
+    }
+    return rc;
+}
+
+// Deserializes a CPIO file by mapping it into memory. Constants refer to their data in the
+// mapping, which stays mapped until the last of them is destroyed, unless the data is not
+// aligned for its element type.
+static shared_ptr<ngraph::Function> deserialize_mapped(const string& path)
+{
+    shared_ptr<Function> rc;
+    size_t file_size;
+    shared_ptr<const char> file_data = file_util::map_file(path, file_size);
+    cpio::Reader reader(path);
+    vector<cpio::FileInfo> file_info = reader.get_file_info();
+    if (file_info.size() > 0)
+    {
+        // The first file is the model
+        const char* model = file_data.get() + file_info[0].get_offset();
+        unordered_map<string, const cpio::FileInfo*> file_index;
+        for (const cpio::FileInfo& info : file_info)
+        {
+            if (info.get_offset() + info.get_size() > file_size)
+            {
+                throw ngraph_error("Truncated serialized file '" + path + "'");
+            }
+            file_index.insert({info.get_name(), &info});
+        }
+        rc = read_functions(
+            [&](json::parser_callback_t callback) {
+                return json::parse(model, model + file_info[0].get_size(), callback);
+            },
+            [&](const string& const_name, const element::Type& et, const Shape& shape) {
+                shared_ptr<Node> const_node;
+                auto it = file_index.find(const_name);
+                if (it != file_index.end())
+                {
+                    const char* const_data = file_data.get() + it->second->get_offset();
+                    if (reinterpret_cast<size_t>(const_data) % et.size() == 0)
+                    {
+                        const_node = make_shared<op::Constant>(et, shape, const_data, file_data);
+                    }
+                    else
+                    {
+                        const_node = make_shared<op::Constant>(et, shape, const_data);
+                    }
+                }
+                return const_node;
+            });
     }
     return rc;
 }
@@ -265,18 +354,20 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     if (file_util::exists(s))
     {
         // s is a file and not a json string
-        ifstream in(s, ios_base::binary | ios_base::in);
-        rc = deserialize(in);
+        if (cpio::is_cpio(s))
+        {
+            rc = deserialize_mapped(s);
+        }
+        else
+        {
+            ifstream in(s, ios_base::binary | ios_base::in);
+            rc = deserialize(in);
+        }
     }
     else
     {
-        json js = json::parse(s);
-        unordered_map<string, shared_ptr<Function>> function_map;
-        for (json func : js)
-        {
-            shared_ptr<Function> f = read_function(func, function_map, nullptr);
-            rc = f;
-        }
+        rc = read_functions(
+            [&](json::parser_callback_t callback) { return json::parse(s, callback); }, nullptr);
     }
 
     return rc;
@@ -343,609 +434,678 @@ static json write(const Function& f, bool binary_constant_data)
     return function;
 }
 
-static shared_ptr<ngraph::Function>
-    read_function(const json& func_js,
-                  unordered_map<string, shared_ptr<Function>>& function_map,
-                  function<const_data_callback_t> const_data_callback)
+static void read_node(json& node_js,
+                      unordered_map<string, shared_ptr<Node>>& node_map,
+                      unordered_map<string, shared_ptr<Function>>& function_map,
+                      function<const_data_callback_t> const_data_callback)
 {
-    shared_ptr<ngraph::Function> rc;
-
-    string func_name = func_js.at("name").get<string>();
-    vector<string> func_parameters = func_js.at("parameters").get<vector<string>>();
-    vector<string> func_result = func_js.at("result").get<vector<string>>();
-    unordered_map<string, shared_ptr<Node>> node_map;
-    for (json node_js : func_js.at("ops"))
-    {
-        try
+    try
+    {
+        string node_name = node_js.at("name").get<string>();
+        string node_op = node_js.at("op").get<string>();
+        vector<string> node_inputs = node_js.at("inputs").get<vector<string>>();
+        vector<string> node_outputs = node_js.at("outputs").get<vector<string>>();
+        shared_ptr<Node> node;
+        vector<shared_ptr<Node>> args;
+        for (const string& name : node_inputs)
         {
-            string node_name = node_js.at("name").get<string>();
-            string node_op = node_js.at("op").get<string>();
-            vector<string> node_inputs = node_js.at("inputs").get<vector<string>>();
-            vector<string> node_outputs = node_js.at("outputs").get<vector<string>>();
-            shared_ptr<Node> node;
-            vector<shared_ptr<Node>> args;
-            for (const string& name : node_inputs)
-            {
-                args.push_back(node_map.at(name));
-            }
+            args.push_back(node_map.at(name));
+        }
 
-            if (node_op == "Abs")
-            {
-                node = make_shared<op::Abs>(args[0]);
-            }
-            else if (node_op == "Acos")
-            {
-                node = make_shared<op::Acos>(args[0]);
-            }
-            else if (node_op == "Add")
-            {
-                node = make_shared<op::Add>(args[0], args[1]);
-            }
-            else if (node_op == "AllReduce")
-            {
-                node = make_shared<op::AllReduce>(args[0]);
-            }
-            else if (node_op == "And")
-            {
-                node = make_shared<op::And>(args[0], args[1]);
-            }
-            else if (node_op == "ArgMin")
-            {
-                auto axis = node_js.at("axis").get<size_t>();
-                auto target_type = read_element_type(node_js.at("index_element_type"));
-                node = make_shared<op::ArgMin>(args[0], axis, target_type);
-            }
-            else if (node_op == "ArgMax")
-            {
-                auto axis = node_js.at("axis").get<size_t>();
-                auto target_type = read_element_type(node_js.at("index_element_type"));
-                node = make_shared<op::ArgMax>(args[0], axis, target_type);
-            }
-            else if (node_op == "Asin")
-            {
-                node = make_shared<op::Asin>(args[0]);
-            }
-            else if (node_op == "Atan")
-            {
-                node = make_shared<op::Atan>(args[0]);
-            }
-            else if (node_op == "AvgPool")
-            {
-                auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
-                auto window_movement_strides =
-                    node_js.at("window_movement_strides").get<vector<size_t>>();
-                auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
-                auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
-                auto include_padding_in_avg_computation =
-                    node_js.at("include_padding_in_avg_computation").get<bool>();
-                node = make_shared<op::AvgPool>(args[0],
-                                                window_shape,
-                                                window_movement_strides,
-                                                padding_below,
-                                                padding_above,
-                                                include_padding_in_avg_computation);
-            }
-            else if (node_op == "AvgPoolBackprop")
-            {
-                auto forward_arg_shape = node_js.at("forward_arg_shape").get<vector<size_t>>();
-                auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
-                auto window_movement_strides =
-                    node_js.at("window_movement_strides").get<vector<size_t>>();
-                auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
-                auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
-                auto include_padding_in_avg_computation =
-                    get_or_default<bool>(node_js, "include_padding_in_avg_computation", false);
-                node = make_shared<op::AvgPoolBackprop>(forward_arg_shape,
-                                                        args[0],
-                                                        window_shape,
-                                                        window_movement_strides,
-                                                        padding_below,
-                                                        padding_above,
-                                                        include_padding_in_avg_computation);
-            }
-            else if (node_op == "BatchNorm")
-            {
-                auto epsilon = node_js.at("eps").get<double>();
-                bool training = get_or_default<bool>(node_js, "training", true);
-                if (training && args.size() == 3)
-                {
-                    node = make_shared<op::BatchNorm>(epsilon, args[0], args[1], args[2]);
-                }
-                else if (training && args.size() == 5)
-                {
-                    node = make_shared<op::BatchNorm>(
-                        epsilon, args[0], args[1], args[2], args[3], args[4], true);
-                }
-                else
-                {
-                    node = make_shared<op::BatchNorm>(
-                        epsilon, args[0], args[1], args[2], args[3], args[4]);
-                }
-            }
-            else if (node_op == "BatchNormBackprop")
-            {
-                auto epsilon = node_js.at("eps").get<double>();
-                node = make_shared<op::BatchNormBackprop>(
-                    epsilon, args[0], args[1], args[2], args[3], args[4], args[5]);
-            }
-            else if (node_op == "Broadcast")
+        if (node_op == "Abs")
+        {
+            node = make_shared<op::Abs>(args[0]);
+        }
+        else if (node_op == "Acos")
+        {
+            node = make_shared<op::Acos>(args[0]);
+        }
+        else if (node_op == "Add")
+        {
+            node = make_shared<op::Add>(args[0], args[1]);
+        }
+        else if (node_op == "AllReduce")
+        {
+            node = make_shared<op::AllReduce>(args[0]);
+        }
+        else if (node_op == "And")
+        {
+            node = make_shared<op::And>(args[0], args[1]);
+        }
+        else if (node_op == "ArgMin")
+        {
+            auto axis = node_js.at("axis").get<size_t>();
+            auto target_type = read_element_type(node_js.at("index_element_type"));
+            node = make_shared<op::ArgMin>(args[0], axis, target_type);
+        }
+        else if (node_op == "ArgMax")
+        {
+            auto axis = node_js.at("axis").get<size_t>();
+            auto target_type = read_element_type(node_js.at("index_element_type"));
+            node = make_shared<op::ArgMax>(args[0], axis, target_type);
+        }
+        else if (node_op == "Asin")
+        {
+            node = make_shared<op::Asin>(args[0]);
+        }
+        else if (node_op == "Atan")
+        {
+            node = make_shared<op::Atan>(args[0]);
+        }
+        else if (node_op == "AvgPool")
+        {
+            auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
+            auto window_movement_strides =
+                node_js.at("window_movement_strides").get<vector<size_t>>();
+            auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
+            auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
+            auto include_padding_in_avg_computation =
+                node_js.at("include_padding_in_avg_computation").get<bool>();
+            node = make_shared<op::AvgPool>(args[0],
+                                            window_shape,
+                                            window_movement_strides,
+                                            padding_below,
+                                            padding_above,
+                                            include_padding_in_avg_computation);
+        }
+        else if (node_op == "AvgPoolBackprop")
+        {
+            auto forward_arg_shape = node_js.at("forward_arg_shape").get<vector<size_t>>();
+            auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
+            auto window_movement_strides =
+                node_js.at("window_movement_strides").get<vector<size_t>>();
+            auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
+            auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
+            auto include_padding_in_avg_computation =
+                get_or_default<bool>(node_js, "include_padding_in_avg_computation", false);
+            node = make_shared<op::AvgPoolBackprop>(forward_arg_shape,
+                                                    args[0],
+                                                    window_shape,
+                                                    window_movement_strides,
+                                                    padding_below,
+                                                    padding_above,
+                                                    include_padding_in_avg_computation);
+        }
+        else if (node_op == "BatchNorm")
+        {
+            auto epsilon = node_js.at("eps").get<double>();
+            bool training = get_or_default<bool>(node_js, "training", true);
+            if (training && args.size() == 3)
             {
-                auto shape = node_js.at("shape").get<vector<size_t>>();
-                auto axes = node_js.at("axes").get<set<size_t>>();
-                node = make_shared<op::Broadcast>(args[0], shape, axes);
+                node = make_shared<op::BatchNorm>(epsilon, args[0], args[1], args[2]);
             }
-            else if (node_op == "Ceiling")
+            else if (training && args.size() == 5)
             {
-                node = make_shared<op::Ceiling>(args[0]);
+                node = make_shared<op::BatchNorm>(
+                    epsilon, args[0], args[1], args[2], args[3], args[4], true);
             }
-            else if (node_op == "Concat")
+            else
             {
-                auto axis = node_js.at("axis").get<size_t>();
-                node = make_shared<op::Concat>(args, axis);
+                node = make_shared<op::BatchNorm>(
+                    epsilon, args[0], args[1], args[2], args[3], args[4]);
             }
-            else if (node_op == "Constant")
+        }
+        else if (node_op == "BatchNormBackprop")
+        {
+            auto epsilon = node_js.at("eps").get<double>();
+            node = make_shared<op::BatchNormBackprop>(
+                epsilon, args[0], args[1], args[2], args[3], args[4], args[5]);
+        }
+        else if (node_op == "Broadcast")
+        {
+            auto shape = node_js.at("shape").get<vector<size_t>>();
+            auto axes = node_js.at("axes").get<set<size_t>>();
+            node = make_shared<op::Broadcast>(args[0], shape, axes);
+        }
+        else if (node_op == "Ceiling")
+        {
+            node = make_shared<op::Ceiling>(args[0]);
+        }
+        else if (node_op == "Concat")
+        {
+            auto axis = node_js.at("axis").get<size_t>();
+            node = make_shared<op::Concat>(args, axis);
+        }
+        else if (node_op == "Constant")
+        {
+            auto type_node_js =
+                node_js.count("element_type") == 0 ? node_js.at("value_type") : node_js;
+            auto element_type = read_element_type(type_node_js.at("element_type"));
+            auto shape = type_node_js.at("shape");
+            try
             {
-                auto type_node_js =
-                    node_js.count("element_type") == 0 ? node_js.at("value_type") : node_js;
-                auto element_type = read_element_type(type_node_js.at("element_type"));
-                auto shape = type_node_js.at("shape");
-                try
-                {
-                    auto value = node_js.at("value").get<vector<string>>();
-                    node = make_shared<op::Constant>(element_type, shape, value);
-                }
-                catch (...)
-                {
-                    node = const_data_callback(node_name, element_type, shape);
-                }
+                auto value = node_js.at("value").get<vector<string>>();
+                node = make_shared<op::Constant>(element_type, shape, value);
             }
-            else if (node_op == "Convert")
+            catch (...)
             {
-                auto target_type = read_element_type(node_js.at("target_type"));
-                node = make_shared<op::Convert>(args[0], target_type);
+                node = const_data_callback(node_name, element_type, shape);
             }
-            else if (node_op == "Convolution")
-            {
-                auto window_movement_strides =
-                    node_js.at("window_movement_strides").get<vector<size_t>>();
-                auto window_dilation_strides =
-                    node_js.at("window_dilation_strides").get<vector<size_t>>();
-                auto padding_below = node_js.at("padding_below").get<vector<std::ptrdiff_t>>();
-                auto padding_above = node_js.at("padding_above").get<vector<std::ptrdiff_t>>();
-
-                // For backwards compatibility, we accept "image_dilation_strides" in place of
-                // "data_dilation_strides", and we also allow it to be omitted altogether.
-                auto data_dilation_strides_maybe = node_js["data_dilation_strides"];
-                if (data_dilation_strides_maybe.empty())
-                {
-                    data_dilation_strides_maybe = node_js["image_dilation_strides"];
-                }
+        }
+        else if (node_op == "Convert")
+        {
+            auto target_type = read_element_type(node_js.at("target_type"));
+            node = make_shared<op::Convert>(args[0], target_type);
+        }
+        else if (node_op == "Convolution")
+        {
+            auto window_movement_strides =
+                node_js.at("window_movement_strides").get<vector<size_t>>();
+            auto window_dilation_strides =
+                node_js.at("window_dilation_strides").get<vector<size_t>>();
+            auto padding_below = node_js.at("padding_below").get<vector<std::ptrdiff_t>>();
+            auto padding_above = node_js.at("padding_above").get<vector<std::ptrdiff_t>>();
 
-                if (data_dilation_strides_maybe.empty())
-                {
-                    node = make_shared<op::Convolution>(args[0],
-                                                        args[1],
-                                                        window_movement_strides,
-                                                        window_dilation_strides,
-                                                        padding_below,
-                                                        padding_above);
-                }
-                else
-                {
-                    node = make_shared<op::Convolution>(
-                        args[0],
-                        args[1],
-                        window_movement_strides,
-                        window_dilation_strides,
-                        padding_below,
-                        padding_above,
-                        data_dilation_strides_maybe.get<std::vector<size_t>>());
-                }
-            }
-            else if (node_op == "ConvolutionBackpropData")
-            {
-                auto data_batch_shape = node_js.at("data_batch_shape").get<vector<size_t>>();
-                auto window_movement_strides_forward =
-                    node_js.at("window_movement_strides_forward").get<vector<size_t>>();
-                auto window_dilation_strides_forward =
-                    node_js.at("window_dilation_strides_forward").get<vector<size_t>>();
-                auto padding_below_forward =
-                    node_js.at("padding_below_forward").get<vector<std::ptrdiff_t>>();
-                auto padding_above_forward =
-                    node_js.at("padding_above_forward").get<vector<std::ptrdiff_t>>();
-                auto data_dilation_strides_forward =
-                    node_js.at("data_dilation_strides_forward").get<vector<size_t>>();
-                node = make_shared<op::ConvolutionBackpropData>(data_batch_shape,
-                                                                args[0],
-                                                                args[1],
-                                                                window_movement_strides_forward,
-                                                                window_dilation_strides_forward,
-                                                                padding_below_forward,
-                                                                padding_above_forward,
-                                                                data_dilation_strides_forward);
-            }
-            else if (node_op == "ConvolutionBackpropFilters")
-            {
-                auto filters_shape = node_js.at("filters_shape").get<vector<size_t>>();
-                auto window_movement_strides_forward =
-                    node_js.at("window_movement_strides_forward").get<vector<size_t>>();
-                auto window_dilation_strides_forward =
-                    node_js.at("window_dilation_strides_forward").get<vector<size_t>>();
-                auto padding_below_forward =
-                    node_js.at("padding_below_forward").get<vector<std::ptrdiff_t>>();
-                auto padding_above_forward =
-                    node_js.at("padding_above_forward").get<vector<std::ptrdiff_t>>();
-                auto data_dilation_strides_forward =
-                    node_js.at("data_dilation_strides_forward").get<vector<size_t>>();
-                node = make_shared<op::ConvolutionBackpropFilters>(args[0],
-                                                                   filters_shape,
-                                                                   args[1],
-                                                                   window_movement_strides_forward,
-                                                                   window_dilation_strides_forward,
-                                                                   padding_below_forward,
-                                                                   padding_above_forward,
-                                                                   data_dilation_strides_forward);
-            }
-            else if (node_op == "Cos")
-            {
-                node = make_shared<op::Cos>(args[0]);
-            }
-            else if (node_op == "Cosh")
-            {
-                node = make_shared<op::Cosh>(args[0]);
-            }
-            else if (node_op == "Divide")
-            {
-                node = make_shared<op::Divide>(args[0], args[1]);
-            }
-            else if (node_op == "Dot")
-            {
-                // For backwards compatibility, reduction_axes_count is optional.
-                auto obj = node_js["reduction_axes_count"];
-                if (obj.empty())
-                {
-                    node = make_shared<op::Dot>(args[0], args[1]);
-                }
-                else
-                {
-                    size_t reduction_axes_count = obj.get<size_t>();
-                    node = make_shared<op::Dot>(args[0], args[1], reduction_axes_count);
-                }
-            }
-            else if (node_op == "Equal")
+            // For backwards compatibility, we accept "image_dilation_strides" in place of
+            // "data_dilation_strides", and we also allow it to be omitted altogether.
+            auto data_dilation_strides_maybe = node_js["data_dilation_strides"];
+            if (data_dilation_strides_maybe.empty())
             {
-                node = make_shared<op::Equal>(args[0], args[1]);
+                data_dilation_strides_maybe = node_js["image_dilation_strides"];
             }
-            else if (node_op == "Exp")
-            {
-                node = make_shared<op::Exp>(args[0]);
-            }
-            else if (node_op == "Floor")
-            {
-                node = make_shared<op::Floor>(args[0]);
-            }
-            else if (node_op == "FunctionCall")
-            {
-                string function_name = node_js.at("function").get<string>();
-                shared_ptr<Function> f_ptr = function_map.at(function_name);
-                node = make_shared<op::FunctionCall>(f_ptr, args);
-            }
-            else if (node_op == "GetOutputElement")
+
+            if (data_dilation_strides_maybe.empty())
             {
-                node = make_shared<op::GetOutputElement>(args[0], node_js.at("n").get<size_t>());
+                node = make_shared<op::Convolution>(args[0],
+                                                    args[1],
+                                                    window_movement_strides,
+                                                    window_dilation_strides,
+                                                    padding_below,
+                                                    padding_above);
             }
-            else if (node_op == "Greater")
+            else
             {
-                node = make_shared<op::Greater>(args[0], args[1]);
+                node = make_shared<op::Convolution>(
+                    args[0],
+                    args[1],
+                    window_movement_strides,
+                    window_dilation_strides,
+                    padding_below,
+                    padding_above,
+                    data_dilation_strides_maybe.get<std::vector<size_t>>());
             }
-            else if (node_op == "GreaterEq")
+        }
+        else if (node_op == "ConvolutionBackpropData")
+        {
+            auto data_batch_shape = node_js.at("data_batch_shape").get<vector<size_t>>();
+            auto window_movement_strides_forward =
+                node_js.at("window_movement_strides_forward").get<vector<size_t>>();
+            auto window_dilation_strides_forward =
+                node_js.at("window_dilation_strides_forward").get<vector<size_t>>();
+            auto padding_below_forward =
+                node_js.at("padding_below_forward").get<vector<std::ptrdiff_t>>();
+            auto padding_above_forward =
+                node_js.at("padding_above_forward").get<vector<std::ptrdiff_t>>();
+            auto data_dilation_strides_forward =
+                node_js.at("data_dilation_strides_forward").get<vector<size_t>>();
+            node = make_shared<op::ConvolutionBackpropData>(data_batch_shape,
+                                                            args[0],
+                                                            args[1],
+                                                            window_movement_strides_forward,
+                                                            window_dilation_strides_forward,
+                                                            padding_below_forward,
+                                                            padding_above_forward,
+                                                            data_dilation_strides_forward);
+        }
+        else if (node_op == "ConvolutionBackpropFilters")
+        {
+            auto filters_shape = node_js.at("filters_shape").get<vector<size_t>>();
+            auto window_movement_strides_forward =
+                node_js.at("window_movement_strides_forward").get<vector<size_t>>();
+            auto window_dilation_strides_forward =
+                node_js.at("window_dilation_strides_forward").get<vector<size_t>>();
+            auto padding_below_forward =
+                node_js.at("padding_below_forward").get<vector<std::ptrdiff_t>>();
+            auto padding_above_forward =
+                node_js.at("padding_above_forward").get<vector<std::ptrdiff_t>>();
+            auto data_dilation_strides_forward =
+                node_js.at("data_dilation_strides_forward").get<vector<size_t>>();
+            node = make_shared<op::ConvolutionBackpropFilters>(args[0],
+                                                               filters_shape,
+                                                               args[1],
+                                                               window_movement_strides_forward,
+                                                               window_dilation_strides_forward,
+                                                               padding_below_forward,
+                                                               padding_above_forward,
+                                                               data_dilation_strides_forward);
+        }
+        else if (node_op == "Cos")
+        {
+            node = make_shared<op::Cos>(args[0]);
+        }
+        else if (node_op == "Cosh")
+        {
+            node = make_shared<op::Cosh>(args[0]);
+        }
+        else if (node_op == "Dequantize")
+        {
+            auto type = read_element_type(node_js.at("type"));
+            auto scale = node_js.at("scale").get<float>();
+            auto zero_point = node_js.at("zero_point").get<int32_t>();
+            node = make_shared<op::Dequantize>(args[0], type, scale, zero_point);
+        }
+        else if (node_op == "Divide")
+        {
+            node = make_shared<op::Divide>(args[0], args[1]);
+        }
+        else if (node_op == "Dot")
+        {
+            // For backwards compatibility, reduction_axes_count is optional.
+            auto obj = node_js["reduction_axes_count"];
+            if (obj.empty())
             {
-                node = make_shared<op::GreaterEq>(args[0], args[1]);
+                node = make_shared<op::Dot>(args[0], args[1]);
             }
-            else if (node_op == "Less")
+            else
             {
-                node = make_shared<op::Less>(args[0], args[1]);
+                size_t reduction_axes_count = obj.get<size_t>();
+                node = make_shared<op::Dot>(args[0], args[1], reduction_axes_count);
             }
-            else if (node_op == "LessEq")
+        }
+        else if (node_op == "Equal")
+        {
+            node = make_shared<op::Equal>(args[0], args[1]);
+        }
+        else if (node_op == "Exp")
+        {
+            node = make_shared<op::Exp>(args[0]);
+        }
+        else if (node_op == "Floor")
+        {
+            node = make_shared<op::Floor>(args[0]);
+        }
+        else if (node_op == "FunctionCall")
+        {
+            string function_name = node_js.at("function").get<string>();
+            shared_ptr<Function> f_ptr = function_map.at(function_name);
+            node = make_shared<op::FunctionCall>(f_ptr, args);
+        }
+        else if (node_op == "GetOutputElement")
+        {
+            node = make_shared<op::GetOutputElement>(args[0], node_js.at("n").get<size_t>());
+        }
+        else if (node_op == "Greater")
+        {
+            node = make_shared<op::Greater>(args[0], args[1]);
+        }
+        else if (node_op == "GreaterEq")
+        {
+            node = make_shared<op::GreaterEq>(args[0], args[1]);
+        }
+        else if (node_op == "Less")
+        {
+            node = make_shared<op::Less>(args[0], args[1]);
+        }
+        else if (node_op == "LessEq")
+        {
+            node = make_shared<op::LessEq>(args[0], args[1]);
+        }
+        else if (node_op == "Log")
+        {
+            node = make_shared<op::Log>(args[0]);
+        }
+        else if (node_op == "LRN")
+        {
+            auto alpha = node_js.at("alpha").get<double>();
+            auto beta = node_js.at("beta").get<double>();
+            auto bias = node_js.at("bias").get<double>();
+            auto nsize = node_js.at("nsize").get<size_t>();
+            node = make_shared<op::LRN>(args[0], alpha, beta, bias, nsize);
+        }
+        else if (node_op == "Max")
+        {
+            auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
+            node = make_shared<op::Max>(args[0], reduction_axes);
+        }
+        else if (node_op == "MaxPool")
+        {
+            auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
+            auto window_movement_strides =
+                node_js.at("window_movement_strides").get<vector<size_t>>();
+            // For backwards compatibility, both (but not just one) of the padding_ fields may be
+            // omitted.
+            auto padding_below_maybe = node_js["padding_below"];
+            auto padding_above_maybe = node_js["padding_above"];
+            if (padding_below_maybe.empty() && !padding_above_maybe.empty())
             {
-                node = make_shared<op::LessEq>(args[0], args[1]);
+                throw runtime_error(
+                    "MaxPool: padding_below is absent but padding_above is present");
             }
-            else if (node_op == "Log")
+            else if (!padding_below_maybe.empty() && padding_above_maybe.empty())
             {
-                node = make_shared<op::Log>(args[0]);
+                throw runtime_error(
+                    "MaxPool: padding_below is present but padding_above is absent");
             }
-            else if (node_op == "LRN")
+            else if (!padding_below_maybe.empty() && !padding_above_maybe.empty())
             {
-                auto alpha = node_js.at("alpha").get<double>();
-                auto beta = node_js.at("beta").get<double>();
-                auto bias = node_js.at("bias").get<double>();
-                auto nsize = node_js.at("nsize").get<size_t>();
-                node = make_shared<op::LRN>(args[0], alpha, beta, bias, nsize);
+                auto padding_below = padding_below_maybe.get<vector<size_t>>();
+                auto padding_above = padding_above_maybe.get<vector<size_t>>();
+                node = make_shared<op::MaxPool>(args[0],
+                                                window_shape,
+                                                window_movement_strides,
+                                                padding_below,
+                                                padding_above);
             }
-            else if (node_op == "Max")
+            else
             {
-                auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
-                node = make_shared<op::Max>(args[0], reduction_axes);
+                node = make_shared<op::MaxPool>(args[0], window_shape, window_movement_strides);
             }
-            else if (node_op == "MaxPool")
-            {
-                auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
-                auto window_movement_strides =
-                    node_js.at("window_movement_strides").get<vector<size_t>>();
-                // For backwards compatibility, both (but not just one) of the padding_ fields may be
-                // omitted.
-                auto padding_below_maybe = node_js["padding_below"];
-                auto padding_above_maybe = node_js["padding_above"];
-                if (padding_below_maybe.empty() && !padding_above_maybe.empty())
-                {
-                    throw runtime_error(
-                        "MaxPool: padding_below is absent but padding_above is present");
-                }
-                else if (!padding_below_maybe.empty() && padding_above_maybe.empty())
-                {
-                    throw runtime_error(
-                        "MaxPool: padding_below is present but padding_above is absent");
-                }
-                else if (!padding_below_maybe.empty() && !padding_above_maybe.empty())
-                {
-                    auto padding_below = padding_below_maybe.get<vector<size_t>>();
-                    auto padding_above = padding_above_maybe.get<vector<size_t>>();
-                    node = make_shared<op::MaxPool>(args[0],
+        }
+        else if (node_op == "MaxPoolBackprop")
+        {
+            auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
+            auto window_movement_strides =
+                node_js.at("window_movement_strides").get<vector<size_t>>();
+            auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
+            auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
+            node = make_shared<op::MaxPoolBackprop>(args[0],
+                                                    args[1],
                                                     window_shape,
                                                     window_movement_strides,
                                                     padding_below,
                                                     padding_above);
-                }
-                else
-                {
-                    node = make_shared<op::MaxPool>(args[0], window_shape, window_movement_strides);
-                }
-            }
-            else if (node_op == "MaxPoolBackprop")
-            {
-                auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
-                auto window_movement_strides =
-                    node_js.at("window_movement_strides").get<vector<size_t>>();
-                auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
-                auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
-                node = make_shared<op::MaxPoolBackprop>(args[0],
-                                                        args[1],
-                                                        window_shape,
-                                                        window_movement_strides,
-                                                        padding_below,
-                                                        padding_above);
-            }
-            else if (node_op == "Maximum")
-            {
-                node = make_shared<op::Maximum>(args[0], args[1]);
-            }
-            else if (node_op == "Min")
-            {
-                auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
-                node = make_shared<op::Min>(args[0], reduction_axes);
-            }
-            else if (node_op == "Minimum")
-            {
-                node = make_shared<op::Minimum>(args[0], args[1]);
-            }
-            else if (node_op == "Multiply")
-            {
-                node = make_shared<op::Multiply>(args[0], args[1]);
-            }
-            else if (node_op == "Negative")
-            {
-                node = make_shared<op::Negative>(args[0]);
-            }
-            else if (node_op == "NotEqual")
-            {
-                node = make_shared<op::NotEqual>(args[0], args[1]);
-            }
-            else if (node_op == "Not")
-            {
-                node = make_shared<op::Not>(args[0]);
-            }
-            else if (node_op == "OneHot")
-            {
-                auto shape = node_js.at("shape").get<vector<size_t>>();
-                auto one_hot_axis = node_js.at("one_hot_axis").get<size_t>();
-                node = make_shared<op::OneHot>(args[0], shape, one_hot_axis);
-            }
-            else if (node_op == "Or")
-            {
-                node = make_shared<op::Or>(args[0], args[1]);
-            }
-            else if (node_op == "Pad")
-            {
-                auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
-                auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
-                auto padding_interior = node_js.at("padding_interior").get<vector<size_t>>();
-                node = make_shared<op::Pad>(
-                    args[0], args[1], padding_below, padding_above, padding_interior);
-            }
-            else if (node_op == "Parameter")
-            {
-                auto type_node_js =
-                    node_js.count("element_type") == 0 ? node_js.at("value_type") : node_js;
-                auto element_type = read_element_type(type_node_js.at("element_type"));
-                auto shape = type_node_js.at("shape");
-                auto cacheable = get_or_default<bool>(node_js, "cacheable", false);
-                node = make_shared<op::Parameter>(element_type, shape, cacheable);
-            }
-            else if (node_op == "Power")
-            {
-                node = make_shared<op::Power>(args[0], args[1]);
-            }
-            else if (node_op == "Product")
-            {
-                auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
-                node = make_shared<op::Product>(args[0], reduction_axes);
-            }
-            else if (node_op == "Reduce")
-            {
-                auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
-                string function_name = node_js.at("function").get<string>();
-                shared_ptr<Function> f_ptr = function_map.at(function_name);
-                node = make_shared<op::Reduce>(args[0], args[1], f_ptr, reduction_axes);
-            }
-            else if (node_op == "ReduceWindow")
-            {
-                auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
-                auto window_movement_strides =
-                    node_js.at("window_movement_strides").get<vector<size_t>>();
-                string function_name = node_js.at("function").get<string>();
-                shared_ptr<Function> f_ptr = function_map.at(function_name);
-                node = make_shared<op::ReduceWindow>(
-                    args[0], args[1], f_ptr, window_shape, window_movement_strides);
-            }
-            else if (node_op == "Remainder")
-            {
-                node = make_shared<op::Remainder>(args[0], args[1]);
-            }
-            else if (node_op == "Relu")
-            {
-                node = make_shared<op::Relu>(args[0]);
-            }
-            else if (node_op == "ReluBackprop")
-            {
-                node = make_shared<op::ReluBackprop>(args[0], args[1]);
-            }
-            else if (node_op == "ReplaceSlice")
-            {
-                auto lower_bounds = node_js.at("lower_bounds").get<vector<size_t>>();
-                auto upper_bounds = node_js.at("upper_bounds").get<vector<size_t>>();
-                auto strides = node_js.at("strides").get<vector<size_t>>();
-                node = make_shared<op::ReplaceSlice>(
-                    args[0], args[1], lower_bounds, upper_bounds, strides);
-            }
-            else if (node_op == "Reshape")
-            {
-                auto input_order = node_js.at("input_order").get<vector<size_t>>();
-                auto output_shape = node_js.at("output_shape").get<vector<size_t>>();
-                node = make_shared<op::Reshape>(args[0], input_order, output_shape);
-            }
-            else if (node_op == "Result")
-            {
-                node = make_shared<op::Result>(args[0]);
-            }
-            else if (node_op == "Reverse")
-            {
-                auto reversed_axes = node_js.at("reversed_axes").get<set<size_t>>();
-                node = make_shared<op::Reverse>(args[0], reversed_axes);
-            }
-            else if (node_op == "ReverseSequence")
-            {
-                auto batch_axis = node_js.at("batch_axis").get<size_t>();
-                auto sequence_axis = node_js.at("sequence_axis").get<size_t>();
-                node =
-                    make_shared<op::ReverseSequence>(args[0], args[1], batch_axis, sequence_axis);
+        }
+        else if (node_op == "Maximum")
+        {
+            node = make_shared<op::Maximum>(args[0], args[1]);
+        }
+        else if (node_op == "Min")
+        {
+            auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
+            node = make_shared<op::Min>(args[0], reduction_axes);
+        }
+        else if (node_op == "Minimum")
+        {
+            node = make_shared<op::Minimum>(args[0], args[1]);
+        }
+        else if (node_op == "Multiply")
+        {
+            node = make_shared<op::Multiply>(args[0], args[1]);
+        }
+        else if (node_op == "Negative")
+        {
+            node = make_shared<op::Negative>(args[0]);
+        }
+        else if (node_op == "NotEqual")
+        {
+            node = make_shared<op::NotEqual>(args[0], args[1]);
+        }
+        else if (node_op == "Not")
+        {
+            node = make_shared<op::Not>(args[0]);
+        }
+        else if (node_op == "OneHot")
+        {
+            auto shape = node_js.at("shape").get<vector<size_t>>();
+            auto one_hot_axis = node_js.at("one_hot_axis").get<size_t>();
+            node = make_shared<op::OneHot>(args[0], shape, one_hot_axis);
+        }
+        else if (node_op == "Or")
+        {
+            node = make_shared<op::Or>(args[0], args[1]);
+        }
+        else if (node_op == "Pad")
+        {
+            auto padding_below = node_js.at("padding_below").get<vector<size_t>>();
+            auto padding_above = node_js.at("padding_above").get<vector<size_t>>();
+            auto padding_interior = node_js.at("padding_interior").get<vector<size_t>>();
+            node = make_shared<op::Pad>(
+                args[0], args[1], padding_below, padding_above, padding_interior);
+        }
+        else if (node_op == "Parameter")
+        {
+            auto type_node_js =
+                node_js.count("element_type") == 0 ? node_js.at("value_type") : node_js;
+            auto element_type = read_element_type(type_node_js.at("element_type"));
+            auto shape = type_node_js.at("shape");
+            auto cacheable = get_or_default<bool>(node_js, "cacheable", false);
+            node = make_shared<op::Parameter>(element_type, shape, cacheable);
+        }
+        else if (node_op == "Power")
+        {
+            node = make_shared<op::Power>(args[0], args[1]);
+        }
+        else if (node_op == "Product")
+        {
+            auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
+            node = make_shared<op::Product>(args[0], reduction_axes);
+        }
+        else if (node_op == "Quantize")
+        {
+            auto type = read_element_type(node_js.at("type"));
+            auto scale = node_js.at("scale").get<float>();
+            auto zero_point = node_js.at("zero_point").get<int32_t>();
+            node = make_shared<op::Quantize>(args[0], type, scale, zero_point);
+        }
+        else if (node_op == "QuantizedConvolution")
+        {
+            auto window_movement_strides =
+                node_js.at("window_movement_strides").get<vector<size_t>>();
+            auto window_dilation_strides =
+                node_js.at("window_dilation_strides").get<vector<size_t>>();
+            auto padding_below = node_js.at("padding_below").get<vector<std::ptrdiff_t>>();
+            auto padding_above = node_js.at("padding_above").get<vector<std::ptrdiff_t>>();
+            auto data_scale = node_js.at("data_scale").get<float>();
+            auto data_zero_point = node_js.at("data_zero_point").get<int32_t>();
+            auto filter_scale = node_js.at("filter_scale").get<float>();
+            auto filter_zero_point = node_js.at("filter_zero_point").get<int32_t>();
+            auto output_type = read_element_type(node_js.at("output_type"));
+            auto output_scale = node_js.at("output_scale").get<float>();
+            auto output_zero_point = node_js.at("output_zero_point").get<int32_t>();
+            auto with_relu = node_js.at("with_relu").get<bool>();
+            if (args.size() == 3)
+            {
+                node = make_shared<op::QuantizedConvolution>(args[0],
+                                                             args[1],
+                                                             args[2],
+                                                             window_movement_strides,
+                                                             window_dilation_strides,
+                                                             padding_below,
+                                                             padding_above,
+                                                             data_scale,
+                                                             data_zero_point,
+                                                             filter_scale,
+                                                             filter_zero_point,
+                                                             output_type,
+                                                             output_scale,
+                                                             output_zero_point,
+                                                             with_relu);
             }
-            else if (node_op == "Select")
+            else
             {
-                node = make_shared<op::Select>(args[0], args[1], args[2]);
+                node = make_shared<op::QuantizedConvolution>(args[0],
+                                                             args[1],
+                                                             window_movement_strides,
+                                                             window_dilation_strides,
+                                                             padding_below,
+                                                             padding_above,
+                                                             data_scale,
+                                                             data_zero_point,
+                                                             filter_scale,
+                                                             filter_zero_point,
+                                                             output_type,
+                                                             output_scale,
+                                                             output_zero_point,
+                                                             with_relu);
             }
-            else if (node_op == "SelectAndScatter")
-            {
-                string selection_function_name = node_js.at("selection_function").get<string>();
-                shared_ptr<Function> selection_f_ptr = function_map.at(selection_function_name);
-                string scatter_function_name = node_js.at("scatter_function").get<string>();
-                shared_ptr<Function> scatter_f_ptr = function_map.at(scatter_function_name);
+        }
+        else if (node_op == "Reduce")
+        {
+            auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
+            string function_name = node_js.at("function").get<string>();
+            shared_ptr<Function> f_ptr = function_map.at(function_name);
+            node = make_shared<op::Reduce>(args[0], args[1], f_ptr, reduction_axes);
+        }
+        else if (node_op == "ReduceWindow")
+        {
+            auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
+            auto window_movement_strides =
+                node_js.at("window_movement_strides").get<vector<size_t>>();
+            string function_name = node_js.at("function").get<string>();
+            shared_ptr<Function> f_ptr = function_map.at(function_name);
+            node = make_shared<op::ReduceWindow>(
+                args[0], args[1], f_ptr, window_shape, window_movement_strides);
+        }
+        else if (node_op == "Remainder")
+        {
+            node = make_shared<op::Remainder>(args[0], args[1]);
+        }
+        else if (node_op == "Relu")
+        {
+            node = make_shared<op::Relu>(args[0]);
+        }
+        else if (node_op == "ReluBackprop")
+        {
+            node = make_shared<op::ReluBackprop>(args[0], args[1]);
+        }
+        else if (node_op == "ReplaceSlice")
+        {
+            auto lower_bounds = node_js.at("lower_bounds").get<vector<size_t>>();
+            auto upper_bounds = node_js.at("upper_bounds").get<vector<size_t>>();
+            auto strides = node_js.at("strides").get<vector<size_t>>();
+            node = make_shared<op::ReplaceSlice>(
+                args[0], args[1], lower_bounds, upper_bounds, strides);
+        }
+        else if (node_op == "Reshape")
+        {
+            auto input_order = node_js.at("input_order").get<vector<size_t>>();
+            auto output_shape = node_js.at("output_shape").get<vector<size_t>>();
+            node = make_shared<op::Reshape>(args[0], input_order, output_shape);
+        }
+        else if (node_op == "Result")
+        {
+            node = make_shared<op::Result>(args[0]);
+        }
+        else if (node_op == "Reverse")
+        {
+            auto reversed_axes = node_js.at("reversed_axes").get<set<size_t>>();
+            node = make_shared<op::Reverse>(args[0], reversed_axes);
+        }
+        else if (node_op == "ReverseSequence")
+        {
+            auto batch_axis = node_js.at("batch_axis").get<size_t>();
+            auto sequence_axis = node_js.at("sequence_axis").get<size_t>();
+            node = make_shared<op::ReverseSequence>(args[0], args[1], batch_axis, sequence_axis);
+        }
+        else if (node_op == "Select")
+        {
+            node = make_shared<op::Select>(args[0], args[1], args[2]);
+        }
+        else if (node_op == "SelectAndScatter")
+        {
+            string selection_function_name = node_js.at("selection_function").get<string>();
+            shared_ptr<Function> selection_f_ptr = function_map.at(selection_function_name);
+            string scatter_function_name = node_js.at("scatter_function").get<string>();
+            shared_ptr<Function> scatter_f_ptr = function_map.at(scatter_function_name);
 
-                auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
-                auto window_movement_strides =
-                    node_js.at("window_movement_strides").get<vector<size_t>>();
+            auto window_shape = node_js.at("window_shape").get<vector<size_t>>();
+            auto window_movement_strides =
+                node_js.at("window_movement_strides").get<vector<size_t>>();
 
-                node = make_shared<op::SelectAndScatter>(args[0],
-                                                         args[1],
-                                                         args[2],
-                                                         selection_f_ptr,
-                                                         scatter_f_ptr,
-                                                         window_shape,
-                                                         window_movement_strides);
-            }
-            else if (node_op == "Sigmoid")
-            {
-                node = make_shared<op::Sigmoid>(args[0]);
-            }
-            else if (node_op == "SigmoidBackprop")
-            {
-                node = make_shared<op::SigmoidBackprop>(args[0], args[1]);
-            }
-            else if (node_op == "Sign")
-            {
-                node = make_shared<op::Sign>(args[0]);
-            }
-            else if (node_op == "Sin")
-            {
-                node = make_shared<op::Sin>(args[0]);
-            }
-            else if (node_op == "Sinh")
-            {
-                node = make_shared<op::Sinh>(args[0]);
-            }
-            else if (node_op == "Slice")
-            {
-                auto lower_bounds = node_js.at("lower_bounds").get<vector<size_t>>();
-                auto upper_bounds = node_js.at("upper_bounds").get<vector<size_t>>();
-                auto strides = node_js.at("strides").get<vector<size_t>>();
-                node = make_shared<op::Slice>(args[0], lower_bounds, upper_bounds, strides);
-            }
-            else if (node_op == "Softmax")
-            {
-                auto softmax_axes = node_js.at("softmax_axes").get<set<size_t>>();
-                node = make_shared<op::Softmax>(args[0], softmax_axes);
-            }
-            else if (node_op == "Sqrt")
-            {
-                node = make_shared<op::Sqrt>(args[0]);
-            }
-            else if (node_op == "Subtract")
-            {
-                node = make_shared<op::Subtract>(args[0], args[1]);
-            }
-            else if (node_op == "Sum")
-            {
-                auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
-                node = make_shared<op::Sum>(args[0], reduction_axes);
-            }
-            else if (node_op == "Tan")
-            {
-                node = make_shared<op::Tan>(args[0]);
-            }
-            else if (node_op == "Tanh")
-            {
-                node = make_shared<op::Tanh>(args[0]);
-            }
-            else if (node_op == "StopGradient")
-            {
-                node = make_shared<op::StopGradient>(args[0]);
-            }
-            else
-            {
-                stringstream ss;
-                ss << "unsupported op " << node_op;
-                throw runtime_error(ss.str());
-            }
-            node_map[node_name] = node;
+            node = make_shared<op::SelectAndScatter>(args[0],
+                                                     args[1],
+                                                     args[2],
+                                                     selection_f_ptr,
+                                                     scatter_f_ptr,
+                                                     window_shape,
+                                                     window_movement_strides);
+        }
+        else if (node_op == "Sigmoid")
+        {
+            node = make_shared<op::Sigmoid>(args[0]);
+        }
+        else if (node_op == "SigmoidBackprop")
+        {
+            node = make_shared<op::SigmoidBackprop>(args[0], args[1]);
+        }
+        else if (node_op == "Sign")
+        {
+            node = make_shared<op::Sign>(args[0]);
+        }
+        else if (node_op == "Sin")
+        {
+            node = make_shared<op::Sin>(args[0]);
+        }
+        else if (node_op == "Sinh")
+        {
+            node = make_shared<op::Sinh>(args[0]);
+        }
+        else if (node_op == "Slice")
+        {
+            auto lower_bounds = node_js.at("lower_bounds").get<vector<size_t>>();
+            auto upper_bounds = node_js.at("upper_bounds").get<vector<size_t>>();
+            auto strides = node_js.at("strides").get<vector<size_t>>();
+            node = make_shared<op::Slice>(args[0], lower_bounds, upper_bounds, strides);
+        }
+        else if (node_op == "Softmax")
+        {
+            auto softmax_axes = node_js.at("softmax_axes").get<set<size_t>>();
+            node = make_shared<op::Softmax>(args[0], softmax_axes);
+        }
+        else if (node_op == "Sqrt")
+        {
+            node = make_shared<op::Sqrt>(args[0]);
+        }
+        else if (node_op == "Subtract")
+        {
+            node = make_shared<op::Subtract>(args[0], args[1]);
+        }
+        else if (node_op == "Sum")
+        {
+            auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
+            node = make_shared<op::Sum>(args[0], reduction_axes);
+        }
+        else if (node_op == "Tan")
+        {
+            node = make_shared<op::Tan>(args[0]);
+        }
+        else if (node_op == "Tanh")
+        {
+            node = make_shared<op::Tanh>(args[0]);
+        }
+        else if (node_op == "StopGradient")
+        {
+            node = make_shared<op::StopGradient>(args[0]);
+        }
+        else
+        {
+            stringstream ss;
+            ss << "unsupported op " << node_op;
+            throw runtime_error(ss.str());
+        }
+        node_map[node_name] = node;
 
-            // Typically, it could be unsafe to change the name of a node since it may break nameing
-            // uniqueness. However, it could sometimes be helpful to use the original name from
-            // the serialization for debugging.
-            // node->set_name(node_name);
+        // Typically, it could be unsafe to change the name of a node since it may break nameing
+        // uniqueness. However, it could sometimes be helpful to use the original name from
+        // the serialization for debugging.
+        // node->set_name(node_name);
+    }
+    catch (...)
+    {
+        string node_name;
+        try
+        {
+            node_name = node_js.at("name").get<string>();
         }
         catch (...)
         {
-            string node_name;
-            try
-            {
-                node_name = node_js.at("name").get<string>();
-            }
-            catch (...)
-            {
-                node_name = "UNKNOWN";
-            }
-            throw runtime_error("Error parsing json at node '" + node_name + "'");
+            node_name = "UNKNOWN";
         }
+        throw runtime_error("Error parsing json at node '" + node_name + "'");
     }
+}
+
+// Makes the Function described by func_js from its already constructed nodes
+static shared_ptr<ngraph::Function>
+    make_function(const json& func_js,
+                  const unordered_map<string, shared_ptr<Node>>& node_map,
+                  unordered_map<string, shared_ptr<Function>>& function_map)
+{
+    shared_ptr<ngraph::Function> rc;
+
+    string func_name = func_js.at("name").get<string>();
+    vector<string> func_parameters = func_js.at("parameters").get<vector<string>>();
+    vector<string> func_result = func_js.at("result").get<vector<string>>();
 
     //This handles both graphs w/ `op::Result` and legacy graphs w/o it
     //If we are dealing w/ a legacy graph, add op::Result for each output node
@@ -1140,6 +1300,13 @@ static json write(const Node& n, bool binary_constant_data)
     else if (node_op == "Cosh")
     {
     }
+    else if (node_op == "Dequantize")
+    {
+        auto tmp = dynamic_cast<const op::Dequantize*>(&n);
+        node["type"] = write_element_type(tmp->get_element_type());
+        node["scale"] = tmp->get_scale();
+        node["zero_point"] = tmp->get_zero_point();
+    }
     else if (node_op == "Divide")
     {
     }
@@ -1261,6 +1428,29 @@ static json write(const Node& n, bool binary_constant_data)
     else if (node_op == "Power")
     {
     }
+    else if (node_op == "Quantize")
+    {
+        auto tmp = dynamic_cast<const op::Quantize*>(&n);
+        node["type"] = write_element_type(tmp->get_element_type());
+        node["scale"] = tmp->get_scale();
+        node["zero_point"] = tmp->get_zero_point();
+    }
+    else if (node_op == "QuantizedConvolution")
+    {
+        auto tmp = dynamic_cast<const op::QuantizedConvolution*>(&n);
+        node["window_movement_strides"] = tmp->get_window_movement_strides();
+        node["window_dilation_strides"] = tmp->get_window_dilation_strides();
+        node["padding_below"] = tmp->get_padding_below();
+        node["padding_above"] = tmp->get_padding_above();
+        node["data_scale"] = tmp->get_data_scale();
+        node["data_zero_point"] = tmp->get_data_zero_point();
+        node["filter_scale"] = tmp->get_filter_scale();
+        node["filter_zero_point"] = tmp->get_filter_zero_point();
+        node["output_type"] = write_element_type(tmp->get_element_type());
+        node["output_scale"] = tmp->get_output_scale();
+        node["output_zero_point"] = tmp->get_output_zero_point();
+        node["with_relu"] = tmp->with_relu();
+    }
     else if (node_op == "Reduce")
     {
         auto tmp = dynamic_cast<const op::Reduce*>(&n);
@@ -0,0 +1,121 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+namespace ngraph
+{
+    /// \brief 16-bit "brain" floating point storage type: the upper half of an IEEE f32.
+    ///
+    /// bfloat16 is a storage format. Arithmetic on it promotes to float, so kernels that
+    /// accumulate should do so in float and narrow once when storing the result.
+    class bfloat16
+    {
+    public:
+        constexpr bfloat16()
+            : m_value{0}
+        {
+        }
+        bfloat16(float value)
+            : m_value{round_to_nearest_even(value)}
+        {
+        }
+
+        operator float() const
+        {
+            uint32_t bits = static_cast<uint32_t>(m_value) << 16;
+            float rc;
+            std::memcpy(&rc, &bits, sizeof(rc));
+            return rc;
+        }
+
+        static constexpr bfloat16 from_bits(uint16_t bits) { return bfloat16(bits, true); }
+        uint16_t to_bits() const { return m_value; }
+        bfloat16 operator-() const { return from_bits(m_value ^ 0x8000); }
+        bfloat16& operator+=(float other) { return *this = *this + other; }
+        bfloat16& operator-=(float other) { return *this = *this - other; }
+        bfloat16& operator*=(float other) { return *this = *this * other; }
+        bfloat16& operator/=(float other) { return *this = *this / other; }
+    private:
+        constexpr bfloat16(uint16_t bits, bool)
+            : m_value{bits}
+        {
+        }
+
+        static uint16_t round_to_nearest_even(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            if ((bits & 0x7FFFFFFF) > 0x7F800000)
+            {
+                // Keep NaNs quiet so truncation cannot turn them into infinities
+                return static_cast<uint16_t>((bits >> 16) | 0x0040);
+            }
+            bits += 0x7FFF + ((bits >> 16) & 1);
+            return static_cast<uint16_t>(bits >> 16);
+        }
+
+        uint16_t m_value;
+    };
+
+    std::ostream& operator<<(std::ostream& out, const bfloat16& obj);
+}
+
+namespace std
+{
+    template <>
+    class numeric_limits<ngraph::bfloat16>
+    {
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed = true;
+        static constexpr bool is_integer = false;
+        static constexpr bool is_exact = false;
+        static constexpr bool has_infinity = true;
+        static constexpr bool has_quiet_NaN = true;
+        static constexpr int digits = 8;
+        static constexpr int radix = 2;
+        static constexpr ngraph::bfloat16 min() noexcept
+        {
+            return ngraph::bfloat16::from_bits(0x0080);
+        }
+        static constexpr ngraph::bfloat16 max() noexcept
+        {
+            return ngraph::bfloat16::from_bits(0x7F7F);
+        }
+        static constexpr ngraph::bfloat16 lowest() noexcept
+        {
+            return ngraph::bfloat16::from_bits(0xFF7F);
+        }
+        static constexpr ngraph::bfloat16 epsilon() noexcept
+        {
+            return ngraph::bfloat16::from_bits(0x3C00);
+        }
+        static constexpr ngraph::bfloat16 infinity() noexcept
+        {
+            return ngraph::bfloat16::from_bits(0x7F80);
+        }
+        static constexpr ngraph::bfloat16 quiet_NaN() noexcept
+        {
+            return ngraph::bfloat16::from_bits(0x7FC0);
+        }
+    };
+}
@@ -26,6 +26,8 @@
 #include <vector>
 
 #include "ngraph/except.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 
 namespace ngraph
 {
@@ -35,6 +37,8 @@ namespace ngraph
 
         extern const Type unspecified;
         extern const Type boolean;
+        extern const Type bf16;
+        extern const Type f16;
         extern const Type f32;
         extern const Type f64;
         extern const Type i8;
@@ -85,6 +89,10 @@ namespace ngraph
         template <>
         const Type& from<bool>();
         template <>
+        const Type& from<bfloat16>();
+        template <>
+        const Type& from<float16>();
+        template <>
         const Type& from<float>();
         template <>
         const Type& from<double>();
@@ -105,6 +113,26 @@ namespace ngraph
         template <>
         const Type& from<uint64_t>();
 
+        /// \brief The C++ type that sums of T should be accumulated in.
+        ///
+        /// The 16-bit floating point types are storage formats, so reductions over them
+        /// (Dot, Convolution) accumulate in float and round once when the result is stored.
+        template <typename T>
+        struct accumulation_type
+        {
+            using type = T;
+        };
+        template <>
+        struct accumulation_type<bfloat16>
+        {
+            using type = float;
+        };
+        template <>
+        struct accumulation_type<float16>
+        {
+            using type = float;
+        };
+
         std::ostream& operator<<(std::ostream& out, const ngraph::element::Type& obj);
     }
 }
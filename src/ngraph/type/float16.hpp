@@ -0,0 +1,160 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+namespace ngraph
+{
+    /// \brief IEEE 754 binary16 floating point storage type.
+    ///
+    /// Like bfloat16, float16 is a storage format and arithmetic on it promotes to float.
+    class float16
+    {
+    public:
+        constexpr float16()
+            : m_value{0}
+        {
+        }
+        float16(float value)
+            : m_value{round_to_nearest_even(value)}
+        {
+        }
+
+        operator float() const
+        {
+            uint32_t sign = static_cast<uint32_t>(m_value & 0x8000) << 16;
+            uint32_t exponent = (m_value >> 10) & 0x1F;
+            uint32_t mantissa = m_value & 0x3FF;
+            uint32_t bits;
+            if (exponent == 0x1F)
+            {
+                bits = sign | 0x7F800000 | (mantissa << 13);
+            }
+            else if (exponent == 0)
+            {
+                // Zero or subnormal, both exactly representable as mantissa * 2^-24
+                float value = static_cast<float>(mantissa) * (1.0f / 16777216.0f);
+                std::memcpy(&bits, &value, sizeof(bits));
+                bits |= sign;
+            }
+            else
+            {
+                bits = sign | ((exponent + (127 - 15)) << 23) | (mantissa << 13);
+            }
+            float rc;
+            std::memcpy(&rc, &bits, sizeof(rc));
+            return rc;
+        }
+
+        static constexpr float16 from_bits(uint16_t bits) { return float16(bits, true); }
+        uint16_t to_bits() const { return m_value; }
+        float16 operator-() const { return from_bits(m_value ^ 0x8000); }
+        float16& operator+=(float other) { return *this = *this + other; }
+        float16& operator-=(float other) { return *this = *this - other; }
+        float16& operator*=(float other) { return *this = *this * other; }
+        float16& operator/=(float other) { return *this = *this / other; }
+    private:
+        constexpr float16(uint16_t bits, bool)
+            : m_value{bits}
+        {
+        }
+
+        static uint16_t round_to_nearest_even(float value)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+            bits &= 0x7FFFFFFF;
+
+            if (bits >= 0x7F800000)
+            {
+                // Infinity stays infinity, NaN keeps its payload and is made quiet
+                return bits == 0x7F800000
+                           ? sign | 0x7C00
+                           : sign | 0x7E00 | static_cast<uint16_t>((bits >> 13) & 0x3FF);
+            }
+            if (bits >= 0x477FF000)
+            {
+                // At or above 65520, which rounds past the largest finite value 65504
+                return sign | 0x7C00;
+            }
+            if (bits < 0x38800000)
+            {
+                // Below the smallest normal 2^-14. Adding 0.5 lines the half precision
+                // subnormal ulp (2^-24) up with the f32 ulp at 0.5, so the FPU does the
+                // rounding and the mantissa bits are the subnormal encoding.
+                float magnitude;
+                std::memcpy(&magnitude, &bits, sizeof(magnitude));
+                magnitude += 0.5f;
+                std::memcpy(&bits, &magnitude, sizeof(bits));
+                return sign | static_cast<uint16_t>(bits - 0x3F000000);
+            }
+            uint32_t odd = (bits >> 13) & 1;
+            bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xFFF + odd;
+            return sign | static_cast<uint16_t>(bits >> 13);
+        }
+
+        uint16_t m_value;
+    };
+
+    std::ostream& operator<<(std::ostream& out, const float16& obj);
+}
+
+namespace std
+{
+    template <>
+    class numeric_limits<ngraph::float16>
+    {
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed = true;
+        static constexpr bool is_integer = false;
+        static constexpr bool is_exact = false;
+        static constexpr bool has_infinity = true;
+        static constexpr bool has_quiet_NaN = true;
+        static constexpr int digits = 11;
+        static constexpr int radix = 2;
+        static constexpr ngraph::float16 min() noexcept
+        {
+            return ngraph::float16::from_bits(0x0400);
+        }
+        static constexpr ngraph::float16 max() noexcept
+        {
+            return ngraph::float16::from_bits(0x7BFF);
+        }
+        static constexpr ngraph::float16 lowest() noexcept
+        {
+            return ngraph::float16::from_bits(0xFBFF);
+        }
+        static constexpr ngraph::float16 epsilon() noexcept
+        {
+            return ngraph::float16::from_bits(0x1400);
+        }
+        static constexpr ngraph::float16 infinity() noexcept
+        {
+            return ngraph::float16::from_bits(0x7C00);
+        }
+        static constexpr ngraph::float16 quiet_NaN() noexcept
+        {
+            return ngraph::float16::from_bits(0x7E00);
+        }
+    };
+}
@@ -14,13 +14,24 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <future>
 #include <iomanip>
 #include <random>
+#include <sys/resource.h>
+#include <thread>
+
+#include "nlohmann/json.hpp"
 
 #include "benchmark.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/batching_executor.hpp"
 #include "ngraph/runtime/tensor_view.hpp"
 #include "ngraph/runtime/tensor_view.hpp"
 #include "ngraph/serializer.hpp"
@@ -80,11 +91,13 @@ multimap<size_t, string> aggregate_timing(const vector<runtime::PerformanceCount
     return rc;
 }
 
-void run_benchmark(const string& json_path,
-                   const string& backend_name,
-                   size_t iterations,
-                   bool timing_detail,
-                   int warmup_iterations)
+BenchmarkResult run_benchmark(const string& json_path,
+                              const string& backend_name,
+                              size_t iterations,
+                              bool timing_detail,
+                              int warmup_iterations,
+                              size_t threads,
+                              bool separate_backends)
 {
     stopwatch timer;
     timer.start();
@@ -93,7 +106,10 @@ void run_benchmark(const string& json_path,
     shared_ptr<Function> f = deserialize(ss);
     timer.stop();
     cout << "deserialize time: " << timer.get_milliseconds() << "ms" << endl;
-    run_benchmark(f, backend_name, iterations, timing_detail, warmup_iterations);
+    BenchmarkResult result = run_benchmark(
+        f, backend_name, iterations, timing_detail, warmup_iterations, threads, separate_backends);
+    result.model = json_path;
+    return result;
 }
 
 void print_times(const multimap<size_t, string>& timing)
@@ -236,64 +252,168 @@ static void random_init(shared_ptr<runtime::TensorView> tv)
     }
 }
 
-void run_benchmark(shared_ptr<Function> f,
-                   const string& backend_name,
-                   size_t iterations,
-                   bool timing_detail,
-                   int warmup_iterations)
+static double percentile(const vector<double>& sorted, double p)
+{
+    size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+    return sorted[index];
+}
+
+static size_t get_peak_rss()
+{
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss;
+#else
+    return usage.ru_maxrss * 1024;
+#endif
+}
+
+BenchmarkResult run_benchmark(shared_ptr<Function> f,
+                              const string& backend_name,
+                              size_t iterations,
+                              bool timing_detail,
+                              int warmup_iterations,
+                              size_t threads,
+                              bool separate_backends)
 {
+    struct Caller
+    {
+        shared_ptr<runtime::Backend> backend;
+        shared_ptr<Function> function;
+        vector<shared_ptr<runtime::TensorView>> args;
+        vector<shared_ptr<runtime::TensorView>> results;
+        vector<double> latencies;
+    };
+
+    threads = max<size_t>(threads, 1);
+    vector<Caller> callers(threads);
+
+    // Clone before compiling, since compiling rewrites the Function
+    for (size_t i = 0; i < threads; i++)
+    {
+        if (i == 0 || separate_backends)
+        {
+            callers[i].backend = runtime::Backend::create(backend_name);
+            callers[i].function = (i == 0 ? f : clone_function(*f));
+        }
+        else
+        {
+            callers[i].backend = callers[0].backend;
+            callers[i].function = f;
+        }
+    }
+
     stopwatch timer;
     timer.start();
-    auto backend = runtime::Backend::create(backend_name);
-    backend->enable_performance_data(f, timing_detail);
-    backend->compile(f);
+    callers[0].backend->enable_performance_data(f, timing_detail);
+    callers[0].backend->compile(f);
     timer.stop();
     cout.imbue(locale(""));
     cout << "compile time: " << timer.get_milliseconds() << "ms" << endl;
 
-    vector<shared_ptr<runtime::TensorView>> args;
-    vector<bool> args_cacheable;
-    for (shared_ptr<op::Parameter> param : f->get_parameters())
-    {
-        auto tensor = backend->create_tensor(param->get_element_type(), param->get_shape());
-        random_init(tensor);
-        args.push_back(tensor);
-        args_cacheable.push_back(param->get_cacheable());
-    }
-    vector<shared_ptr<runtime::TensorView>> results;
-    for (shared_ptr<Node> out : f->get_results())
+    for (Caller& caller : callers)
     {
-        auto result = backend->create_tensor(out->get_element_type(), out->get_shape());
-        results.push_back(result);
-    }
+        if (caller.backend != callers[0].backend)
+        {
+            caller.backend->compile(caller.function);
+        }
 
-    for (size_t i = 0; i < args.size(); i++)
-    {
-        if (args_cacheable[i])
+        for (shared_ptr<op::Parameter> param : caller.function->get_parameters())
         {
-            args[i]->set_stale(false);
+            auto tensor =
+                caller.backend->create_tensor(param->get_element_type(), param->get_shape());
+            random_init(tensor);
+            if (param->get_cacheable())
+            {
+                tensor->set_stale(false);
+            }
+            caller.args.push_back(tensor);
+        }
+        for (shared_ptr<Node> out : caller.function->get_results())
+        {
+            caller.results.push_back(
+                caller.backend->create_tensor(out->get_element_type(), out->get_shape()));
         }
-    }
 
-    if (warmup_iterations)
-    {
         for (int i = 0; i < warmup_iterations; i++)
         {
-            backend->call(f, results, args);
+            caller.backend->call(caller.function, caller.results, caller.args);
         }
     }
 
+    auto run_caller = [iterations](Caller& caller) {
+        caller.latencies.reserve(iterations);
+        stopwatch call_timer;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            call_timer.start();
+            caller.backend->call(caller.function, caller.results, caller.args);
+            call_timer.stop();
+            caller.latencies.push_back(call_timer.get_nanoseconds() / 1000000.0);
+        }
+    };
+
     stopwatch t1;
     t1.start();
-    for (size_t i = 0; i < static_cast<size_t>(iterations); i++)
+    if (threads == 1)
     {
-        backend->call(f, results, args);
+        run_caller(callers[0]);
+    }
+    else
+    {
+        vector<thread> workers;
+        for (Caller& caller : callers)
+        {
+            workers.emplace_back(run_caller, ref(caller));
+        }
+        for (thread& worker : workers)
+        {
+            worker.join();
+        }
     }
     t1.stop();
-    float time = t1.get_milliseconds();
-    cout << time / iterations << "ms per iteration" << endl;
 
-    vector<runtime::PerformanceCounter> perf_data = backend->get_performance_data(f);
+    vector<double> latencies;
+    for (const Caller& caller : callers)
+    {
+        latencies.insert(latencies.end(), caller.latencies.begin(), caller.latencies.end());
+    }
+    sort(latencies.begin(), latencies.end());
+
+    BenchmarkResult result;
+    result.backend = backend_name;
+    result.threads = threads;
+    result.iterations = iterations;
+    result.compile_ms = timer.get_milliseconds();
+    result.temporary_pool_bytes = f->get_temporary_pool_size();
+    result.peak_rss_bytes = get_peak_rss();
+    if (!latencies.empty())
+    {
+        double total = 0;
+        for (double latency : latencies)
+        {
+            total += latency;
+        }
+        result.mean_ms = total / latencies.size();
+        result.p50_ms = percentile(latencies, 0.5);
+        result.p90_ms = percentile(latencies, 0.9);
+        result.p99_ms = percentile(latencies, 0.99);
+        result.max_ms = latencies.back();
+        result.throughput =
+            latencies.size() * 1000000000.0 / max<size_t>(t1.get_nanoseconds(), 1);
+    }
+
+    cout << result.mean_ms << "ms per iteration" << endl;
+    cout << "latency p50 " << result.p50_ms << "ms, p90 " << result.p90_ms << "ms, p99 "
+         << result.p99_ms << "ms, max " << result.max_ms << "ms" << endl;
+    cout << "throughput " << result.throughput << " calls/s from " << threads << " thread"
+         << (threads == 1 ? "" : "s")
+         << (threads > 1 && separate_backends ? " with separate backends" : "") << endl;
+    cout << "temporary pool " << result.temporary_pool_bytes << " bytes, peak RSS "
+         << result.peak_rss_bytes << " bytes" << endl;
+
+    vector<runtime::PerformanceCounter> perf_data = callers[0].backend->get_performance_data(f);
     sort(perf_data.begin(),
          perf_data.end(),
          [](const runtime::PerformanceCounter& p1, const runtime::PerformanceCounter& p2) {
@@ -307,4 +427,197 @@ void run_benchmark(shared_ptr<Function> f,
 
     cout << "\n---- Aggregate times per op type/shape/count ----\n";
     print_times(timing_details);
+
+    return result;
+}
+
+void write_benchmark_results(const string& path, const vector<BenchmarkResult>& results)
+{
+    nlohmann::json j = nlohmann::json::array();
+    for (const BenchmarkResult& r : results)
+    {
+        nlohmann::json entry;
+        entry["model"] = r.model;
+        entry["backend"] = r.backend;
+        entry["threads"] = r.threads;
+        entry["iterations"] = r.iterations;
+        entry["compile_ms"] = r.compile_ms;
+        entry["mean_ms"] = r.mean_ms;
+        entry["p50_ms"] = r.p50_ms;
+        entry["p90_ms"] = r.p90_ms;
+        entry["p99_ms"] = r.p99_ms;
+        entry["max_ms"] = r.max_ms;
+        entry["throughput"] = r.throughput;
+        entry["temporary_pool_bytes"] = r.temporary_pool_bytes;
+        entry["peak_rss_bytes"] = r.peak_rss_bytes;
+        j.push_back(entry);
+    }
+    ofstream out(path);
+    if (!out)
+    {
+        throw runtime_error("Unable to open '" + path + "' for writing");
+    }
+    out << setw(4) << j << endl;
+}
+
+vector<BenchmarkResult> read_benchmark_results(const string& path)
+{
+    nlohmann::json j = nlohmann::json::parse(file_util::read_file_to_string(path));
+    vector<BenchmarkResult> results;
+    for (const nlohmann::json& entry : j)
+    {
+        BenchmarkResult r;
+        r.model = entry.at("model").get<string>();
+        r.backend = entry.at("backend").get<string>();
+        r.threads = entry.at("threads").get<size_t>();
+        r.iterations = entry.at("iterations").get<size_t>();
+        r.compile_ms = entry.at("compile_ms").get<double>();
+        r.mean_ms = entry.at("mean_ms").get<double>();
+        r.p50_ms = entry.at("p50_ms").get<double>();
+        r.p90_ms = entry.at("p90_ms").get<double>();
+        r.p99_ms = entry.at("p99_ms").get<double>();
+        r.max_ms = entry.at("max_ms").get<double>();
+        r.throughput = entry.at("throughput").get<double>();
+        r.temporary_pool_bytes = entry.at("temporary_pool_bytes").get<size_t>();
+        r.peak_rss_bytes = entry.at("peak_rss_bytes").get<size_t>();
+        results.push_back(r);
+    }
+    return results;
+}
+
+bool compare_benchmark_results(const vector<BenchmarkResult>& results,
+                               const vector<BenchmarkResult>& baseline,
+                               double tolerance)
+{
+    bool ok = true;
+    for (const BenchmarkResult& r : results)
+    {
+        string key = r.model + ", " + r.backend + ", " + to_string(r.threads) + " threads";
+        auto base = find_if(baseline.begin(), baseline.end(), [&](const BenchmarkResult& b) {
+            return b.model == r.model && b.backend == r.backend && b.threads == r.threads;
+        });
+        if (base == baseline.end())
+        {
+            cout << "no baseline for " << key << endl;
+            continue;
+        }
+
+        auto check = [&](const string& metric, double value, double base_value, bool higher) {
+            bool regressed = higher ? value > base_value * (1 + tolerance)
+                                    : value < base_value * (1 - tolerance);
+            if (regressed)
+            {
+                cout << "REGRESSION " << key << ": " << metric << " " << value << " vs baseline "
+                     << base_value << endl;
+                ok = false;
+            }
+        };
+        check("p50_ms", r.p50_ms, base->p50_ms, true);
+        check("p99_ms", r.p99_ms, base->p99_ms, true);
+        check("throughput", r.throughput, base->throughput, false);
+        check("temporary_pool_bytes", r.temporary_pool_bytes, base->temporary_pool_bytes, true);
+        check("peak_rss_bytes", r.peak_rss_bytes, base->peak_rss_bytes, true);
+    }
+    return ok;
+}
+
+void run_batching_benchmark(shared_ptr<Function> f,
+                            const string& backend_name,
+                            size_t requests,
+                            size_t max_batch_size,
+                            size_t timeout_us,
+                            const vector<size_t>& concurrency_levels)
+{
+    auto backend = runtime::Backend::create(backend_name);
+    runtime::BatchingExecutor executor(
+        backend, f, max_batch_size, chrono::microseconds(timeout_us));
+
+    // Every request is a single row of the model's batch dimension
+    auto make_tensors = [&]() {
+        vector<shared_ptr<runtime::TensorView>> args;
+        for (shared_ptr<op::Parameter> param : f->get_parameters())
+        {
+            Shape shape = param->get_shape();
+            shape.at(0) = 1;
+            auto tensor = backend->create_tensor(param->get_element_type(), shape);
+            random_init(tensor);
+            args.push_back(tensor);
+        }
+        vector<shared_ptr<runtime::TensorView>> results;
+        for (shared_ptr<Node> out : f->get_results())
+        {
+            Shape shape = out->get_shape();
+            shape.at(0) = 1;
+            results.push_back(backend->create_tensor(out->get_element_type(), shape));
+        }
+        return make_pair(results, args);
+    };
+
+    // Compile every bucket up to the maximum batch size before measuring, including those
+    // the warm-up requests below do not happen to hit
+    for (size_t batch_size = 1;; batch_size *= 2)
+    {
+        executor.get_bucketed_function().compile(batch_size);
+        if (batch_size >= max_batch_size)
+        {
+            break;
+        }
+    }
+    {
+        auto tensors = make_tensors();
+        vector<future<void>> futures;
+        for (size_t i = 0; i < max_batch_size; i++)
+        {
+            futures.push_back(executor.submit(tensors.first, tensors.second));
+        }
+        for (future<void>& done : futures)
+        {
+            done.get();
+        }
+    }
+
+    cout << "batching with max batch size " << max_batch_size << ", timeout " << timeout_us
+         << "us, " << requests << " requests per concurrency level\n";
+    cout << setw(12) << right << "concurrency" << setw(16) << "requests/s" << setw(12)
+         << "p50 ms" << setw(12) << "p99 ms" << endl;
+    for (size_t concurrency : concurrency_levels)
+    {
+        if (concurrency == 0)
+        {
+            continue;
+        }
+        vector<double> latencies(requests);
+        atomic<size_t> next_request{0};
+        auto client = [&]() {
+            auto tensors = make_tensors();
+            for (size_t i = next_request++; i < requests; i = next_request++)
+            {
+                stopwatch timer;
+                timer.start();
+                executor.submit(tensors.first, tensors.second).get();
+                timer.stop();
+                latencies[i] = timer.get_microseconds() / 1000.0;
+            }
+        };
+
+        stopwatch timer;
+        timer.start();
+        vector<thread> clients;
+        for (size_t i = 0; i < concurrency; i++)
+        {
+            clients.emplace_back(client);
+        }
+        for (thread& t : clients)
+        {
+            t.join();
+        }
+        timer.stop();
+
+        sort(latencies.begin(), latencies.end());
+        double throughput = requests * 1000000.0 / max<size_t>(timer.get_microseconds(), 1);
+        cout << setw(12) << concurrency << setw(16) << fixed << setprecision(1) << throughput
+             << setw(12) << setprecision(3) << percentile(latencies, 0.5) << setw(12)
+             << percentile(latencies, 0.99) << endl;
+    }
+    cout.unsetf(ios::floatfield);
 }
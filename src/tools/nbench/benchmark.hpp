@@ -28,14 +28,59 @@
 std::multimap<size_t, std::string>
     aggregate_timing(const std::vector<ngraph::runtime::PerformanceCounter>& perf_data);
 
-void run_benchmark(std::shared_ptr<ngraph::Function> f,
-                   const std::string& backend_name,
-                   size_t iterations,
-                   bool timing_detail,
-                   int warmup_iterations);
-
-void run_benchmark(const std::string& json_path,
-                   const std::string& backend_name,
-                   size_t iterations,
-                   bool timing_detail = false,
-                   int warmup_iterations = 1);
+/// Latency, throughput and memory figures from one run_benchmark
+struct BenchmarkResult
+{
+    std::string model;
+    std::string backend;
+    size_t threads = 1;
+    size_t iterations = 0;
+    double compile_ms = 0;
+    double mean_ms = 0;
+    double p50_ms = 0;
+    double p90_ms = 0;
+    double p99_ms = 0;
+    double max_ms = 0;
+    /// Calls per second summed over all threads
+    double throughput = 0;
+    size_t temporary_pool_bytes = 0;
+    size_t peak_rss_bytes = 0;
+};
+
+/// Runs iterations calls of f from each of threads callers. The callers share one backend
+/// unless separate_backends is set, in which case each compiles its own copy of f.
+BenchmarkResult run_benchmark(std::shared_ptr<ngraph::Function> f,
+                              const std::string& backend_name,
+                              size_t iterations,
+                              bool timing_detail,
+                              int warmup_iterations,
+                              size_t threads = 1,
+                              bool separate_backends = false);
+
+BenchmarkResult run_benchmark(const std::string& json_path,
+                              const std::string& backend_name,
+                              size_t iterations,
+                              bool timing_detail = false,
+                              int warmup_iterations = 1,
+                              size_t threads = 1,
+                              bool separate_backends = false);
+
+void write_benchmark_results(const std::string& path,
+                             const std::vector<BenchmarkResult>& results);
+
+std::vector<BenchmarkResult> read_benchmark_results(const std::string& path);
+
+/// Prints every result whose p50 or p99 latency, throughput or memory is worse than the
+/// matching baseline entry by more than tolerance (a fraction), and returns false if any are
+bool compare_benchmark_results(const std::vector<BenchmarkResult>& results,
+                               const std::vector<BenchmarkResult>& baseline,
+                               double tolerance);
+
+/// Drives a BatchingExecutor with single-row requests from each number of client threads in
+/// concurrency_levels and reports throughput and p50/p99 request latency
+void run_batching_benchmark(std::shared_ptr<ngraph::Function> f,
+                            const std::string& backend_name,
+                            size_t requests,
+                            size_t max_batch_size,
+                            size_t timeout_us,
+                            const std::vector<size_t>& concurrency_levels);
@@ -44,6 +44,14 @@ int main(int argc, char** argv)
     bool timing_detail = false;
     bool visualize = false;
     int warmup_iterations = 1;
+    size_t batch_size = 0;
+    size_t batch_timeout = 1000;
+    vector<size_t> concurrency{1, 2, 4, 8, 16};
+    size_t threads = 1;
+    bool separate_backends = false;
+    string json_path;
+    string baseline_path;
+    double tolerance = 5;
 
     for (size_t i = 1; i < argc; i++)
     {
@@ -96,6 +104,82 @@ int main(int argc, char** argv)
                 failed = true;
             }
         }
+        else if (arg == "--batch_size" || arg == "--batch-size")
+        {
+            try
+            {
+                batch_size = stoul(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--batch_timeout" || arg == "--batch-timeout")
+        {
+            try
+            {
+                batch_timeout = stoul(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--concurrency")
+        {
+            try
+            {
+                concurrency.clear();
+                for (const string& level : split(argv[++i], ','))
+                {
+                    concurrency.push_back(stoul(level));
+                }
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "-t" || arg == "--threads")
+        {
+            try
+            {
+                threads = stoul(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--separate_backends" || arg == "--separate-backends")
+        {
+            separate_backends = true;
+        }
+        else if (arg == "--json")
+        {
+            json_path = argv[++i];
+        }
+        else if (arg == "--baseline")
+        {
+            baseline_path = argv[++i];
+        }
+        else if (arg == "--tolerance")
+        {
+            try
+            {
+                tolerance = stod(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
         else
         {
             cout << "Unknown option: " << arg << endl;
@@ -112,6 +196,11 @@ int main(int argc, char** argv)
         cout << "Directory " << model << " not found\n";
         failed = true;
     }
+    else if (!baseline_path.empty() && !file_util::exists(baseline_path))
+    {
+        cout << "Baseline " << baseline_path << " not found\n";
+        failed = true;
+    }
     else if (directory.empty() && model.empty())
     {
         cout << "Either file or directory must be specified\n";
@@ -136,10 +225,25 @@ OPTIONS
         -v|--visualize            Visualize a model (WARNING: requires GraphViz installed)
         --timing-detail           Gather detailed timing
         -w|--warmup_iterations    Number of warm-up iterations
+        --batch-size              Batch concurrent single-row requests up to this many rows
+                                  and report throughput and latency. Runs <iterations>
+                                  requests at each concurrency level.
+        --batch-timeout           Longest time in us a request waits for a batch (default: 1000)
+        --concurrency             Comma separated client thread counts (default: 1,2,4,8,16)
+        -t|--threads              Concurrent callers, each running <iterations> calls
+                                  (default: 1)
+        --separate-backends       Give each caller its own backend and compiled model
+        --json                    Write latency, throughput and memory results to this file
+        --baseline                Results file from --json to compare against. Exits with 1
+                                  if any result regressed.
+        --tolerance               Allowed regression against the baseline in percent
+                                  (default: 5)
 )###";
         return 1;
     }
 
+    vector<BenchmarkResult> results;
+
     if (visualize)
     {
         shared_ptr<Function> f = deserialize(model);
@@ -205,7 +309,15 @@ OPTIONS
                 shared_ptr<Function> f = deserialize(m);
                 cout << "Benchmarking " << m << ", " << backend << " backend, " << iterations
                      << " iterations.\n";
-                run_benchmark(f, backend, iterations, timing_detail, warmup_iterations);
+                BenchmarkResult result = run_benchmark(f,
+                                                       backend,
+                                                       iterations,
+                                                       timing_detail,
+                                                       warmup_iterations,
+                                                       threads,
+                                                       separate_backends);
+                result.model = m;
+                results.push_back(result);
             }
             catch (exception e)
             {
@@ -213,12 +325,32 @@ OPTIONS
             }
         }
     }
+    else if (batch_size > 0 && iterations > 0)
+    {
+        shared_ptr<Function> f = deserialize(model);
+        cout << "Benchmarking " << model << ", " << backend << " backend, batched requests.\n";
+        run_batching_benchmark(f, backend, iterations, batch_size, batch_timeout, concurrency);
+    }
     else if (iterations > 0)
     {
         shared_ptr<Function> f = deserialize(model);
         cout << "Benchmarking " << model << ", " << backend << " backend, " << iterations
              << " iterations.\n";
-        run_benchmark(f, backend, iterations, timing_detail, warmup_iterations);
+        BenchmarkResult result = run_benchmark(
+            f, backend, iterations, timing_detail, warmup_iterations, threads, separate_backends);
+        result.model = model;
+        results.push_back(result);
+    }
+
+    if (!json_path.empty())
+    {
+        write_benchmark_results(json_path, results);
+    }
+    if (!baseline_path.empty() &&
+        !compare_benchmark_results(
+            results, read_benchmark_results(baseline_path), tolerance / 100))
+    {
+        return 1;
     }
 
     return 0;
@@ -2305,6 +2305,119 @@ NGRAPH_TEST(${BACKEND_NAME}, convert_float32_bool)
     backend->call_with_validate(f, {result}, {a});
     EXPECT_EQ((vector<char>{1, 2, 3, 4}), read_vector<char>(result));
 }
+NGRAPH_TEST(${BACKEND_NAME}, convert_float32_bf16)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto narrow = make_shared<op::Convert>(A, element::bf16);
+    auto f = make_shared<Function>(make_shared<op::Convert>(narrow, element::f32),
+                                   op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1.0f, 1.0f / 3, -2.5f, 257.0f});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    backend->call_with_validate(f, {result}, {a});
+    // 257 is a tie between 256 and 258 and rounds to the even mantissa
+    EXPECT_EQ((vector<float>{1.0f, 0.333984375f, -2.5f, 256.0f}), read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, convert_float32_f16)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto narrow = make_shared<op::Convert>(A, element::f16);
+    auto f = make_shared<Function>(make_shared<op::Convert>(narrow, element::f32),
+                                   op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1.0f, 1.0f / 3, 65519.0f, 70000.0f});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    backend->call_with_validate(f, {result}, {a});
+    EXPECT_EQ((vector<float>{1.0f, 0.333251953125f, 65504.0f, INFINITY}),
+              read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dot_bf16_accumulates_in_f32)
+{
+    Shape shape_a{2, 3};
+    Shape shape_b{3, 1};
+    auto A = make_shared<op::Parameter>(element::bf16, shape_a);
+    auto B = make_shared<op::Parameter>(element::bf16, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), op::ParameterVector{A, B});
+    Shape shape_r{2, 1};
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::bf16, shape_a);
+    copy_data(a, vector<bfloat16>{256, 1, 1, 1, 2, 3});
+    auto b = backend->create_tensor(element::bf16, shape_b);
+    copy_data(b, vector<bfloat16>{1, 1, 1});
+    auto result = backend->create_tensor(element::bf16, shape_r);
+
+    backend->call_with_validate(f, {result}, {a, b});
+    // Summing in bf16 would lose both ones against 256 and produce 256
+    auto r = read_vector<bfloat16>(result);
+    EXPECT_EQ((vector<float>{258, 6}), (vector<float>{r[0], r[1]}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dot_bf16_constant_weights)
+{
+    Shape shape_a{2, 3};
+    Shape shape_b{3, 1};
+    auto A = make_shared<op::Parameter>(element::bf16, shape_a);
+    auto B = op::Constant::create(element::bf16, shape_b, {1, 2, 3});
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), op::ParameterVector{A});
+    Shape shape_r{2, 1};
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::bf16, shape_a);
+    auto result = backend->create_tensor(element::bf16, shape_r);
+
+    // The second call must see its new input against the same weights
+    copy_data(a, vector<bfloat16>{1, 1, 1, 2, 0, 1});
+    backend->call_with_validate(f, {result}, {a});
+    auto r = read_vector<bfloat16>(result);
+    EXPECT_EQ((vector<float>{6, 5}), (vector<float>{r[0], r[1]}));
+
+    copy_data(a, vector<bfloat16>{0, 1, 0, 4, 4, 4});
+    backend->call_with_validate(f, {result}, {a});
+    r = read_vector<bfloat16>(result);
+    EXPECT_EQ((vector<float>{2, 24}), (vector<float>{r[0], r[1]}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, convolution_f16_accumulates_in_f32)
+{
+    Shape shape_a{1, 1, 4};
+    Shape shape_b{1, 1, 3};
+    auto A = make_shared<op::Parameter>(element::f16, shape_a);
+    auto B = make_shared<op::Parameter>(element::f16, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Convolution>(A, B), op::ParameterVector{A, B});
+    Shape shape_r{1, 1, 2};
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f16, shape_a);
+    copy_data(a, vector<float16>{2048, 1, 1, 4});
+    auto b = backend->create_tensor(element::f16, shape_b);
+    copy_data(b, vector<float16>{1, 1, 1});
+    auto result = backend->create_tensor(element::f16, shape_r);
+
+    backend->call_with_validate(f, {result}, {a, b});
+    // Summing in f16 would round 2048 + 1 back down to 2048 at every step
+    auto r = read_vector<float16>(result);
+    EXPECT_EQ((vector<float>{2050, 6}), (vector<float>{r[0], r[1]}));
+}
 
 // Trivial case with no reduction axes.
 NGRAPH_TEST(${BACKEND_NAME}, reduce_trivial)
@@ -2600,6 +2713,101 @@ NGRAPH_TEST(${BACKEND_NAME}, reduce_3d_to_vector)
               read_vector<float>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, reduce_matrix_columns_initial_value)
+{
+    // The reduction function (f(x:float32[],y:float32[]) = y+x) matches Sum, with the initial
+    // value added once per result
+    auto f_A = make_shared<op::Parameter>(element::f32, Shape{});
+    auto f_B = make_shared<op::Parameter>(element::f32, Shape{});
+    auto f = make_shared<Function>(make_shared<op::Add>(f_B, f_A), op::ParameterVector{f_A, f_B});
+
+    Shape shape_a{3, 2};
+    auto g_A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto g_B = make_shared<op::Parameter>(element::f32, Shape{});
+    Shape shape_rt{2};
+    auto g = make_shared<Function>(make_shared<op::Reduce>(g_A, g_B, f, AxisSet{0}),
+                                   op::ParameterVector{g_A, g_B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    auto b = backend->create_tensor(element::f32, Shape{});
+    copy_data(b, vector<float>{10});
+    auto result = backend->create_tensor(element::f32, shape_rt);
+
+    backend->call_with_validate(g, {result}, {a, b});
+    EXPECT_EQ((vector<float>{19, 22}), read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, reduce_boolean_and_or)
+{
+    auto f_A = make_shared<op::Parameter>(element::boolean, Shape{});
+    auto f_B = make_shared<op::Parameter>(element::boolean, Shape{});
+    auto f_and =
+        make_shared<Function>(make_shared<op::And>(f_A, f_B), op::ParameterVector{f_A, f_B});
+    auto f_or = make_shared<Function>(make_shared<op::Or>(f_A, f_B), op::ParameterVector{f_A, f_B});
+
+    Shape shape_a{3, 3};
+    auto g_A = make_shared<op::Parameter>(element::boolean, shape_a);
+    auto g_B = make_shared<op::Parameter>(element::boolean, Shape{});
+    Shape shape_rt{3};
+    auto g = make_shared<Function>(
+        NodeVector{make_shared<op::Reduce>(g_A, g_B, f_and, AxisSet{1}),
+                   make_shared<op::Reduce>(g_A, g_B, f_or, AxisSet{1})},
+        op::ParameterVector{g_A, g_B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::boolean, shape_a);
+    copy_data(a, vector<char>{1, 1, 1, 1, 0, 1, 0, 0, 0});
+    auto b = backend->create_tensor(element::boolean, Shape{});
+    auto result_and = backend->create_tensor(element::boolean, shape_rt);
+    auto result_or = backend->create_tensor(element::boolean, shape_rt);
+
+    copy_data(b, vector<char>{1});
+    backend->call_with_validate(g, {result_and, result_or}, {a, b});
+    EXPECT_EQ((vector<char>{1, 0, 0}), read_vector<char>(result_and));
+    EXPECT_EQ((vector<char>{1, 1, 0}), read_vector<char>(result_or));
+
+    copy_data(b, vector<char>{0});
+    backend->call_with_validate(g, {result_and, result_or}, {a, b});
+    EXPECT_EQ((vector<char>{0, 0, 0}), read_vector<char>(result_and));
+    EXPECT_EQ((vector<char>{1, 1, 0}), read_vector<char>(result_or));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, reduce_non_native_function)
+{
+    // The reduction function (f(x:float32[],y:float32[]) = max(x,max(y,y))) is not a single op
+    // of both parameters, so it is called for each element
+    auto f_A = make_shared<op::Parameter>(element::f32, Shape{});
+    auto f_B = make_shared<op::Parameter>(element::f32, Shape{});
+    auto f = make_shared<Function>(
+        make_shared<op::Maximum>(f_A, make_shared<op::Maximum>(f_B, f_B)),
+        op::ParameterVector{f_A, f_B});
+
+    Shape shape_a{2, 2, 3};
+    auto g_A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto g_B = make_shared<op::Parameter>(element::f32, Shape{});
+    auto g = make_shared<Function>(
+        NodeVector{make_shared<op::Reduce>(g_A, g_B, f, AxisSet{2}),
+                   make_shared<op::Reduce>(g_A, g_B, f, AxisSet{0, 1, 2})},
+        op::ParameterVector{g_A, g_B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 9, 2, -4, -5, -6, 3, 12, 7, 8, 11, 0});
+    auto b = backend->create_tensor(element::f32, Shape{});
+    copy_data(b, vector<float>{-1});
+    auto result_rows = backend->create_tensor(element::f32, Shape{2, 2});
+    auto result_all = backend->create_tensor(element::f32, Shape{});
+
+    backend->call_with_validate(g, {result_rows, result_all}, {a, b});
+    EXPECT_EQ((vector<float>{9, -1, 12, 11}), read_vector<float>(result_rows));
+    EXPECT_EQ((vector<float>{12}), read_vector<float>(result_all));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, reshape_t2v_012)
 {
     Shape shape_a{2, 2, 3};
@@ -8967,3 +9175,115 @@ NGRAPH_TEST(${BACKEND_NAME}, argmax_trivial)
     backend->call_with_validate(f, {result}, {a});
     EXPECT_EQ((vector<int>{1, 3, 0}), read_vector<int>(result));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, quantize)
+{
+    Shape shape{8};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Quantize>(A, element::u8, 0.5f, 10),
+                                   op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    // Ties round to even, out of range values saturate
+    copy_data(a, vector<float>{-1.0f, 0.0f, 0.25f, 0.26f, 0.75f, 1.0f, 200.0f, -100.0f});
+    auto result = backend->create_tensor(element::u8, shape);
+
+    backend->call_with_validate(f, {result}, {a});
+    EXPECT_EQ((vector<uint8_t>{8, 10, 10, 11, 12, 12, 255, 0}), read_vector<uint8_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dequantize)
+{
+    Shape shape{5};
+    auto A = make_shared<op::Parameter>(element::i8, shape);
+    auto f = make_shared<Function>(make_shared<op::Dequantize>(A, element::f32, 0.25f, -1),
+                                   op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::i8, shape);
+    copy_data(a, vector<int8_t>{-128, -1, 0, 1, 127});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    backend->call_with_validate(f, {result}, {a});
+    EXPECT_EQ((vector<float>{-31.75f, 0.0f, 0.25f, 0.5f, 32.0f}), read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, quantized_convolution)
+{
+    Shape shape_a{1, 1, 3, 3};
+    Shape shape_b{1, 1, 2, 2};
+    Shape shape_r{1, 1, 2, 2};
+    auto A = make_shared<op::Parameter>(element::u8, shape_a);
+    auto B = make_shared<op::Parameter>(element::i8, shape_b);
+    auto conv = make_shared<op::QuantizedConvolution>(A,
+                                                      B,
+                                                      Strides{1, 1},
+                                                      Strides{1, 1},
+                                                      CoordinateDiff{0, 0},
+                                                      CoordinateDiff{0, 0},
+                                                      0.5f,
+                                                      0,
+                                                      0.5f,
+                                                      0,
+                                                      element::u8,
+                                                      1.0f,
+                                                      0);
+    auto f = make_shared<Function>(conv, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::u8, shape_a);
+    copy_data(a, vector<uint8_t>{0, 1, 2, 3, 4, 5, 6, 7, 8});
+    auto b = backend->create_tensor(element::i8, shape_b);
+    copy_data(b, vector<int8_t>{1, -1, 2, 0});
+    auto result = backend->create_tensor(element::u8, shape_r);
+
+    // Accumulators 5, 7, 11, 13 rescaled by 0.25
+    backend->call_with_validate(f, {result}, {a, b});
+    EXPECT_EQ((vector<uint8_t>{1, 2, 3, 3}), read_vector<uint8_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, quantized_convolution_bias_relu_zero_points)
+{
+    Shape shape_a{1, 1, 3, 3};
+    Shape shape_b{2, 1, 2, 2};
+    Shape shape_c{2};
+    Shape shape_r{1, 2, 2, 2};
+    auto A = make_shared<op::Parameter>(element::u8, shape_a);
+    auto B = make_shared<op::Parameter>(element::i8, shape_b);
+    auto C = make_shared<op::Parameter>(element::i32, shape_c);
+    auto conv = make_shared<op::QuantizedConvolution>(A,
+                                                      B,
+                                                      C,
+                                                      Strides{1, 1},
+                                                      Strides{1, 1},
+                                                      CoordinateDiff{0, 0},
+                                                      CoordinateDiff{0, 0},
+                                                      0.5f,
+                                                      2,
+                                                      0.25f,
+                                                      1,
+                                                      element::i8,
+                                                      0.5f,
+                                                      3,
+                                                      true);
+    auto f = make_shared<Function>(conv, op::ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::u8, shape_a);
+    copy_data(a, vector<uint8_t>{2, 3, 4, 5, 6, 7, 8, 9, 10});
+    auto b = backend->create_tensor(element::i8, shape_b);
+    copy_data(b, vector<int8_t>{1, 2, 3, 4, 0, -1, -2, -3});
+    auto c = backend->create_tensor(element::i32, shape_c);
+    copy_data(c, vector<int32_t>{4, -8});
+    auto result = backend->create_tensor(element::i8, shape_r);
+
+    // Channel 0 accumulates to 23, 29, 41, 47 and is rescaled by 0.25 and shifted by 3.
+    // Channel 1 is negative everywhere and clamps to the output zero point.
+    backend->call_with_validate(f, {result}, {a, b, c});
+    EXPECT_EQ((vector<int8_t>{9, 10, 13, 15, 3, 3, 3, 3}), read_vector<int8_t>(result));
+}
@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/batching_executor.hpp"
+#include "ngraph/runtime/bucketed_function.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Rows of A times a constant matrix, plus the matching rows of B
+static shared_ptr<Function> make_row_function()
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{1, 3});
+    auto W = op::Constant::create(element::f32, Shape{2, 3}, {1, 0, 1, 0, 1, 1});
+    return make_shared<Function>(make_shared<op::Dot>(A, W) + B, op::ParameterVector{A, B});
+}
+
+TEST(bucketed_function, batch_sizes)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BucketedFunction bf(backend, make_row_function());
+
+    for (size_t batch_size : {3, 1, 4, 5, 8, 2})
+    {
+        vector<float> a_data;
+        vector<float> b_data;
+        vector<float> expected;
+        for (size_t i = 0; i < batch_size; i++)
+        {
+            float x = static_cast<float>(i);
+            a_data.insert(a_data.end(), {x, 2 * x});
+            b_data.insert(b_data.end(), {1, 2, 3});
+            expected.insert(expected.end(), {x + 1, 2 * x + 2, 3 * x + 3});
+        }
+        auto a = backend->create_tensor(element::f32, Shape{batch_size, 2});
+        auto b = backend->create_tensor(element::f32, Shape{batch_size, 3});
+        auto result = backend->create_tensor(element::f32, Shape{batch_size, 3});
+        copy_data(a, a_data);
+        copy_data(b, b_data);
+        bf.call({result}, {a, b});
+        EXPECT_EQ(expected, read_vector<float>(result)) << "batch size " << batch_size;
+    }
+
+    EXPECT_EQ((vector<size_t>{1, 2, 4, 8}), bf.get_compiled_bucket_sizes());
+    EXPECT_EQ(16, runtime::BucketedFunction::get_bucket_size(9));
+}
+
+TEST(bucketed_function, batch_axis)
+{
+    // Batch along axis 1, padded from 3 to 4
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 1});
+    auto f = make_shared<Function>(A * A, op::ParameterVector{A});
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BucketedFunction bf(backend, f, 1);
+
+    auto a = backend->create_tensor(element::f32, Shape{2, 3});
+    auto result = backend->create_tensor(element::f32, Shape{2, 3});
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    bf.call({result}, {a});
+    EXPECT_EQ((vector<float>{1, 4, 9, 16, 25, 36}), read_vector<float>(result));
+
+    auto wrong = backend->create_tensor(element::f32, Shape{3, 3});
+    EXPECT_THROW(bf.call({result}, {wrong}), ngraph_error);
+}
+
+TEST(bucketed_function, batching_executor)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::BatchingExecutor executor(
+        backend, make_row_function(), 4, std::chrono::microseconds(1000));
+
+    const size_t request_count = 10;
+    vector<shared_ptr<runtime::TensorView>> results;
+    vector<future<void>> futures;
+    for (size_t i = 0; i < request_count; i++)
+    {
+        // Requests of one or two rows
+        size_t rows = 1 + i % 2;
+        float x = static_cast<float>(i);
+        auto a = backend->create_tensor(element::f32, Shape{rows, 2});
+        auto b = backend->create_tensor(element::f32, Shape{rows, 3});
+        auto result = backend->create_tensor(element::f32, Shape{rows, 3});
+        copy_data(a, vector<float>(rows * 2, x));
+        copy_data(b, vector<float>(rows * 3, 1));
+        futures.push_back(executor.submit({result}, {a, b}));
+        results.push_back(result);
+    }
+    for (size_t i = 0; i < request_count; i++)
+    {
+        futures[i].get();
+        float x = static_cast<float>(i);
+        vector<float> row{x + 1, x + 1, 2 * x + 1};
+        vector<float> expected = row;
+        if (i % 2)
+        {
+            expected.insert(expected.end(), row.begin(), row.end());
+        }
+        EXPECT_EQ(expected, read_vector<float>(results[i])) << "request " << i;
+    }
+
+    auto a = backend->create_tensor(element::f32, Shape{1, 3});
+    auto b = backend->create_tensor(element::f32, Shape{1, 3});
+    EXPECT_THROW(executor.submit({results[0]}, {a, b}), ngraph_error);
+}
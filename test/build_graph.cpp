@@ -132,3 +132,25 @@ TEST(build_graph, function_undeclared_parameters)
         FAIL() << "Function construction failed for unexpected reason";
     }
 }
+
+TEST(build_graph, ordered_ops_cache)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto add = A + B;
+    auto f = make_shared<Function>(make_shared<op::Negative>(add), op::ParameterVector{A, B});
+
+    auto ops = f->get_ordered_ops();
+    size_t hits = Function::get_ordered_ops_cache_hits();
+    EXPECT_EQ(ops, f->get_ordered_ops());
+    EXPECT_EQ(hits + 1, Function::get_ordered_ops_cache_hits());
+
+    // Replacing a node invalidates the cached order
+    auto multiply = A * B;
+    replace_node(add, multiply);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(ops.size(), 5);
+    EXPECT_EQ(count(ops.begin(), ops.end(), add), 0);
+    EXPECT_EQ(count(ops.begin(), ops.end(), multiply), 1);
+    EXPECT_EQ(hits + 1, Function::get_ordered_ops_cache_hits());
+}
@@ -99,3 +99,62 @@ TEST(constant_folding, constant_broadcast)
     vector<int> values_permute{0, 0, 0, 0, 1, 1, 1, 1};
     ASSERT_EQ(values_permute, values_out);
 }
+
+TEST(constant_folding, constant_broadcast_size_limit)
+{
+    // A broadcast scalar is larger than the limit once folded, the small one is folded
+    auto scalar = op::Constant::create(element::f32, Shape{}, {2});
+    auto large = make_shared<op::Broadcast>(scalar, Shape{8, 8}, AxisSet{0, 1});
+    auto small = make_shared<op::Broadcast>(scalar, Shape{4}, AxisSet{0});
+    auto f = make_shared<Function>(NodeVector{large, small}, op::ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(16 * sizeof(float));
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 1);
+    EXPECT_EQ(f->get_results().at(0)->get_argument(0), large);
+    auto new_const =
+        std::dynamic_pointer_cast<op::Constant>(f->get_results().at(1)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    EXPECT_EQ((vector<float>{2, 2, 2, 2}), new_const->get_vector<float>());
+}
+
+TEST(constant_folding, constant_subgraph)
+{
+    Shape shape{2, 2};
+
+    auto A = make_shared<op::Constant>(element::f32, shape, vector<float>{1, 2, 3, 4});
+    auto B = make_shared<op::Constant>(element::f32, shape, vector<float>{1, 0, 0, 2});
+    auto C = make_shared<op::Constant>(element::i32, Shape{2}, vector<int>{10, 20});
+    auto P = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+
+    // dot = {{1, 4}, {3, 8}}
+    auto dot = make_shared<op::Dot>(A, B);
+    // sum = {{2, 6}, {6, 12}}
+    auto sum = dot + A;
+    // reversed = {{4, 3}, {40, 9}}
+    auto reversed = make_shared<op::Reverse>(sum * B + A * A, AxisSet{1});
+    auto converted = make_shared<op::Reshape>(
+        make_shared<op::Convert>(C, element::f32), AxisVector{0}, Shape{2, 1});
+    auto pad_value = op::Constant::create(element::f32, Shape{}, {-1});
+    auto padded = make_shared<op::Pad>(converted, pad_value, Shape{0, 0}, Shape{0, 1}, Shape{0, 0});
+    // concat = {{4, 3, 10, -1}, {40, 9, 20, -1}}
+    auto concat = make_shared<op::Concat>(NodeVector{reversed, padded}, 1);
+    auto slice = make_shared<op::Slice>(concat, Coordinate{0, 0}, Coordinate{2, 4}, Strides{1, 2});
+    auto f = make_shared<Function>(make_shared<op::Concat>(NodeVector{slice, P}, 1),
+                                   op::ParameterVector{P});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    // Only the concatenation with the parameter is left
+    ASSERT_EQ(count_ops_of_type<op::Concat>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(f), 0);
+    auto folded = std::dynamic_pointer_cast<op::Constant>(
+        f->get_results().at(0)->get_argument(0)->get_argument(0));
+    ASSERT_TRUE(folded);
+    EXPECT_EQ((vector<float>{4, 10, 40, 20}), folded->get_vector<float>());
+}
@@ -138,3 +138,50 @@ TEST(core_fusion, sparsity_opt_56x56)
     ASSERT_EQ(t_eltwise_conv1->get_window_movement_strides(), stride_1);
     ASSERT_EQ(t_eltwise_conv2->get_window_movement_strides(), stride_1);
 }
+
+static shared_ptr<Function> make_dequantized_conv_graph(int32_t data_zero_point,
+                                                        int32_t filter_zero_point)
+{
+    auto data = make_shared<op::Parameter>(element::u8, Shape{1, 1, 3, 3});
+    auto filters = make_shared<op::Parameter>(element::i8, Shape{2, 1, 2, 2});
+    auto data_dq = make_shared<op::Dequantize>(data, element::f32, 0.5f, data_zero_point);
+    auto filters_dq =
+        make_shared<op::Dequantize>(filters, element::f32, 0.25f, filter_zero_point);
+    auto conv = make_shared<op::Convolution>(data_dq, filters_dq);
+    auto bias = op::Constant::create(element::f32, Shape{2}, {0.5f, -1.0f});
+    auto bias_bcast = make_shared<op::Broadcast>(bias, conv->get_shape(), AxisSet{0, 2, 3});
+    auto relu = make_shared<op::Relu>(conv + bias_bcast);
+    auto quantize = make_shared<op::Quantize>(relu, element::u8, 0.5f, 0);
+    return make_shared<Function>(quantize, op::ParameterVector{data, filters});
+}
+
+TEST(core_fusion, quantized_convolution_folding)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto run = [&](shared_ptr<Function> f) {
+        auto data = backend->create_tensor(element::u8, Shape{1, 1, 3, 3});
+        copy_data(data, vector<uint8_t>{2, 3, 4, 5, 6, 7, 8, 9, 10});
+        auto filters = backend->create_tensor(element::i8, Shape{2, 1, 2, 2});
+        copy_data(filters, vector<int8_t>{1, 2, 3, 4, 0, -1, -2, -3});
+        auto result = backend->create_tensor(element::u8, Shape{1, 2, 2, 2});
+        backend->call_with_validate(f, {result}, {data, filters});
+        return read_vector<uint8_t>(result);
+    };
+
+    auto reference = run(make_dequantized_conv_graph(2, 1));
+
+    auto f = make_dequantized_conv_graph(2, 1);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::QuantizedConvolution>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Convolution>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Dequantize>(f), 0);
+
+    auto qconv =
+        dynamic_pointer_cast<op::QuantizedConvolution>(f->get_results().at(0)->get_argument(0));
+    ASSERT_NE(qconv, nullptr);
+    EXPECT_TRUE(qconv->with_bias());
+    EXPECT_TRUE(qconv->with_relu());
+    EXPECT_EQ(reference, run(f));
+}
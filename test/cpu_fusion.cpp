@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <functional>
 #include <iostream>
 #include <list>
 #include <memory>
@@ -57,6 +58,7 @@
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_concat_inputs.hpp"
@@ -2140,6 +2142,66 @@ TEST(cpu_fusion, loop_kernel_fusion_one_group)
     }
 }
 
+static shared_ptr<Function> make_elementwise_mlp_layer()
+{
+    Shape shape_x{8, 32};
+    Shape shape_w{32, 16};
+    Shape shape_b{16};
+    auto x = make_shared<op::Parameter>(element::f32, shape_x);
+    auto w = make_shared<op::Parameter>(element::f32, shape_w);
+    auto b = make_shared<op::Parameter>(element::f32, shape_b);
+    auto scale = make_shared<op::Parameter>(element::f32, Shape{8, 16});
+    auto dot = make_shared<op::Dot>(x, w);
+    auto bias = make_shared<op::Broadcast>(b, dot->get_shape(), AxisSet{0});
+    auto scaled = (dot + bias) * scale;
+    auto gate = make_shared<op::Sigmoid>(scaled);
+    auto act = make_shared<op::Tanh>(scaled);
+    auto out = make_shared<op::Relu>((act * gate) / (scale * scale + bias));
+    return make_shared<Function>(NodeVector{out, act}, op::ParameterVector{x, w, b, scale});
+}
+
+TEST(cpu_fusion, loop_kernel_fusion_backend)
+{
+    test::Uniform<float> rng(0.5f, 1.5f);
+    vector<vector<float>> args;
+    for (auto param : make_elementwise_mlp_layer()->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(make_elementwise_mlp_layer(), args, "INTERPRETER");
+
+    // Loop kernels run as generated code and through direct execution
+    bool dex_set = (getenv("NGRAPH_DEX") != nullptr);
+    for (bool dex : {false, true})
+    {
+        if (dex)
+        {
+            setenv("NGRAPH_DEX", "1", 1);
+        }
+        else
+        {
+            unsetenv("NGRAPH_DEX");
+        }
+        auto cpu_f = make_elementwise_mlp_layer();
+        auto cpu_results = execute(cpu_f, args, "CPU");
+        EXPECT_GT(count_ops_of_type<runtime::cpu::op::LoopKernel>(cpu_f), 0);
+        for (size_t i = 0; i < cpu_results.size(); i++)
+        {
+            EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+        }
+    }
+    if (dex_set)
+    {
+        setenv("NGRAPH_DEX", "1", 1);
+    }
+    else
+    {
+        unsetenv("NGRAPH_DEX");
+    }
+}
+
 TEST(cpu_fusion, sigmoid_multiply_fusion)
 {
     pass::Manager pass_manager;
@@ -2685,6 +2747,177 @@ TEST(cpu_fusion, fuse_bounded_relu_inter_vs_cpu)
     check_bounded_relu(Shape{4, 3, 2}, 2.0f);
 }
 
+TEST(cpu_fusion, fold_constant_convert_layout)
+{
+    Shape shape_data{2, 4, 8, 8};
+    Shape shape_weights{16, 4, 3, 3};
+    auto make_function = [&shape_data, &shape_weights]() {
+        auto data = make_shared<op::Parameter>(element::f32, shape_data);
+        vector<float> weights(shape_size(shape_weights));
+        test::Uniform<float> rng(-1.0f, 1.0f, 0);
+        rng.initialize(weights);
+        auto conv = make_shared<op::Convolution>(
+            data,
+            op::Constant::create(element::f32, shape_weights, weights),
+            Strides{1, 1},
+            Strides{1, 1},
+            CoordinateDiff{1, 1},
+            CoordinateDiff{1, 1});
+        return make_shared<Function>(conv, op::ParameterVector{data});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+
+    // The weights are reordered into the convolution's layout at compile time
+    for (auto node : cpu_f->get_ordered_ops())
+    {
+        if (dynamic_pointer_cast<runtime::cpu::op::ConvertLayout>(node))
+        {
+            EXPECT_FALSE(node->get_argument(0)->is_constant());
+        }
+        if (dynamic_pointer_cast<op::Convolution>(node))
+        {
+            EXPECT_TRUE(node->get_argument(1)->is_constant());
+        }
+    }
+    EXPECT_EQ(1, count_ops_of_type<op::Convolution>(cpu_f));
+}
+
+static shared_ptr<Node> make_hyperparameter(float value, const Shape& shape)
+{
+    auto scalar = op::Constant::create(element::f32, Shape{}, {value});
+    AxisSet axes;
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        axes.insert(i);
+    }
+    return make_shared<op::Broadcast>(scalar, shape, axes);
+}
+
+static void compare_optimizer_update(const function<shared_ptr<Function>()>& make_function,
+                                     size_t sgd_count,
+                                     size_t momentum_count,
+                                     size_t adam_count)
+{
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(0.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+
+    EXPECT_EQ(sgd_count, count_ops_of_type<op::SGDUpdate>(cpu_f));
+    EXPECT_EQ(momentum_count, count_ops_of_type<op::MomentumUpdate>(cpu_f));
+    EXPECT_EQ(adam_count, count_ops_of_type<op::AdamUpdate>(cpu_f));
+    ASSERT_EQ(cpu_results.size(), int_results.size());
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_fusion, fuse_sgd_update)
+{
+    Shape shape{16, 8};
+    auto make_function = [&shape]() {
+        auto w = make_shared<op::Parameter>(element::f32, shape);
+        auto g = make_shared<op::Parameter>(element::f32, shape);
+        auto new_w = w - make_hyperparameter(0.1f, shape) * g;
+        return make_shared<Function>(NodeVector{new_w}, op::ParameterVector{w, g});
+    };
+    compare_optimizer_update(make_function, 1, 0, 0);
+}
+
+TEST(cpu_fusion, fuse_momentum_update)
+{
+    Shape shape{16, 8};
+    auto make_function = [&shape]() {
+        auto w = make_shared<op::Parameter>(element::f32, shape);
+        auto v = make_shared<op::Parameter>(element::f32, shape);
+        auto g = make_shared<op::Parameter>(element::f32, shape);
+        auto new_v = make_hyperparameter(0.9f, shape) * v + g;
+        auto new_w = w - make_hyperparameter(0.1f, shape) * new_v;
+        return make_shared<Function>(NodeVector{new_w, new_v}, op::ParameterVector{w, v, g});
+    };
+    compare_optimizer_update(make_function, 0, 1, 0);
+}
+
+TEST(cpu_fusion, fuse_adam_update)
+{
+    Shape shape{16, 8};
+    float beta1 = 0.9f;
+    float beta2 = 0.999f;
+    auto make_function = [&shape, beta1, beta2]() {
+        auto w = make_shared<op::Parameter>(element::f32, shape);
+        auto m = make_shared<op::Parameter>(element::f32, shape);
+        auto v = make_shared<op::Parameter>(element::f32, shape);
+        auto g = make_shared<op::Parameter>(element::f32, shape);
+        auto new_m = make_hyperparameter(beta1, shape) * m +
+                     make_hyperparameter(1.0f - beta1, shape) * g;
+        auto new_v = make_hyperparameter(beta2, shape) * v +
+                     make_hyperparameter(1.0f - beta2, shape) * (g * g);
+        auto step = make_hyperparameter(0.01f, shape) * new_m /
+                    (make_shared<op::Sqrt>(new_v) + make_hyperparameter(1e-8f, shape));
+        auto new_w = w - step;
+        return make_shared<Function>(NodeVector{new_w, new_m, new_v},
+                                     op::ParameterVector{w, m, v, g});
+    };
+    compare_optimizer_update(make_function, 0, 0, 1);
+}
+
+TEST(cpu_fusion, sgd_update_in_place)
+{
+    Shape shape{16, 8};
+    auto make_function = [&shape]() {
+        auto w = make_shared<op::Parameter>(element::f32, shape);
+        auto g = make_shared<op::Parameter>(element::f32, shape);
+        shared_ptr<Node> new_w = w;
+        for (size_t i = 0; i < 3; i++)
+        {
+            new_w = new_w - make_hyperparameter(0.1f, shape) * g;
+        }
+        return make_shared<Function>(NodeVector{new_w}, op::ParameterVector{w, g});
+    };
+    compare_optimizer_update(make_function, 3, 0, 0);
+
+    auto f = make_function();
+    auto backend = runtime::Backend::create("CPU");
+    backend->compile(f);
+    vector<shared_ptr<op::SGDUpdate>> updates;
+    for (auto node : f->get_ordered_ops())
+    {
+        if (auto update = dynamic_pointer_cast<op::SGDUpdate>(node))
+        {
+            updates.push_back(update);
+        }
+    }
+    ASSERT_EQ(updates.size(), 3);
+
+    // The weights parameter is left alone, the intermediate weights are updated in place
+    auto annotations = updates.at(0)->get_op_annotations();
+    EXPECT_TRUE(!annotations || annotations->get_in_place_oi_pairs().empty());
+    EXPECT_EQ(updates.at(1)->get_outputs().at(0).get_tensor().get_pool_offset(),
+              updates.at(0)->get_outputs().at(0).get_tensor().get_pool_offset());
+}
+
 TEST(cpu_fusion, dot_batch_forward)
 {
     const Shape shape_a{2, 3, 2};
@@ -2715,3 +2948,57 @@ TEST(cpu_fusion, dot_batch_forward)
         EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
     }
 }
+
+TEST(cpu_fusion, quantized_convolution_folding)
+{
+    Shape shape_data{2, 4, 5, 5};
+    Shape shape_filters{8, 4, 3, 3};
+
+    // Zero points are 0 and data is u8, so the folded convolution runs on the MKLDNN int8 kernel
+    auto generate_func = [&]() -> shared_ptr<Function> {
+        auto data = make_shared<op::Parameter>(element::u8, shape_data);
+        auto filters = make_shared<op::Parameter>(element::i8, shape_filters);
+        auto data_dq = make_shared<op::Dequantize>(data, element::f32, 0.5f, 0);
+        auto filters_dq = make_shared<op::Dequantize>(filters, element::f32, 0.25f, 0);
+        auto conv = make_shared<op::Convolution>(data_dq,
+                                                 filters_dq,
+                                                 Strides{1, 1},
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{1, 1},
+                                                 CoordinateDiff{1, 1});
+        auto bias = op::Constant::create(
+            element::f32, Shape{8}, {0.5f, -1.0f, 2.0f, -4.0f, 0.125f, 0.0f, -0.25f, 8.0f});
+        auto bias_bcast = make_shared<op::Broadcast>(bias, conv->get_shape(), AxisSet{0, 2, 3});
+        auto relu = make_shared<op::Relu>(conv + bias_bcast);
+        auto quantize = make_shared<op::Quantize>(relu, element::u8, 0.5f, 0);
+        return make_shared<Function>(quantize, op::ParameterVector{data, filters});
+    };
+
+    auto run = [&](shared_ptr<Function> f, const string& backend_name) {
+        auto backend = runtime::Backend::create(backend_name);
+        vector<uint8_t> data_val(shape_size(shape_data));
+        for (size_t i = 0; i < data_val.size(); i++)
+        {
+            data_val[i] = static_cast<uint8_t>(i % 17);
+        }
+        vector<int8_t> filters_val(shape_size(shape_filters));
+        for (size_t i = 0; i < filters_val.size(); i++)
+        {
+            filters_val[i] = static_cast<int8_t>(static_cast<int>(i % 11) - 5);
+        }
+        auto data = backend->create_tensor(element::u8, shape_data);
+        copy_data(data, data_val);
+        auto filters = backend->create_tensor(element::i8, shape_filters);
+        copy_data(filters, filters_val);
+        auto result = backend->create_tensor(element::u8, f->get_output_shape(0));
+        backend->call_with_validate(f, {result}, {data, filters});
+        return read_vector<uint8_t>(result);
+    };
+
+    auto int_func = generate_func();
+    auto cpu_func = generate_func();
+    auto int_results = run(int_func, "INTERPRETER");
+    auto cpu_results = run(cpu_func, "CPU");
+    ASSERT_EQ(count_ops_of_type<op::QuantizedConvolution>(cpu_func), 1);
+    EXPECT_EQ(int_results, cpu_results);
+}
@@ -16,9 +16,13 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <fstream>
+#include <functional>
 #include <iostream>
 #include <list>
+#include <map>
 #include <memory>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "ngraph/autodiff/adjoints.hpp"
@@ -31,11 +35,16 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_thread_pool.hpp"
+#include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
 #include "util/all_close.hpp"
+#include "util/all_close_f.hpp"
 #include "util/autodiff/backprop_function.hpp"
 #include "util/autodiff/numeric_compare.hpp"
 #include "util/ndarray.hpp"
@@ -191,3 +200,531 @@ TEST(cpu_test, mkldnn_layouts)
 
     EXPECT_EQ(vector<float>{expected_result}, rv);
 }
+
+// Calls f from several threads at once, each thread with its own arguments, and checks every
+// result. The function is compiled for direct execution if dex is set, else with codegen.
+static void check_concurrent_calls(shared_ptr<Function> f,
+                                   function<vector<vector<float>>(size_t)> make_args,
+                                   function<vector<float>(size_t)> make_expected,
+                                   bool dex,
+                                   size_t inter_op_parallelism = 1)
+{
+    // Allow several calls to execute on the same compiled function at once
+    bool concurrency_set = (getenv("NGRAPH_CPU_CONCURRENCY") != nullptr);
+    if (!concurrency_set)
+    {
+        setenv("NGRAPH_CPU_CONCURRENCY", "4", 1);
+    }
+    bool dex_set = (getenv("NGRAPH_DEX") != nullptr);
+    if (dex && !dex_set)
+    {
+        setenv("NGRAPH_DEX", "1", 1);
+    }
+
+    auto backend = runtime::Backend::create("CPU");
+    if (inter_op_parallelism > 1)
+    {
+        static_pointer_cast<runtime::cpu::CPU_Backend>(backend)->set_inter_op_parallelism(
+            inter_op_parallelism);
+    }
+    backend->compile(f);
+
+    const size_t num_threads = 4;
+    const size_t iterations = 100;
+    vector<thread> threads;
+    vector<int> correct(num_threads, 1);
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            vector<shared_ptr<runtime::TensorView>> args;
+            size_t param_index = 0;
+            for (auto& values : make_args(t))
+            {
+                auto& param = f->get_parameters().at(param_index++);
+                args.push_back(
+                    backend->create_tensor(param->get_element_type(), param->get_shape()));
+                copy_data(args.back(), values);
+            }
+            auto result = backend->create_tensor(element::f32, f->get_output_shape(0));
+            vector<float> expected = make_expected(t);
+            for (size_t i = 0; i < iterations; i++)
+            {
+                backend->call(f, {result}, args);
+                if (read_vector<float>(result) != expected)
+                {
+                    correct[t] = 0;
+                }
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        EXPECT_TRUE(correct[t]);
+    }
+
+    if (dex && !dex_set)
+    {
+        unsetenv("NGRAPH_DEX");
+    }
+    if (!concurrency_set)
+    {
+        unsetenv("NGRAPH_CPU_CONCURRENCY");
+    }
+}
+
+static void check_concurrent_elementwise_calls(bool dex)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * C, op::ParameterVector{A, B, C});
+
+    check_concurrent_calls(f,
+                           [](size_t t) {
+                               float x = static_cast<float>(t);
+                               return vector<vector<float>>{
+                                   {x, x, x, x}, {1, 2, 3, 4}, {2, 2, 2, 2}};
+                           },
+                           [](size_t t) {
+                               float x = static_cast<float>(t);
+                               return vector<float>{
+                                   2 * (x + 1), 2 * (x + 2), 2 * (x + 3), 2 * (x + 4)};
+                           },
+                           dex);
+}
+
+TEST(cpu_test, concurrent_calls)
+{
+    check_concurrent_elementwise_calls(false);
+}
+
+TEST(cpu_test, concurrent_calls_dex)
+{
+    // Each concurrent call runs on an executor state of its own
+    check_concurrent_elementwise_calls(true);
+}
+
+TEST(cpu_test, concurrent_reduce)
+{
+    // x - (-y) is not a single op, so it is reduced by calling the compiled reducer
+    auto X = make_shared<op::Parameter>(element::f32, Shape{});
+    auto Y = make_shared<op::Parameter>(element::f32, Shape{});
+    auto reducer =
+        make_shared<Function>(X - make_shared<op::Negative>(Y), op::ParameterVector{X, Y});
+
+    Shape shape{4, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto init = make_shared<op::Parameter>(element::f32, Shape{});
+    auto f = make_shared<Function>(make_shared<op::Reduce>(A, init, reducer, AxisSet{1}),
+                                   op::ParameterVector{A, init});
+
+    check_concurrent_calls(f,
+                           [](size_t t) {
+                               float x = static_cast<float>(t);
+                               return vector<vector<float>>{
+                                   {x, 1, 2, x, 3, 4, x, 5, 6, x, 7, 8}, {x}};
+                           },
+                           [](size_t t) {
+                               float x = static_cast<float>(t);
+                               return vector<float>{2 * x + 3, 2 * x + 7, 2 * x + 11, 2 * x + 15};
+                           },
+                           true);
+}
+
+TEST(cpu_test, concurrent_calls_inter_op)
+{
+    // Ops of all calls in flight share the ready queue of the backend's inter-op scheduler
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * C + (A - B) * C, op::ParameterVector{A, B, C});
+
+    check_concurrent_calls(f,
+                           [](size_t t) {
+                               float x = static_cast<float>(t);
+                               return vector<vector<float>>{
+                                   {x, x, x, x}, {1, 2, 3, 4}, {1, 2, 3, 4}};
+                           },
+                           [](size_t t) {
+                               float x = static_cast<float>(t);
+                               return vector<float>{2 * x, 4 * x, 6 * x, 8 * x};
+                           },
+                           true,
+                           4);
+}
+
+TEST(cpu_test, codegen_cache)
+{
+    if (getenv("NGRAPH_DEX") != nullptr)
+    {
+        // The cache only holds codegen output
+        return;
+    }
+
+    // Compiled functions are saved to the cache directory when codegen is used
+    string cache_dir = file_util::path_join(file_util::get_temp_directory_path(), "codegen_cache");
+    file_util::remove_directory(cache_dir);
+    setenv("NGRAPH_CPU_CODEGEN_CACHE_DIR", cache_dir.c_str(), 1);
+
+    // A hit needs identical generated source, so both compiles use the node names of one
+    // serialized graph
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    string js = serialize(make_shared<Function>(A * B, op::ParameterVector{A}));
+
+    auto call = [&](shared_ptr<Function> f) {
+        auto backend = runtime::Backend::create("CPU");
+        auto a = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{2, 2, 2, 2});
+        backend->call(f, {result}, {a});
+        EXPECT_EQ((vector<float>{2, 4, 6, 8}), read_vector<float>(result));
+    };
+
+    size_t hits = runtime::cpu::CPU_ExternalFunction::get_codegen_cache_hit_count();
+    call(deserialize(js));
+    EXPECT_EQ(hits, runtime::cpu::CPU_ExternalFunction::get_codegen_cache_hit_count());
+
+    // Every cached object is stored with the source it was compiled from
+    size_t objects = 0;
+    file_util::iterate_files(cache_dir,
+                             [&objects](const string& file, bool is_dir) {
+                                 if (!is_dir && file.size() > 2 &&
+                                     file.compare(file.size() - 2, 2, ".o") == 0)
+                                 {
+                                     objects++;
+                                     string source = file.substr(0, file.size() - 2) + ".cpp";
+                                     EXPECT_TRUE(file_util::exists(source));
+                                 }
+                             },
+                             false);
+    EXPECT_GE(objects, 1);
+
+    // A second backend loads the cached object instead of compiling again
+    call(deserialize(js));
+    EXPECT_EQ(hits + 1, runtime::cpu::CPU_ExternalFunction::get_codegen_cache_hit_count());
+
+    unsetenv("NGRAPH_CPU_CODEGEN_CACHE_DIR");
+    file_util::remove_directory(cache_dir);
+}
+
+// Small batch 1 CNN in which most ops run as MKLDNN primitives
+static shared_ptr<Function> make_small_cnn()
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{1, 8, 16, 16});
+    auto W1 = make_shared<op::Parameter>(element::f32, Shape{16, 8, 3, 3});
+    auto W2 = make_shared<op::Parameter>(element::f32, Shape{16, 16, 3, 3});
+    shared_ptr<Node> x = A;
+    x = make_shared<op::Relu>(make_shared<op::Convolution>(x, W1));
+    x = make_shared<op::MaxPool>(x, Shape{2, 2}, Strides{1, 1});
+    x = make_shared<op::Relu>(make_shared<op::Convolution>(x, W2));
+    // Not run by MKLDNN
+    x = make_shared<op::Tanh>(x);
+    x = make_shared<op::Relu>(make_shared<op::Convolution>(x, W2));
+    x = make_shared<op::AvgPool>(x, Shape{2, 2});
+    return make_shared<Function>(x, op::ParameterVector{A, W1, W2});
+}
+
+static vector<float> call_small_cnn(runtime::Backend* backend,
+                                    shared_ptr<Function> f,
+                                    size_t iterations,
+                                    stopwatch* timer = nullptr)
+{
+    test::Uniform<float> rng(-1.0f, 1.0f, 0);
+    vector<shared_ptr<runtime::TensorView>> args;
+    for (auto param : f->get_parameters())
+    {
+        auto arg = backend->create_tensor(element::f32, param->get_shape());
+        rng.initialize(arg);
+        args.push_back(arg);
+    }
+    auto result = backend->create_tensor(element::f32, f->get_output_shape(0));
+    // The first call compiles the function
+    backend->call(f, {result}, args);
+    if (timer)
+    {
+        timer->start();
+    }
+    for (size_t i = 0; i < iterations; i++)
+    {
+        backend->call(f, {result}, args);
+    }
+    if (timer)
+    {
+        timer->stop();
+    }
+    return read_vector<float>(result);
+}
+
+TEST(cpu_test, memory_strategy_constant_subgraph)
+{
+    // -C only depends on a constant, so it is computed once and reused on later calls unless
+    // its buffer may be handed to a later intermediate
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto X = make_shared<op::Negative>(C) * A;
+    auto Y = X + A;
+    auto f = make_shared<Function>(Y * A, op::ParameterVector{A});
+
+    bool strategy_set = (getenv("NGRAPH_CPU_MEMORY_STRATEGY") != nullptr);
+    bool dex_set = (getenv("NGRAPH_DEX") != nullptr);
+    for (auto strategy : {"first_fit", "best_fit", "greedy_by_size"})
+    {
+        for (bool dex : {false, true})
+        {
+            setenv("NGRAPH_CPU_MEMORY_STRATEGY", strategy, 1);
+            if (dex && !dex_set)
+            {
+                setenv("NGRAPH_DEX", "1", 1);
+            }
+
+            auto backend = runtime::Backend::create("CPU");
+            auto a = backend->create_tensor(element::f32, shape);
+            auto result = backend->create_tensor(element::f32, shape);
+
+            copy_data(a, vector<float>{1, 2, 3, 4});
+            backend->call(f, {result}, {a});
+            EXPECT_EQ((vector<float>{0, -4, -18, -48}), read_vector<float>(result))
+                << strategy;
+
+            copy_data(a, vector<float>{2, 3, 4, 5});
+            backend->call(f, {result}, {a});
+            EXPECT_EQ((vector<float>{0, -9, -32, -75}), read_vector<float>(result))
+                << strategy;
+
+            backend->call(f, {result}, {a});
+            EXPECT_EQ((vector<float>{0, -9, -32, -75}), read_vector<float>(result))
+                << strategy;
+
+            if (dex && !dex_set)
+            {
+                unsetenv("NGRAPH_DEX");
+            }
+        }
+    }
+    if (!strategy_set)
+    {
+        unsetenv("NGRAPH_CPU_MEMORY_STRATEGY");
+    }
+}
+
+TEST(cpu_test, tracer_capture)
+{
+    Shape shape{2, 3, 4, 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Relu>(A + B) * B, op::ParameterVector{A, B});
+    string trace_file =
+        file_util::path_join(file_util::get_temp_directory_path(), "cpu_trace.json");
+
+    bool dex_set = (getenv("NGRAPH_DEX") != nullptr);
+    for (bool dex : {false, true})
+    {
+        if (dex && !dex_set)
+        {
+            setenv("NGRAPH_DEX", "1", 1);
+        }
+
+        auto backend = runtime::Backend::create("CPU");
+        backend->compile(f);
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(shape_size(shape), 1));
+        copy_data(b, vector<float>(shape_size(shape), 2));
+
+        // Traced calls run MKLDNN primitives as their ops execute, so every op that ran is
+        // recorded once whether or not primitives are batched otherwise
+        runtime::cpu::Tracer::get().start(trace_file);
+        backend->call(f, {result}, {a, b});
+        runtime::cpu::Tracer::get().stop();
+        EXPECT_EQ(vector<float>(shape_size(shape), 6), read_vector<float>(result));
+
+        size_t op_count = 0;
+        for (auto node : f->get_ordered_ops())
+        {
+            op_count += !node->is_parameter() && !node->is_constant();
+        }
+        ifstream trace(trace_file);
+        auto events = nlohmann::json::parse(trace);
+        map<string, size_t> events_per_op;
+        for (auto& event : events)
+        {
+            EXPECT_EQ(f->get_name(), event["args"]["Function"].get<string>());
+            events_per_op[event["args"]["Output1"].get<string>()]++;
+        }
+        EXPECT_EQ(op_count, events.size()) << (dex ? "direct execution" : "codegen");
+        EXPECT_EQ(op_count, events_per_op.size()) << (dex ? "direct execution" : "codegen");
+
+        if (dex && !dex_set)
+        {
+            unsetenv("NGRAPH_DEX");
+        }
+    }
+    file_util::remove_file(trace_file);
+}
+
+TEST(cpu_test, mkldnn_batching)
+{
+    auto backend = runtime::Backend::create("CPU");
+    auto batched = call_small_cnn(backend.get(), make_small_cnn(), 2);
+    setenv("NGRAPH_CPU_DISABLE_MKLDNN_BATCHING", "1", 1);
+    auto unbatched = call_small_cnn(backend.get(), make_small_cnn(), 2);
+    unsetenv("NGRAPH_CPU_DISABLE_MKLDNN_BATCHING");
+    EXPECT_TRUE(test::all_close_f(unbatched, batched));
+}
+
+TEST(benchmark, cpu_mkldnn_batching)
+{
+    const size_t iterations = 1000;
+    auto backend = runtime::Backend::create("CPU");
+    stopwatch batched;
+    call_small_cnn(backend.get(), make_small_cnn(), iterations, &batched);
+    setenv("NGRAPH_CPU_DISABLE_MKLDNN_BATCHING", "1", 1);
+    stopwatch unbatched;
+    call_small_cnn(backend.get(), make_small_cnn(), iterations, &unbatched);
+    unsetenv("NGRAPH_CPU_DISABLE_MKLDNN_BATCHING");
+    cout << "small CNN latency " << batched.get_microseconds() / iterations
+         << "us with batched MKLDNN primitives, " << unbatched.get_microseconds() / iterations
+         << "us without\n";
+}
+
+// Independent branches of different depth joined at the end, so the order in which ready ops
+// are picked matters
+static shared_ptr<Function> make_branchy_function(size_t branches, size_t size)
+{
+    Shape shape{size, size};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> sum;
+    for (size_t i = 0; i < branches; i++)
+    {
+        shared_ptr<Node> x = A;
+        for (size_t j = 0; j <= i; j++)
+        {
+            x = make_shared<op::Tanh>(make_shared<op::Dot>(x, B));
+        }
+        sum = sum ? sum + x : x;
+    }
+    return make_shared<Function>(sum, op::ParameterVector{A, B});
+}
+
+static vector<float> call_branchy_function(shared_ptr<runtime::Backend> backend,
+                                           size_t inter_op_parallelism,
+                                           size_t iterations,
+                                           stopwatch* timer = nullptr)
+{
+    // The inter-op scheduler only drives direct execution
+    bool dex_set = (getenv("NGRAPH_DEX") != nullptr);
+    if (!dex_set)
+    {
+        setenv("NGRAPH_DEX", "1", 1);
+    }
+
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    cpu_backend->set_inter_op_parallelism(inter_op_parallelism);
+    auto f = make_branchy_function(6, 64);
+    test::Uniform<float> rng(-0.1f, 0.1f, 0);
+    vector<shared_ptr<runtime::TensorView>> args;
+    for (auto param : f->get_parameters())
+    {
+        auto arg = backend->create_tensor(element::f32, param->get_shape());
+        rng.initialize(arg);
+        args.push_back(arg);
+    }
+    auto result = backend->create_tensor(element::f32, f->get_output_shape(0));
+    backend->call(f, {result}, args);
+    if (timer)
+    {
+        timer->start();
+    }
+    for (size_t i = 0; i < iterations; i++)
+    {
+        backend->call(f, {result}, args);
+    }
+    if (timer)
+    {
+        timer->stop();
+    }
+
+    if (!dex_set)
+    {
+        unsetenv("NGRAPH_DEX");
+    }
+    return read_vector<float>(result);
+}
+
+TEST(cpu_test, inter_op_parallelism)
+{
+    auto parallel_backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(parallel_backend);
+    cpu_backend->set_inter_op_parallelism(4);
+    if (cpu_backend->get_inter_op_parallelism() < 2)
+    {
+        // Parallelism is capped so that inter-op threads times intra-op threads fit the CPUs
+        cout << "Skipping inter_op_parallelism: no CPUs for a second inter-op thread\n";
+        return;
+    }
+
+    auto sequential = call_branchy_function(runtime::Backend::create("CPU"), 1, 2);
+    // Later calls are scheduled with measured op times
+    auto parallel = call_branchy_function(parallel_backend, 4, 2);
+    EXPECT_GT(cpu_backend->get_inter_op_parallelism(), 1);
+    EXPECT_TRUE(test::all_close_f(sequential, parallel));
+
+    auto backend = runtime::Backend::create("CPU");
+    auto f = make_branchy_function(2, 4);
+    backend->compile(f);
+    EXPECT_ANY_THROW(static_pointer_cast<runtime::cpu::CPU_Backend>(backend)
+                         ->set_inter_op_parallelism(2));
+}
+
+TEST(cpu_test, thread_pool)
+{
+    auto shared = call_branchy_function(runtime::Backend::create("CPU"), 1, 2);
+
+    // Two backends in one process, each with a pool of its own
+    auto first = runtime::Backend::create("CPU");
+    auto second = runtime::Backend::create("CPU");
+    auto node_cpus = runtime::cpu::CPU_ThreadPool::get_numa_node_cpus(0);
+    auto first_pool = node_cpus.empty() ? make_shared<runtime::cpu::CPU_ThreadPool>(2)
+                                        : runtime::cpu::CPU_ThreadPool::create_for_numa_node(0);
+    auto second_pool = make_shared<runtime::cpu::CPU_ThreadPool>(2);
+    static_pointer_cast<runtime::cpu::CPU_Backend>(first)->set_thread_pool(first_pool);
+    static_pointer_cast<runtime::cpu::CPU_Backend>(second)->set_thread_pool(second_pool);
+    auto first_result = call_branchy_function(first, 2, 2);
+    EXPECT_GT(first_pool->get_scope_count(), 0);
+    EXPECT_EQ(second_pool->get_scope_count(), 0);
+    auto second_result = call_branchy_function(second, 1, 2);
+    // One scope per call on the calling thread
+    EXPECT_EQ(second_pool->get_scope_count(), 3);
+    EXPECT_TRUE(test::all_close_f(shared, first_result));
+    EXPECT_TRUE(test::all_close_f(shared, second_result));
+
+    auto f = make_branchy_function(2, 4);
+    first->compile(f);
+    EXPECT_ANY_THROW(static_pointer_cast<runtime::cpu::CPU_Backend>(first)->set_thread_pool(
+        make_shared<runtime::cpu::CPU_ThreadPool>(1)));
+}
+
+TEST(benchmark, cpu_inter_op_parallelism)
+{
+    const size_t iterations = 200;
+    stopwatch sequential;
+    call_branchy_function(runtime::Backend::create("CPU"), 1, iterations, &sequential);
+    auto backend = runtime::Backend::create("CPU");
+    stopwatch parallel;
+    call_branchy_function(backend, 4, iterations, &parallel);
+    cout << "branchy function latency " << sequential.get_microseconds() / iterations
+         << "us sequential, " << parallel.get_microseconds() / iterations << "us on "
+         << static_pointer_cast<runtime::cpu::CPU_Backend>(backend)->get_inter_op_parallelism()
+         << " inter-op threads\n";
+}
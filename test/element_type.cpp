@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
 #include <map>
 
 #include "gtest/gtest.h"
@@ -26,6 +27,8 @@ TEST(element_type, from)
 {
     EXPECT_EQ(element::from<char>(), element::boolean);
     EXPECT_EQ(element::from<bool>(), element::boolean);
+    EXPECT_EQ(element::from<bfloat16>(), element::bf16);
+    EXPECT_EQ(element::from<float16>(), element::f16);
     EXPECT_EQ(element::from<float>(), element::f32);
     EXPECT_EQ(element::from<double>(), element::f64);
     EXPECT_EQ(element::from<int8_t>(), element::i8);
@@ -43,6 +46,52 @@ TEST(element_type, mapable)
     std::map<element::Type, std::string> test_map;
 
     test_map.insert({element::f32, "float"});
+
+    // bf16 and f16 have the same bitwidth and flags, so only their names tell them apart
+    test_map.insert({element::bf16, "bfloat16"});
+    test_map.insert({element::f16, "float16"});
+    EXPECT_EQ(3, test_map.size());
+    EXPECT_EQ("bfloat16", test_map.at(element::bf16));
+    EXPECT_EQ("float16", test_map.at(element::f16));
+}
+
+TEST(element_type, bfloat16_round_to_nearest_even)
+{
+    EXPECT_EQ(0x3F80, bfloat16(1.0f).to_bits());
+    EXPECT_EQ(0.333984375f, static_cast<float>(bfloat16(1.0f / 3)));
+    // 257 and 259 are ties between representable neighbours and round to the even mantissa
+    EXPECT_EQ(256.0f, static_cast<float>(bfloat16(257.0f)));
+    EXPECT_EQ(260.0f, static_cast<float>(bfloat16(259.0f)));
+    EXPECT_TRUE(std::isinf(static_cast<float>(bfloat16(INFINITY))));
+    EXPECT_TRUE(std::isnan(static_cast<float>(bfloat16(NAN))));
+    for (uint32_t bits = 0; bits < 0x10000; bits++)
+    {
+        bfloat16 value = bfloat16::from_bits(bits);
+        if (!std::isnan(static_cast<float>(value)))
+        {
+            EXPECT_EQ(bits, bfloat16(static_cast<float>(value)).to_bits());
+        }
+    }
+}
+
+TEST(element_type, float16_round_to_nearest_even)
+{
+    EXPECT_EQ(0x3C00, float16(1.0f).to_bits());
+    EXPECT_EQ(0.333251953125f, static_cast<float>(float16(1.0f / 3)));
+    EXPECT_EQ(65504.0f, static_cast<float>(float16(65519.0f)));
+    EXPECT_TRUE(std::isinf(static_cast<float>(float16(65520.0f))));
+    // Smallest subnormal, and half of it which ties to zero
+    EXPECT_EQ(0x0001, float16(5.9604644775390625e-8f).to_bits());
+    EXPECT_EQ(0x0000, float16(2.98023223876953125e-8f).to_bits());
+    EXPECT_TRUE(std::isnan(static_cast<float>(float16(NAN))));
+    for (uint32_t bits = 0; bits < 0x10000; bits++)
+    {
+        float16 value = float16::from_bits(bits);
+        if (!std::isnan(static_cast<float>(value)))
+        {
+            EXPECT_EQ(bits, float16(static_cast<float>(value)).to_bits());
+        }
+    }
 }
 
 TEST(element_type, size)
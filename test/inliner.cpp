@@ -81,3 +81,28 @@ TEST(inline, recursive)
     ASSERT_EQ(count_ops_of_type<op::FunctionCall>(e), 0);
     ASSERT_LT(bce, ace); //we should get more ops after inlining
 }
+
+TEST(inline, multiple_results)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(NodeVector{A + B, A * B}, op::ParameterVector{A, B});
+
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    auto Y = make_shared<op::Parameter>(element::f32, shape);
+    auto fc = make_shared<op::FunctionCall>(f, NodeVector{X, Y});
+    auto sum = make_shared<op::GetOutputElement>(fc, 0);
+    auto product = make_shared<op::GetOutputElement>(fc, 1);
+    auto g = make_shared<Function>(sum - product, op::ParameterVector{X, Y});
+
+    auto ih = std::make_shared<ngraph::pass::InlineSmallCalls>(10, 1);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Inliner>(ih);
+    pass_manager.run_passes(g);
+    ASSERT_EQ(count_ops_of_type<op::FunctionCall>(g), 0);
+    ASSERT_EQ(count_ops_of_type<op::GetOutputElement>(g), 0);
+    ASSERT_EQ(count_ops_of_type<op::Result>(g), 1); //callee results are not copied in
+    ASSERT_EQ(count_ops_of_type<op::Add>(g), 1);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(g), 1);
+}
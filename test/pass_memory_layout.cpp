@@ -1,238 +1,341 @@
-/*******************************************************************************
-* Copyright 2017-2018 Intel Corporation
-*
-* Licensed under the Apache License, Version 2.0 (the "License");
-* you may not use this file except in compliance with the License.
-* You may obtain a copy of the License at
-*
-*     http://www.apache.org/licenses/LICENSE-2.0
-*
-* Unless required by applicable law or agreed to in writing, software
-* distributed under the License is distributed on an "AS IS" BASIS,
-* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-* See the License for the specific language governing permissions and
-* limitations under the License.
-*******************************************************************************/
-
-#include <memory>
-#include <sstream>
-#include <string>
-#include <vector>
-
-#include "gtest/gtest.h"
-
-#include "ngraph/ngraph.hpp"
-#include "ngraph/pass/dump_sorted.hpp"
-#include "ngraph/pass/liveness.hpp"
-#include "ngraph/pass/liveness.hpp"
-#include "ngraph/pass/manager.hpp"
-#include "ngraph/pass/memory_layout.hpp"
-#include "ngraph/pass/visualize_tree.hpp"
-#include "util/test_tools.hpp"
-
-using namespace ngraph;
-using namespace std;
-
-static vector<pass::MemoryManager::node> get_node_list(const pass::MemoryManager& mm)
-{
-    vector<pass::MemoryManager::node> rc;
-    rc.insert(rc.end(), mm.begin(), mm.end());
-    return rc;
-}
-
-TEST(memory_manager, allocate)
-{
-    pass::MemoryManager mm{1};
-
-    // Special case, allocating size zero bumps the size of the alloc up to the alignment size
-    EXPECT_EQ(0, mm.allocate(0));
-    EXPECT_EQ(1, mm.allocate(10));
-    EXPECT_EQ(11, mm.allocate(10));
-    EXPECT_EQ(21, mm.allocate(10));
-}
-
-TEST(memory_manager, free_first_allocated)
-{
-    pass::MemoryManager mm{1};
-
-    EXPECT_EQ(0, mm.allocate(10));
-    EXPECT_EQ(10, mm.allocate(10));
-    EXPECT_EQ(3, mm.get_node_list().size());
-
-    mm.free(0);
-
-    auto node_list = get_node_list(mm);
-    EXPECT_EQ(3, node_list.size());
-    EXPECT_TRUE(node_list[0].is_free());
-    EXPECT_FALSE(node_list[1].is_free());
-    EXPECT_TRUE(node_list[2].is_free());
-}
-
-TEST(memory_manager, free_middle_allocated)
-{
-    pass::MemoryManager mm{1};
-
-    EXPECT_EQ(0, mm.allocate(10));
-    EXPECT_EQ(10, mm.allocate(10));
-    EXPECT_EQ(20, mm.allocate(10));
-    EXPECT_EQ(30, mm.allocate(10));
-    EXPECT_EQ(40, mm.allocate(10));
-    EXPECT_EQ(6, mm.get_node_list().size());
-
-    mm.free(10);
-
-    auto node_list = get_node_list(mm);
-    EXPECT_EQ(6, node_list.size());
-    EXPECT_FALSE(node_list[0].is_free());
-    EXPECT_TRUE(node_list[1].is_free());
-    EXPECT_FALSE(node_list[2].is_free());
-    EXPECT_FALSE(node_list[3].is_free());
-    EXPECT_FALSE(node_list[4].is_free());
-}
-
-TEST(memory_manager, free_last_allocated)
-{
-    pass::MemoryManager mm{1};
-
-    EXPECT_EQ(0, mm.allocate(10));
-    EXPECT_EQ(10, mm.allocate(10));
-    EXPECT_EQ(20, mm.allocate(10));
-    EXPECT_EQ(30, mm.allocate(10));
-    EXPECT_EQ(40, mm.allocate(10));
-    EXPECT_EQ(6, mm.get_node_list().size());
-
-    mm.free(40);
-
-    auto node_list = get_node_list(mm);
-    EXPECT_EQ(5, node_list.size());
-    EXPECT_FALSE(node_list[0].is_free());
-    EXPECT_FALSE(node_list[1].is_free());
-    EXPECT_FALSE(node_list[2].is_free());
-    EXPECT_FALSE(node_list[3].is_free());
-    EXPECT_TRUE(node_list[4].is_free());
-}
-
-TEST(memory_manager, free_first_free)
-{
-    pass::MemoryManager mm{1};
-
-    EXPECT_EQ(0, mm.allocate(10));
-    EXPECT_EQ(10, mm.allocate(10));
-    EXPECT_EQ(20, mm.allocate(10));
-    EXPECT_EQ(30, mm.allocate(10));
-    EXPECT_EQ(40, mm.allocate(10));
-    EXPECT_EQ(6, mm.get_node_list().size());
-
-    mm.free(10);
-    mm.free(0);
-
-    auto node_list = get_node_list(mm);
-    EXPECT_EQ(5, node_list.size());
-    EXPECT_TRUE(node_list[0].is_free());
-    EXPECT_FALSE(node_list[1].is_free());
-    EXPECT_FALSE(node_list[2].is_free());
-    EXPECT_FALSE(node_list[3].is_free());
-}
-
-TEST(memory_manager, free_middle_free)
-{
-    pass::MemoryManager mm{1};
-
-    EXPECT_EQ(0, mm.allocate(10));
-    EXPECT_EQ(10, mm.allocate(10));
-    EXPECT_EQ(20, mm.allocate(10));
-    EXPECT_EQ(30, mm.allocate(10));
-    EXPECT_EQ(40, mm.allocate(10));
-    EXPECT_EQ(6, mm.get_node_list().size());
-
-    mm.free(0);
-    mm.free(20);
-    mm.free(10);
-
-    auto node_list = get_node_list(mm);
-    EXPECT_EQ(4, node_list.size());
-    EXPECT_TRUE(node_list[0].is_free());
-    EXPECT_FALSE(node_list[1].is_free());
-    EXPECT_FALSE(node_list[2].is_free());
-}
-
-TEST(memory_manager, max_allocated)
-{
-    pass::MemoryManager mm{1};
-
-    EXPECT_EQ(0, mm.allocate(10));
-    EXPECT_EQ(10, mm.allocate(10));
-    EXPECT_EQ(20, mm.allocate(10));
-    EXPECT_EQ(30, mm.allocate(10));
-    EXPECT_EQ(40, mm.allocate(10));
-    EXPECT_EQ(6, mm.get_node_list().size());
-
-    mm.free(0);
-    mm.free(20);
-    mm.free(10);
-
-    EXPECT_EQ(mm.max_allocated(), 50);
-}
-
-TEST(memory_manager, bad_free)
-{
-    pass::MemoryManager mm{1};
-
-    EXPECT_THROW(mm.free(10), std::runtime_error);
-}
-
-TEST(memory_manager, align)
-{
-    EXPECT_EQ(8, pass::MemoryManager::align(0, 8));
-    EXPECT_EQ(8, pass::MemoryManager::align(1, 8));
-    EXPECT_EQ(8, pass::MemoryManager::align(2, 8));
-    EXPECT_EQ(8, pass::MemoryManager::align(3, 8));
-    EXPECT_EQ(8, pass::MemoryManager::align(4, 8));
-    EXPECT_EQ(8, pass::MemoryManager::align(5, 8));
-    EXPECT_EQ(8, pass::MemoryManager::align(6, 8));
-    EXPECT_EQ(8, pass::MemoryManager::align(7, 8));
-    EXPECT_EQ(8, pass::MemoryManager::align(8, 8));
-    EXPECT_EQ(16, pass::MemoryManager::align(9, 8));
-}
-
-TEST(memory_manager, memory_align)
-{
-    pass::MemoryManager mm{64};
-
-    EXPECT_EQ(0, mm.allocate(4));
-    EXPECT_EQ(64, mm.allocate(4));
-    EXPECT_EQ(128, mm.allocate(4));
-}
-
-TEST(memory_layout, basic)
-{
-    string dump_file = "memory_layout.txt";
-    pass::Manager pass_manager;
-    pass_manager.register_pass<pass::Liveness>();
-    pass_manager.register_pass<pass::MemoryLayout>();
-    pass_manager.register_pass<pass::DumpSorted>(dump_file);
-
-    auto graph = make_test_graph();
-    pass_manager.run_passes(graph);
-    auto sorted = graph->get_ordered_ops();
-    size_t temporary_pool_size = graph->get_temporary_pool_size();
-    EXPECT_EQ(12, temporary_pool_size);
-}
-
-TEST(memory_layout, constant)
-{
-    string dump_file = "constant.txt";
-    pass::Manager pass_manager;
-    pass_manager.register_pass<pass::Liveness>();
-    pass_manager.register_pass<pass::MemoryLayout>();
-    pass_manager.register_pass<pass::DumpSorted>(dump_file);
-
-    Shape shape{1};
-    auto c = op::Constant::create(element::i32, shape, {5});
-    auto f = make_shared<Function>(make_shared<op::Negative>(c), op::ParameterVector{});
-
-    pass_manager.run_passes(f);
-    auto sorted = f->get_ordered_ops();
-    size_t temporary_pool_size = f->get_temporary_pool_size();
-    EXPECT_EQ(4, temporary_pool_size);
-}
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/dump_sorted.hpp"
+#include "ngraph/pass/liveness.hpp"
+#include "ngraph/pass/liveness.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/visualize_tree.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static vector<pass::MemoryManager::node> get_node_list(const pass::MemoryManager& mm)
+{
+    vector<pass::MemoryManager::node> rc;
+    rc.insert(rc.end(), mm.begin(), mm.end());
+    return rc;
+}
+
+TEST(memory_manager, allocate)
+{
+    pass::MemoryManager mm{1};
+
+    // Special case, allocating size zero bumps the size of the alloc up to the alignment size
+    EXPECT_EQ(0, mm.allocate(0));
+    EXPECT_EQ(1, mm.allocate(10));
+    EXPECT_EQ(11, mm.allocate(10));
+    EXPECT_EQ(21, mm.allocate(10));
+}
+
+TEST(memory_manager, free_first_allocated)
+{
+    pass::MemoryManager mm{1};
+
+    EXPECT_EQ(0, mm.allocate(10));
+    EXPECT_EQ(10, mm.allocate(10));
+    EXPECT_EQ(3, mm.get_node_list().size());
+
+    mm.free(0);
+
+    auto node_list = get_node_list(mm);
+    EXPECT_EQ(3, node_list.size());
+    EXPECT_TRUE(node_list[0].is_free());
+    EXPECT_FALSE(node_list[1].is_free());
+    EXPECT_TRUE(node_list[2].is_free());
+}
+
+TEST(memory_manager, free_middle_allocated)
+{
+    pass::MemoryManager mm{1};
+
+    EXPECT_EQ(0, mm.allocate(10));
+    EXPECT_EQ(10, mm.allocate(10));
+    EXPECT_EQ(20, mm.allocate(10));
+    EXPECT_EQ(30, mm.allocate(10));
+    EXPECT_EQ(40, mm.allocate(10));
+    EXPECT_EQ(6, mm.get_node_list().size());
+
+    mm.free(10);
+
+    auto node_list = get_node_list(mm);
+    EXPECT_EQ(6, node_list.size());
+    EXPECT_FALSE(node_list[0].is_free());
+    EXPECT_TRUE(node_list[1].is_free());
+    EXPECT_FALSE(node_list[2].is_free());
+    EXPECT_FALSE(node_list[3].is_free());
+    EXPECT_FALSE(node_list[4].is_free());
+}
+
+TEST(memory_manager, free_last_allocated)
+{
+    pass::MemoryManager mm{1};
+
+    EXPECT_EQ(0, mm.allocate(10));
+    EXPECT_EQ(10, mm.allocate(10));
+    EXPECT_EQ(20, mm.allocate(10));
+    EXPECT_EQ(30, mm.allocate(10));
+    EXPECT_EQ(40, mm.allocate(10));
+    EXPECT_EQ(6, mm.get_node_list().size());
+
+    mm.free(40);
+
+    auto node_list = get_node_list(mm);
+    EXPECT_EQ(5, node_list.size());
+    EXPECT_FALSE(node_list[0].is_free());
+    EXPECT_FALSE(node_list[1].is_free());
+    EXPECT_FALSE(node_list[2].is_free());
+    EXPECT_FALSE(node_list[3].is_free());
+    EXPECT_TRUE(node_list[4].is_free());
+}
+
+TEST(memory_manager, free_first_free)
+{
+    pass::MemoryManager mm{1};
+
+    EXPECT_EQ(0, mm.allocate(10));
+    EXPECT_EQ(10, mm.allocate(10));
+    EXPECT_EQ(20, mm.allocate(10));
+    EXPECT_EQ(30, mm.allocate(10));
+    EXPECT_EQ(40, mm.allocate(10));
+    EXPECT_EQ(6, mm.get_node_list().size());
+
+    mm.free(10);
+    mm.free(0);
+
+    auto node_list = get_node_list(mm);
+    EXPECT_EQ(5, node_list.size());
+    EXPECT_TRUE(node_list[0].is_free());
+    EXPECT_FALSE(node_list[1].is_free());
+    EXPECT_FALSE(node_list[2].is_free());
+    EXPECT_FALSE(node_list[3].is_free());
+}
+
+TEST(memory_manager, free_middle_free)
+{
+    pass::MemoryManager mm{1};
+
+    EXPECT_EQ(0, mm.allocate(10));
+    EXPECT_EQ(10, mm.allocate(10));
+    EXPECT_EQ(20, mm.allocate(10));
+    EXPECT_EQ(30, mm.allocate(10));
+    EXPECT_EQ(40, mm.allocate(10));
+    EXPECT_EQ(6, mm.get_node_list().size());
+
+    mm.free(0);
+    mm.free(20);
+    mm.free(10);
+
+    auto node_list = get_node_list(mm);
+    EXPECT_EQ(4, node_list.size());
+    EXPECT_TRUE(node_list[0].is_free());
+    EXPECT_FALSE(node_list[1].is_free());
+    EXPECT_FALSE(node_list[2].is_free());
+}
+
+TEST(memory_manager, max_allocated)
+{
+    pass::MemoryManager mm{1};
+
+    EXPECT_EQ(0, mm.allocate(10));
+    EXPECT_EQ(10, mm.allocate(10));
+    EXPECT_EQ(20, mm.allocate(10));
+    EXPECT_EQ(30, mm.allocate(10));
+    EXPECT_EQ(40, mm.allocate(10));
+    EXPECT_EQ(6, mm.get_node_list().size());
+
+    mm.free(0);
+    mm.free(20);
+    mm.free(10);
+
+    EXPECT_EQ(mm.max_allocated(), 50);
+}
+
+TEST(memory_manager, bad_free)
+{
+    pass::MemoryManager mm{1};
+
+    EXPECT_THROW(mm.free(10), std::runtime_error);
+}
+
+TEST(memory_manager, align)
+{
+    EXPECT_EQ(8, pass::MemoryManager::align(0, 8));
+    EXPECT_EQ(8, pass::MemoryManager::align(1, 8));
+    EXPECT_EQ(8, pass::MemoryManager::align(2, 8));
+    EXPECT_EQ(8, pass::MemoryManager::align(3, 8));
+    EXPECT_EQ(8, pass::MemoryManager::align(4, 8));
+    EXPECT_EQ(8, pass::MemoryManager::align(5, 8));
+    EXPECT_EQ(8, pass::MemoryManager::align(6, 8));
+    EXPECT_EQ(8, pass::MemoryManager::align(7, 8));
+    EXPECT_EQ(8, pass::MemoryManager::align(8, 8));
+    EXPECT_EQ(16, pass::MemoryManager::align(9, 8));
+}
+
+TEST(memory_manager, memory_align)
+{
+    pass::MemoryManager mm{64};
+
+    EXPECT_EQ(0, mm.allocate(4));
+    EXPECT_EQ(64, mm.allocate(4));
+    EXPECT_EQ(128, mm.allocate(4));
+}
+
+TEST(benchmark, memory_manager)
+{
+    // Synthetic liveness trace: one tensor is defined per op and most die within a few ops
+    const size_t tensor_count = 100000;
+    for (auto scheme : {pass::MemoryManager::allocation_scheme::FIRST_FIT,
+                        pass::MemoryManager::allocation_scheme::BEST_FIT})
+    {
+        mt19937 engine(0);
+        uniform_int_distribution<size_t> size_distribution(1, 1 << 16);
+        uniform_int_distribution<size_t> lifetime_distribution(1, 64);
+        priority_queue<pair<size_t, size_t>,
+                       vector<pair<size_t, size_t>>,
+                       greater<pair<size_t, size_t>>>
+            live;
+        pass::MemoryManager mm(64, scheme);
+
+        stopwatch timer;
+        timer.start();
+        for (size_t i = 0; i < tensor_count; i++)
+        {
+            while (!live.empty() && live.top().first <= i)
+            {
+                mm.free(live.top().second);
+                live.pop();
+            }
+            size_t lifetime = (i % 100 == 0 ? tensor_count : lifetime_distribution(engine));
+            live.push({i + lifetime, mm.allocate(size_distribution(engine))});
+        }
+        timer.stop();
+        cout << (scheme == pass::MemoryManager::allocation_scheme::FIRST_FIT ? "first_fit"
+                                                                               : "best_fit")
+             << " of " << tensor_count << " tensors took " << timer.get_milliseconds()
+             << "ms, pool size " << mm.max_allocated() << "\n";
+    }
+}
+
+TEST(memory_layout, basic)
+{
+    string dump_file = "memory_layout.txt";
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.register_pass<pass::DumpSorted>(dump_file);
+
+    auto graph = make_test_graph();
+    pass_manager.run_passes(graph);
+    auto sorted = graph->get_ordered_ops();
+    size_t temporary_pool_size = graph->get_temporary_pool_size();
+    EXPECT_EQ(12, temporary_pool_size);
+}
+
+TEST(memory_layout, constant)
+{
+    string dump_file = "constant.txt";
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>();
+    pass_manager.register_pass<pass::DumpSorted>(dump_file);
+
+    Shape shape{1};
+    auto c = op::Constant::create(element::i32, shape, {5});
+    auto f = make_shared<Function>(make_shared<op::Negative>(c), op::ParameterVector{});
+
+    pass_manager.run_passes(f);
+    auto sorted = f->get_ordered_ops();
+    size_t temporary_pool_size = f->get_temporary_pool_size();
+    EXPECT_EQ(4, temporary_pool_size);
+}
+
+TEST(memory_layout, strategies)
+{
+    Shape shape{32};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, Shape{4, 32});
+    auto t0 = make_shared<op::Negative>(A);
+    auto t1 = make_shared<op::Broadcast>(t0, Shape{4, 32}, AxisSet{0});
+    auto t2 = make_shared<op::Negative>(A);
+    auto t3 = make_shared<op::Add>(t1, B);
+    auto t4 = make_shared<op::Sum>(t3, AxisSet{0});
+    auto t5 = make_shared<op::Multiply>(t2, t4);
+    auto t6 = make_shared<op::Broadcast>(t5, Shape{4, 32}, AxisSet{0});
+    auto t7 = make_shared<op::Subtract>(t6, t3);
+    auto f = make_shared<Function>(t7, op::ParameterVector{A, B});
+
+    pass::Manager liveness;
+    liveness.register_pass<pass::Liveness>();
+    liveness.run_passes(f);
+
+    auto report = pass::MemoryLayout::get_pool_size_report(f, 64);
+    ASSERT_EQ(4, report.size());
+    EXPECT_LE(report.at("first_fit"), report.at("no_reuse"));
+    EXPECT_LE(report.at("best_fit"), report.at("no_reuse"));
+    EXPECT_LE(report.at("greedy_by_size"), report.at("no_reuse"));
+    EXPECT_LT(report.at("greedy_by_size"), report.at("first_fit"));
+
+    for (auto name : {"first_fit", "best_fit", "greedy_by_size"})
+    {
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::MemoryLayout>(
+            64, false, pass::MemoryLayout::get_strategy(name));
+        pass_manager.run_passes(f);
+        EXPECT_EQ(report.at(name), f->get_temporary_pool_size());
+
+        // Tensors that are live at the same time must not overlap
+        set<descriptor::Tensor*> live;
+        for (auto node : f->get_ordered_ops())
+        {
+            live.insert(node->liveness_new_list.begin(), node->liveness_new_list.end());
+            for (auto a : live)
+            {
+                EXPECT_EQ(0, a->get_pool_offset() % 64);
+                EXPECT_LE(a->get_pool_offset() + a->size(), f->get_temporary_pool_size());
+                for (auto b : live)
+                {
+                    if (a != b)
+                    {
+                        EXPECT_TRUE(a->get_pool_offset() + a->size() <= b->get_pool_offset() ||
+                                    b->get_pool_offset() + b->size() <= a->get_pool_offset())
+                            << name;
+                    }
+                }
+            }
+            for (auto tensor : node->liveness_free_list)
+            {
+                live.erase(tensor);
+            }
+        }
+    }
+
+    EXPECT_THROW(pass::MemoryLayout::get_strategy("worst_fit"), ngraph_error);
+}
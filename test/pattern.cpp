@@ -814,3 +814,51 @@ TEST(pattern, is_contained_match)
     ASSERT_TRUE(n.match(label_abs2, absn2));
     ASSERT_FALSE(n.is_contained_match());
 }
+
+TEST(benchmark, graph_rewrite)
+{
+    // Many short chains where only a few nodes match, so the time is mostly matcher dispatch
+    const size_t num_chains = 2000;
+    const size_t chain_length = 20;
+    auto a = make_shared<op::Parameter>(element::i32, Shape{});
+    auto iconst0 = construct_constant_node(0);
+    auto iconst1 = construct_constant_node(1);
+    NodeVector results;
+    for (size_t i = 0; i < num_chains; i++)
+    {
+        shared_ptr<Node> node = a;
+        for (size_t j = 0; j < chain_length; j++)
+        {
+            if (j % 10 == 0)
+            {
+                node = node + iconst0;
+            }
+            else if (j % 10 == 5)
+            {
+                node = node * iconst1;
+            }
+            else
+            {
+                node = make_shared<op::Abs>(node);
+            }
+        }
+        results.push_back(node);
+    }
+    auto f = make_shared<Function>(results, op::ParameterVector{a});
+    size_t node_count = f->get_ops().size();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<TestGraphRewrite>();
+    stopwatch timer;
+    timer.start();
+    pass_manager.run_passes(f);
+    timer.stop();
+    cout << "graph rewrite of " << node_count << " nodes took " << timer.get_milliseconds()
+         << "ms\n";
+
+    for (auto node : f->get_ops())
+    {
+        EXPECT_EQ(nullptr, dynamic_pointer_cast<op::Add>(node));
+        EXPECT_EQ(nullptr, dynamic_pointer_cast<op::Multiply>(node));
+    }
+}
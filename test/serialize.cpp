@@ -103,6 +103,68 @@ TEST(serialize, main)
     backend->call_with_validate(sfunc, {result}, {x, z, y});
     EXPECT_EQ((vector<float>{200, 288, 392, 512}), read_vector<float>(result));
 }
+// Hands out its data a few bytes at a time, like a pipe or a socket
+class chunked_streambuf : public streambuf
+{
+public:
+    chunked_streambuf(const string& data, size_t chunk_size)
+        : m_data(data)
+        , m_position(0)
+        , m_chunk_size(chunk_size)
+    {
+    }
+
+protected:
+    int_type underflow() override
+    {
+        if (m_position >= m_data.size())
+        {
+            return traits_type::eof();
+        }
+        size_t size = min(m_chunk_size, m_data.size() - m_position);
+        char* begin = &m_data[m_position];
+        setg(begin, begin, begin + size);
+        m_position += size;
+        return traits_type::to_int_type(*begin);
+    }
+
+private:
+    string m_data;
+    size_t m_position;
+    size_t m_chunk_size;
+};
+
+TEST(serialize, chunked_stream)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>((A + B) * C, op::ParameterVector{A, B}, "f");
+
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    auto Y = make_shared<op::Parameter>(element::f32, shape);
+    auto D = op::Constant::create(element::f32, shape, {10, 20, 30, 40});
+    auto g = make_shared<Function>(make_shared<op::FunctionCall>(f, NodeVector{X, Y}) + D,
+                                   op::ParameterVector{X, Y},
+                                   "g");
+
+    string js = serialize(g, 4);
+    chunked_streambuf buffer(js, 7);
+    istream in(&buffer);
+    shared_ptr<Function> sfunc = deserialize(in);
+    ASSERT_NE(sfunc, nullptr);
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto x = backend->create_tensor(element::f32, shape);
+    copy_data(x, vector<float>{1, 2, 3, 4});
+    auto y = backend->create_tensor(element::f32, shape);
+    copy_data(y, vector<float>{5, 6, 7, 8});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    backend->call_with_validate(sfunc, {result}, {x, y});
+    EXPECT_EQ((vector<float>{16, 36, 60, 88}), read_vector<float>(result));
+}
 #endif
 
 TEST(serialize, existing_models)
@@ -158,6 +220,90 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, constant_16bit_float)
+{
+    const string tmp_file = "serialize_constant_16bit_float.cpio";
+    Shape shape{2, 2};
+    auto A = op::Constant::create(element::bf16, shape, {1.0, 1.0 / 3, -2.5, 257.0});
+    auto B = op::Constant::create(element::f16, shape, {1.0, 1.0 / 3, -2.5, 65519.0});
+    auto f = make_shared<Function>(NodeVector{A, B}, op::ParameterVector{});
+
+    serialize(tmp_file, f);
+    auto g = deserialize(tmp_file);
+    ASSERT_NE(g, nullptr);
+    file_util::remove_file(tmp_file);
+    size_t found = 0;
+    for (shared_ptr<Node> node : g->get_ops())
+    {
+        shared_ptr<op::Constant> c = dynamic_pointer_cast<op::Constant>(node);
+        if (c && c->get_element_type() == element::bf16)
+        {
+            found++;
+            auto v = c->get_vector<bfloat16>();
+            EXPECT_EQ((vector<float>{1.0f, 0.333984375f, -2.5f, 256.0f}),
+                      (vector<float>{v[0], v[1], v[2], v[3]}));
+        }
+        else if (c && c->get_element_type() == element::f16)
+        {
+            found++;
+            auto v = c->get_vector<float16>();
+            EXPECT_EQ((vector<float>{1.0f, 0.333251953125f, -2.5f, 65504.0f}),
+                      (vector<float>{v[0], v[1], v[2], v[3]}));
+        }
+    }
+    EXPECT_EQ(2, found);
+}
+
+TEST(serialize, constant_mapped)
+{
+    const string tmp_file = "serialize_constant_mapped.cpio";
+    auto A = op::Constant::create(element::i8, Shape{3}, {1, 2, 3});
+    auto B = op::Constant::create(element::f32, Shape{3}, {1.5, 2.5, 3.5});
+    auto C = op::Constant::create(element::f64, Shape{2}, {4, 5});
+    auto f = make_shared<Function>(NodeVector{A, B, C}, op::ParameterVector{});
+    serialize(tmp_file, f);
+
+    ifstream in(tmp_file, ios_base::binary | ios_base::in);
+    auto streamed = deserialize(in);
+    in.close();
+    auto mapped = deserialize(tmp_file);
+    file_util::remove_file(tmp_file);
+
+    for (auto g : {streamed, mapped})
+    {
+        ASSERT_NE(g, nullptr);
+        size_t count = 0;
+        for (shared_ptr<Node> node : g->get_ops())
+        {
+            if (auto c = dynamic_pointer_cast<op::Constant>(node))
+            {
+                count++;
+                if (g == mapped)
+                {
+                    // Constant data is used in place in the mapped file
+                    EXPECT_EQ(0, reinterpret_cast<size_t>(c->get_data_ptr()) % 64);
+                    auto copy =
+                        dynamic_pointer_cast<op::Constant>(c->copy_with_new_args(NodeVector{}));
+                    EXPECT_EQ(c->get_data_ptr(), copy->get_data_ptr());
+                }
+                if (c->get_element_type() == element::i8)
+                {
+                    EXPECT_EQ((vector<int8_t>{1, 2, 3}), c->get_vector<int8_t>());
+                }
+                else if (c->get_element_type() == element::f32)
+                {
+                    EXPECT_EQ((vector<float>{1.5, 2.5, 3.5}), c->get_vector<float>());
+                }
+                else
+                {
+                    EXPECT_EQ((vector<double>{4, 5}), c->get_vector<double>());
+                }
+            }
+        }
+        EXPECT_EQ(3, count);
+    }
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;